@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AdaptiveCardTemplate.h"
+#include "Container.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "TemplateExpression.h"
+#include "TextBlock.h"
+
+#include <clocale>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string templateDataJson = R"({
+        "employee": {
+            "name": "Matt",
+            "manager": { "name": "Thomas" },
+            "peers": [ { "name": "Andrew" }, { "name": "Lei" }, { "name": "Mary Anne" } ]
+        },
+        "date": "03/15/2018 12:00:00",
+        "requests": [ { "type": "monitor", "price": 100 }, { "type": "laptop", "price": 2000 }, { "price": 2000 } ],
+        "commitMessage": "{\"buildNumber\":\"20180504.3\"}"
+    })";
+
+    // Expands a template of a single value against the test data
+    Json::Value ExpandValue(const std::string& templateJson)
+    {
+        const AdaptiveCardTemplate cardTemplate(R"({ "value": )" + templateJson + " }");
+        return cardTemplate.Expand(ParseUtil::GetJsonValueFromString(templateDataJson))["value"];
+    }
+
+    std::string ExpandText(const std::string& text)
+    {
+        return ExpandValue("\"" + text + "\"").asString();
+    }
+
+    TEST_CLASS(AdaptiveCardTemplateTest)
+    {
+    public:
+        TEST_METHOD(BindsData)
+        {
+            Assert::AreEqual("Hi Matt, your manager is Thomas"s, ExpandText("Hi ${employee.name}, your manager is ${employee['manager'].name}"));
+            Assert::AreEqual("Mary Anne"s, ExpandText("${employee.peers[2].name}"));
+
+            // a string that's only an expression takes the expression's type
+            Assert::AreEqual(100, ExpandValue(R"("${requests[0].price}")").asInt());
+            Assert::IsTrue(ExpandValue(R"("${employee.manager}")").isObject());
+
+            // a path that isn't in the data is left as written
+            Assert::AreEqual("Hi ${employee.nickname}!"s, ExpandText("Hi ${employee.nickname}!"));
+
+            // $data binds a new data context, which $root gets out of
+            const auto value = ExpandValue(R"({ "$data": "${employee.manager}", "text": "${name} manages ${$root.employee.name}" })");
+            Assert::AreEqual("Thomas manages Matt"s, value["text"].asString());
+            Assert::IsFalse(value.isMember("$data"));
+
+            const AdaptiveCardTemplate hostTemplate(R"({ "text": "${$host.user}" })");
+            Assert::AreEqual("Lei"s, hostTemplate.Expand(Json::Value(), ParseUtil::GetJsonValueFromString(R"({ "user": "Lei" })"))["text"].asString());
+        }
+
+        TEST_METHOD(RepeatsItems)
+        {
+            const auto items = ExpandValue(R"([
+                { "type": "TextBlock", "text": "Peers" },
+                { "type": "TextBlock", "$data": "${employee.peers}", "text": "${$index + 1}. ${name}" }
+            ])");
+
+            Assert::AreEqual(4u, items.size());
+            Assert::AreEqual("Peers"s, items[0]["text"].asString());
+            Assert::AreEqual("1. Andrew"s, items[1]["text"].asString());
+            Assert::AreEqual("3. Mary Anne"s, items[3]["text"].asString());
+
+            // a member whose object repeats becomes an array of them
+            Assert::AreEqual(3u, ExpandValue(R"({ "items": { "$data": "${requests}", "text": "${price}" } })")["items"].size());
+        }
+
+        TEST_METHOD(DropsObjectsWhen)
+        {
+            const AdaptiveCardTemplate cardTemplate(R"({ "items": [
+                { "$data": "${requests}", "$when": "${price > 500}", "text": "${type}" },
+                { "$when": "${exists(missing)}", "text": "missing" },
+                { "$when": "${length(42) > 1}", "text": "error" },
+                { "$when": "not an expression", "text": "literal" }
+            ] })");
+
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+            const auto items = cardTemplate.Expand(ParseUtil::GetJsonValueFromString(templateDataJson), Json::Value(), warnings)["items"];
+
+            Assert::AreEqual(2u, items.size());
+            Assert::AreEqual("laptop"s, items[0]["text"].asString());
+            Assert::AreEqual("${type}"s, items[1]["text"].asString());
+            // the $when that fails to evaluate and the one that isn't an expression are reported
+            Assert::AreEqual(2ui64, warnings.size());
+        }
+
+        TEST_METHOD(CallsFunctions)
+        {
+            Assert::AreEqual("matt MATT 4"s, ExpandText("${toLower(employee.name)} ${toUpper(employee.name)} ${string(length(employee.name))}"));
+            Assert::AreEqual("Anne 3"s, ExpandText("${substring(employee.peers[2].name, 5, 4)} ${indexOf(employee.peers[0].name, 'r')}"));
+            Assert::AreEqual("100 2000 4100"s, ExpandText("${min(select(requests, r, r.price))} ${max(select(requests, r, r.price))} ${sum(select(requests, r, r.price))}"));
+            Assert::AreEqual(2u, ExpandValue(R"("${where(requests, r, exists(r.type))}")").size());
+            Assert::AreEqual("good attention"s, ExpandText("${if(requests[0].price <= 500, 'good', 'attention')} ${if(requests[1].price <= 500, 'good', 'attention')}"));
+            Assert::AreEqual("20180504.3"s, ExpandText("${json(commitMessage).buildNumber}"));
+            Assert::AreEqual("1,234,567.50 7 2.5"s, ExpandText("${formatNumber(1234567.5, 2)} ${7 / 1 + 0} ${5 / 2.0}"));
+            Assert::AreEqual("ab1true"s, ExpandText("${concat('a', 'b', 1, true)}"));
+        }
+
+        TEST_METHOD(FormatsNumbersWhateverTheLocale)
+        {
+            // numbers keep '.' as their decimal point under a locale with another one, when the host has it
+            const std::string previousLocale = std::setlocale(LC_NUMERIC, nullptr);
+            if (!std::setlocale(LC_NUMERIC, "de_DE.UTF-8") && !std::setlocale(LC_NUMERIC, "de-DE"))
+            {
+                return;
+            }
+
+            const auto expanded = ExpandText("${formatNumber(1234567.5, 2)} ${5 / 2.0} ${float('2.25') * 2} ${1.5 + 1}");
+            std::setlocale(LC_NUMERIC, previousLocale.c_str());
+            Assert::AreEqual("1,234,567.50 2.5 4.5 2.5"s, expanded);
+        }
+
+        TEST_METHOD(FormatsDates)
+        {
+            Assert::AreEqual("2018-03-15T12:00:00"s, ExpandText("${formatDateTime(date, 'yyyy-MM-ddTHH:mm:ss')}"));
+            Assert::AreEqual("Thursday, March 15, 2018 12:00 PM"s, ExpandText("${formatDateTime(date, 'dddd, MMMM d, yyyy hh:mm tt')}"));
+            Assert::AreEqual("2017-02-14 09:08"s, ExpandText("${formatDateTime('2017-02-14T06:08:00-03:00', 'yyyy-MM-dd HH:mm')}"));
+            Assert::AreEqual("1970-01-02T00:00:00.000Z"s, ExpandText("${formatEpoch(86400)}"));
+            Assert::AreEqual("01/01/2001"s, ExpandText("${formatTicks(631139040000000000, 'MM/dd/yyyy')}"));
+        }
+
+        TEST_METHOD(LeavesBadExpressionsAlone)
+        {
+            // an expression that doesn't parse, or calls an unknown function, is text
+            Assert::AreEqual("${employee.} ${unknown(1)} ${"s, ExpandText("${employee.} ${unknown(1)} ${"));
+
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+            const AdaptiveCardTemplate cardTemplate(R"({ "text": "${substring(employee.name, 10)}" })");
+            const auto expanded = cardTemplate.Expand(ParseUtil::GetJsonValueFromString(templateDataJson), Json::Value(), warnings);
+            Assert::AreEqual("${substring(employee.name, 10)}"s, expanded["text"].asString());
+            Assert::AreEqual(1ui64, warnings.size());
+
+            Assert::ExpectException<AdaptiveCardParseException>([]() { TemplateExpression expression("1 +"); });
+        }
+
+        TEST_METHOD(ExpandsToCard)
+        {
+            const AdaptiveCardTemplate cardTemplate(R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "body": [ { "type": "Container", "$data": "${employee.peers}", "items": [
+                    { "type": "TextBlock", "text": "${name}" }
+                ] } ]
+            })");
+
+            const auto data = ParseUtil::GetJsonValueFromString(templateDataJson);
+            const auto result = cardTemplate.ExpandToCard(data, "1.5");
+            const auto body = result->GetAdaptiveCard()->GetBody();
+            Assert::AreEqual(3ui64, body.size());
+
+            const auto container = std::dynamic_pointer_cast<Container>(body[1]);
+            Assert::AreEqual("Lei"s, std::dynamic_pointer_cast<TextBlock>(container->GetItems()[0])->GetText());
+
+            // the card is the one parsing the expanded json gives
+            Assert::AreEqual(
+                AdaptiveCard::DeserializeFromString(ParseUtil::JsonToString(cardTemplate.Expand(data)), "1.5")->GetAdaptiveCard()->Serialize(),
+                result->GetAdaptiveCard()->Serialize());
+        }
+    };
+}
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::vector<std::string> LoadSampleCards();
+
+    // Flattens everything a caller can observe about a parse into a string so two parses can be compared
+    std::string DescribeParse(const std::function<std::shared_ptr<ParseResult>()>& parse)
+    {
+        try
+        {
+            const auto parseResult = parse();
+            std::string description = parseResult->GetAdaptiveCard()->Serialize();
+            for (const auto& warning : parseResult->GetWarnings())
+            {
+                description += "\n" + std::to_string(static_cast<int>(warning->GetStatusCode())) + " " + warning->GetReason();
+            }
+            return description;
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            return "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + " " + e.GetReason();
+        }
+    }
+
+    void AssertByBodyItemMatches(const std::string& json)
+    {
+        const auto expected = DescribeParse([&json]() { return AdaptiveCard::DeserializeFromString(json, "1.6"); });
+        const auto actual = DescribeParse([&json]() { return AdaptiveCard::DeserializeFromStringByBodyItem(json, "1.6"); });
+        Assert::AreEqual(expected, actual);
+    }
+
+    TEST_CLASS(BodyItemDeserializationTest)
+    {
+    public:
+        TEST_METHOD(MatchesRegularPathOnSamples)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            for (const auto& card : cards)
+            {
+                AssertByBodyItemMatches(card);
+            }
+        }
+
+        TEST_METHOD(KeepsUnknownProperties)
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromStringByBodyItem(R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "cardExtra": { "nested": [1, 2] },
+                // comments are whitespace to jsoncpp too
+                "body": [
+                    { "type": "TextBlock", "text": "A", "itemExtra": "x" },
+                    { "type": "TextBlock", "text": "B" }
+                ]
+            })", "1.5");
+
+            const auto card = parseResult->GetAdaptiveCard();
+            Assert::AreEqual(2ui64, card->GetBody().size());
+            Assert::AreEqual("B"s, std::static_pointer_cast<TextBlock>(card->GetBody()[1])->GetText());
+            Assert::AreEqual(2, card->GetAdditionalProperties()["cardExtra"]["nested"][1].asInt());
+            Assert::AreEqual("x"s, card->GetBody()[0]->GetAdditionalProperties()["itemExtra"].asString());
+        }
+
+        TEST_METHOD(ReportsErrorsLikeRegularPath)
+        {
+            // malformed card text, a malformed item, a body that isn't an array and duplicate bodies
+            AssertByBodyItemMatches(R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock" )");
+            AssertByBodyItemMatches(R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": tru } ] })");
+            AssertByBodyItemMatches(R"({ "type": "AdaptiveCard", "version": "1.5", "body": { "type": "TextBlock" } })");
+            AssertByBodyItemMatches(R"({ "type": "AdaptiveCard", "version": "1.5", "body": [], "body": [ { "type": "TextBlock", "text": "A" } ] })");
+            AssertByBodyItemMatches(R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "Unknown" }, { "type": "TextBlock", "text": "A" } ] })");
+        }
+    };
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardArena.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // One of each kind of node the card arena allocates
+    const std::string c_arenaCard = R"({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "body": [
+            {
+                "type": "TextBlock",
+                "text": "Hello",
+                "requires": { "adaptiveCards": "1.2" },
+                "fallback": { "type": "TextBlock", "text": "Fallback" }
+            },
+            {
+                "type": "RichTextBlock",
+                "inlines": [ { "type": "TextRun", "text": "Run" } ]
+            },
+            {
+                "type": "FactSet",
+                "facts": [ { "title": "Fact", "value": "Value" } ]
+            },
+            {
+                "type": "Input.ChoiceSet",
+                "id": "choices",
+                "choices": [ { "title": "One", "value": "1" }, { "title": "Two", "value": "2" } ]
+            },
+            {
+                "type": "Media",
+                "sources": [ { "mimeType": "video/mp4", "url": "https://adaptivecards.io/content/media.mp4" } ]
+            },
+            {
+                "type": "Table",
+                "columns": [ { "width": 1 } ],
+                "rows": [ { "type": "TableRow", "cells": [ { "type": "TableCell", "items": [ { "type": "TextBlock", "text": "Cell" } ] } ] } ]
+            }
+        ],
+        "actions": [
+            { "type": "Action.ToggleVisibility", "title": "Toggle", "targetElements": [ "choices" ] },
+            { "type": "Action.ShowCard", "title": "Show", "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "text": "Shown" } ] } }
+        ]
+    })";
+
+    TEST_CLASS(CardArenaTest)
+    {
+    public:
+        TEST_METHOD(ArenaParseMatchesHeapParse)
+        {
+            const auto heapCard = AdaptiveCard::DeserializeFromString(c_arenaCard, "1.5")->GetAdaptiveCard();
+
+            std::shared_ptr<AdaptiveCard> arenaCard;
+            {
+                ParseContext context;
+                Assert::IsFalse(context.GetUseCardArena());
+                context.SetUseCardArena(true);
+                arenaCard = AdaptiveCard::DeserializeFromString(c_arenaCard, "1.5", context)->GetAdaptiveCard();
+            }
+
+            // the card outlives the context it was parsed with
+            Assert::AreEqual(heapCard->Serialize(), arenaCard->Serialize());
+        }
+
+        TEST_METHOD(ArenaLivesAsLongAsItsNodes)
+        {
+            auto arena = std::make_shared<CardArena>();
+            const std::weak_ptr<CardArena> weakArena = arena;
+
+            auto textBlock = std::allocate_shared<TextBlock>(CardArenaAllocator<TextBlock>(arena));
+            textBlock->SetText("In the arena");
+            arena.reset();
+            Assert::IsFalse(weakArena.expired());
+            Assert::AreEqual(std::string("In the arena"), textBlock->GetText());
+
+            textBlock.reset();
+            Assert::IsTrue(weakArena.expired());
+        }
+
+        TEST_METHOD(ArenaAllocations)
+        {
+            CardArena arena;
+            Assert::AreEqual(size_t{0}, arena.GetReservedSize());
+
+            const auto first = arena.Allocate(3, 1);
+            const auto second = arena.Allocate(sizeof(double), alignof(double));
+            Assert::AreEqual(size_t{0}, reinterpret_cast<uintptr_t>(second) % alignof(double));
+            Assert::IsTrue(static_cast<std::byte*>(second) >= static_cast<std::byte*>(first) + 3);
+            const auto reservedSize = arena.GetReservedSize();
+
+            // a large allocation gets a block of its own, and small ones carry on in the block they were using
+            const auto large = arena.Allocate(reservedSize * 4, 16);
+            Assert::IsNotNull(large);
+            Assert::IsTrue(arena.GetReservedSize() > reservedSize * 5);
+
+            const auto third = arena.Allocate(8, 8);
+            Assert::IsTrue(static_cast<std::byte*>(third) > static_cast<std::byte*>(second));
+            Assert::IsTrue(static_cast<std::byte*>(third) < static_cast<std::byte*>(first) + reservedSize);
+        }
+    };
+}
@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardBatchParser.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // The serialized card and warnings of a successful parse, or the status code of a failed one
+    std::string DescribeBatchParseResult(const BatchParseResult& result)
+    {
+        if (!result.Succeeded())
+        {
+            try
+            {
+                std::rethrow_exception(result.GetError());
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                return "error " + std::to_string(static_cast<int>(e.GetStatusCode()));
+            }
+        }
+
+        std::string description = result.GetParseResult()->GetAdaptiveCard()->Serialize();
+        for (const auto& warning : result.GetParseResult()->GetWarnings())
+        {
+            description += "\nwarning " + std::to_string(static_cast<int>(warning->GetStatusCode()));
+        }
+        return description;
+    }
+
+    std::string MakeBatchCard(const std::string& version, const std::string& body)
+    {
+        return R"({ "type": "AdaptiveCard", "version": ")" + version + R"(", "body": [)" + body + "] }";
+    }
+
+    std::vector<std::string> MakeBatchCards()
+    {
+        return {
+            MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "Hello", "id": "shared" })"),
+            MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "Again", "id": "shared" })"),
+            MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "" }, { "type": "Image", "url": "a.png", "height": "-5px" })"),
+            "{ not json",
+            MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "A", "id": "dup" }, { "type": "TextBlock", "text": "B", "id": "dup" })"),
+            MakeBatchCard("9.0", R"({ "type": "TextBlock", "text": "Too new" })"),
+            R"({ "type": "AdaptiveCard", "version": "1.5", "lang": "fr", "body": [ { "type": "TextBlock", "text": "Bonjour" } ] })",
+            MakeBatchCard("1.5", R"({ "type": "Container", "style": "emphasis", "items": [ { "type": "TextBlock", "text": "Inside" } ] })"),
+        };
+    }
+
+    TEST_CLASS(CardBatchParserTest)
+    {
+    public:
+        TEST_METHOD(MatchesIndividualParses)
+        {
+            const auto cards = MakeBatchCards();
+            std::vector<std::string> expected;
+            for (const auto& card : cards)
+            {
+                try
+                {
+                    expected.push_back(DescribeBatchParseResult(BatchParseResult{AdaptiveCard::DeserializeFromString(card, "1.5")}));
+                }
+                catch (...)
+                {
+                    expected.push_back(DescribeBatchParseResult(BatchParseResult{std::current_exception()}));
+                }
+            }
+
+            // The first two cards share an id, which is only a collision within a single card
+            Assert::IsTrue(expected[0].find("error") == std::string::npos);
+            Assert::IsTrue(expected[1].find("error") == std::string::npos);
+            Assert::AreEqual("error "s + std::to_string(static_cast<int>(ErrorStatusCode::InvalidJson)), expected[3]);
+            Assert::AreEqual("error "s + std::to_string(static_cast<int>(ErrorStatusCode::IdCollision)), expected[4]);
+
+            for (const unsigned int maxThreads : {1u, 3u, 16u})
+            {
+                CardBatchParser parser("1.5");
+                parser.SetMaxThreads(maxThreads);
+                const auto results = parser.DeserializeFromStrings(cards);
+
+                Assert::AreEqual(cards.size(), results.size());
+                for (size_t i = 0; i < cards.size(); ++i)
+                {
+                    Assert::AreEqual(expected[i], DescribeBatchParseResult(results[i]));
+                }
+            }
+        }
+
+        TEST_METHOD(AcceptsStringViews)
+        {
+            const std::string cards = MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "First" })") +
+                MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "Second" })");
+            const size_t split = cards.find("}{") + 1;
+            const std::vector<std::string_view> views{std::string_view(cards).substr(0, split), std::string_view(cards).substr(split)};
+
+            const auto results = CardBatchParser("1.5").DeserializeFromStrings(views);
+            Assert::AreEqual(2ui64, results.size());
+            Assert::AreEqual("Second"s, std::static_pointer_cast<TextBlock>(results[1].GetParseResult()->GetAdaptiveCard()->GetBody()[0])->GetText());
+        }
+
+        TEST_METHOD(UsesContextSettings)
+        {
+            ParseContext context;
+            context.SetLanguage("de");
+            context.SetMaxWarningCount(1);
+
+            const std::vector<std::string> cards{
+                MakeBatchCard("1.5", R"({ "type": "TextBlock", "text": "" }, { "type": "FactSet", "facts": [] })"),
+                R"({ "type": "AdaptiveCard", "version": "1.5", "lang": "fr", "body": [] })",
+            };
+
+            CardBatchParser parser("1.5", context);
+            parser.SetMaxThreads(2);
+            const auto results = parser.DeserializeFromStrings(cards);
+
+            // the language of one card doesn't carry over to the next, and context is left alone
+            Assert::AreEqual(1ui64, results[0].GetParseResult()->GetWarnings().size());
+            Assert::AreEqual("de"s, results[0].GetParseResult()->GetAdaptiveCard()->GetLanguage());
+            Assert::AreEqual("fr"s, results[1].GetParseResult()->GetAdaptiveCard()->GetLanguage());
+            Assert::AreEqual("de"s, context.GetLanguage());
+            Assert::IsTrue(context.warnings.empty());
+        }
+
+        TEST_METHOD(SettingsCopyLeavesParseStateBehind)
+        {
+            ParseContext context;
+            context.SetLanguage("de");
+            context.SetMaxWarningCount(1);
+            context.SetUseCardArena(true);
+            context.SetMaxParseThreads(4);
+            context.SetDeferNestedContent(true);
+            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidValue, "a"));
+            context.AddProhibitedElementType({"TextBlock"});
+
+            auto copy = context.CreateSettingsCopy();
+            Assert::IsTrue(copy.elementParserRegistration == context.elementParserRegistration);
+            Assert::IsTrue(copy.actionParserRegistration == context.actionParserRegistration);
+            Assert::AreEqual("de"s, copy.GetLanguage());
+            Assert::AreEqual(1ui64, copy.GetMaxWarningCount().value());
+            Assert::IsTrue(copy.GetUseCardArena());
+            Assert::AreEqual(4u, copy.GetMaxParseThreads());
+            Assert::IsTrue(copy.GetDeferNestedContent());
+
+            Assert::IsTrue(copy.warnings.empty());
+            copy.ShouldParse("TextBlock");
+        }
+
+        TEST_METHOD(EmptyBatch)
+        {
+            CardBatchParser parser("1.5");
+            parser.SetMaxThreads(4);
+            Assert::IsTrue(parser.DeserializeFromStrings(std::vector<std::string>{}).empty());
+        }
+    };
+}
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardSnapshot.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::vector<std::string> LoadSampleCards();
+    std::string DescribeParse(const std::function<std::shared_ptr<ParseResult>()>& parse);
+
+    TEST_CLASS(CardSnapshotTest)
+    {
+    public:
+        TEST_METHOD(RoundTripsSamples)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            for (const auto& card : cards)
+            {
+                std::shared_ptr<ParseResult> parseResult;
+                try
+                {
+                    parseResult = AdaptiveCard::DeserializeFromString(card, "1.6");
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // some samples are intentionally invalid
+                    continue;
+                }
+
+                const auto snapshot = CardSnapshot::Save(*parseResult);
+                Assert::AreEqual(
+                    DescribeParse([&parseResult]() { return parseResult; }),
+                    DescribeParse([&snapshot]() { return CardSnapshot::Load(snapshot); }));
+                Assert::AreEqual(
+                    ParseUtil::JsonToString(parseResult->GetAdaptiveCard()->SerializeToJsonValue()),
+                    ParseUtil::JsonToString(CardSnapshot::Load(snapshot)->GetAdaptiveCard()->SerializeToJsonValue()));
+            }
+        }
+
+        TEST_METHOD(RestoresWhatParsingWorksOut)
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "unknownProperty": [ 1, 2.5, "three", null ],
+                "body": [
+                    { "type": "ColumnSet", "id": "columns", "columns": [
+                        { "type": "Column", "width": "50px", "style": "emphasis", "bleed": true, "items": [
+                            { "type": "Container", "style": "good", "bleed": true, "items": [ { "type": "TextBlock", "text": "one" } ] }
+                        ] },
+                        { "type": "Column", "width": "stretch", "items": [ { "type": "TextBlock", "text": "two" } ] }
+                    ] },
+                    { "type": "TextBlock", "text": "" }
+                ]
+            })", "1.5");
+            Assert::AreEqual(1ui64, parseResult->GetWarnings().size());
+
+            const auto loaded = CardSnapshot::Load(CardSnapshot::Save(*parseResult));
+            Assert::AreEqual(1ui64, loaded->GetWarnings().size());
+            Assert::AreEqual(parseResult->GetWarnings()[0]->GetReason(), loaded->GetWarnings()[0]->GetReason());
+
+            const auto card = loaded->GetAdaptiveCard();
+            Assert::AreEqual(2.5, card->GetAdditionalProperties()["unknownProperty"][1].asDouble());
+
+            const auto parsedColumnSet = std::static_pointer_cast<ColumnSet>(parseResult->GetAdaptiveCard()->GetBody()[0]);
+            const auto parsedColumn = parsedColumnSet->GetColumns()[0];
+            const auto parsedContainer = std::static_pointer_cast<Container>(parsedColumn->GetItems()[0]);
+
+            const auto columnSet = std::static_pointer_cast<ColumnSet>(card->GetBody()[0]);
+            const auto column = columnSet->GetColumns()[0];
+            const auto container = std::static_pointer_cast<Container>(column->GetItems()[0]);
+            Assert::AreEqual(50, column->GetPixelWidth());
+            Assert::IsTrue(column->GetBleedDirection() == parsedColumn->GetBleedDirection());
+            Assert::IsTrue(container->GetBleedDirection() == parsedContainer->GetBleedDirection());
+            Assert::IsTrue(container->GetBleedDirection() != ContainerBleedDirection::BleedRestricted);
+
+            // the bleeding container points at the column that holds it, not the one it was parsed under
+            Assert::IsTrue(parsedContainer->GetParentalId() == parsedColumn->GetInternalId());
+            Assert::IsTrue(container->GetParentalId() == column->GetInternalId());
+            Assert::IsFalse(column->GetInternalId() == parsedColumn->GetInternalId());
+        }
+
+        TEST_METHOD(GivesNewInternalIds)
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "a" }, { "type": "TextBlock", "text": "b" } ] })",
+                "1.5");
+            const auto snapshot = CardSnapshot::Save(*parseResult);
+
+            std::unordered_set<unsigned int> internalIds;
+            for (int i = 0; i < 2; ++i)
+            {
+                const auto card = CardSnapshot::Load(snapshot)->GetAdaptiveCard();
+                Assert::IsTrue(internalIds.insert(card->GetInternalId().Hash()).second);
+                for (const auto& element : card->GetBody())
+                {
+                    Assert::IsTrue(internalIds.insert(element->GetInternalId().Hash()).second);
+                }
+            }
+        }
+
+        TEST_METHOD(RejectsBadSnapshots)
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(
+                R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "text" } ] })", "1.5");
+            const auto snapshot = CardSnapshot::Save(*parseResult);
+
+            Assert::ExpectException<AdaptiveCardParseException>([]() { CardSnapshot::Load(""); });
+            Assert::ExpectException<AdaptiveCardParseException>([&snapshot]() { CardSnapshot::Load("XCSN" + snapshot.substr(4)); });
+
+            // a snapshot of another version of the format
+            auto otherVersion = snapshot;
+            otherVersion[4] = static_cast<char>(CardSnapshot::FormatVersion + 1);
+            Assert::ExpectException<AdaptiveCardParseException>([&otherVersion]() { CardSnapshot::Load(otherVersion); });
+
+            for (size_t size = 0; size < snapshot.size(); ++size)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&snapshot, size]() { CardSnapshot::Load(std::string_view(snapshot).substr(0, size)); });
+            }
+            Assert::ExpectException<AdaptiveCardParseException>([&snapshot]() { CardSnapshot::Load(snapshot + "x"); });
+        }
+    };
+}
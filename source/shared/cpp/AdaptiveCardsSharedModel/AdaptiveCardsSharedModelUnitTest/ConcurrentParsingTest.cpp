@@ -0,0 +1,316 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "Carousel.h"
+#include "CarouselPage.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Reads every card in the samples/ corpus. Host configs and templates aren't cards, so skip those.
+    std::vector<std::string> LoadSampleCards()
+    {
+        const auto samplesPath = std::filesystem::path(__FILE__).parent_path() / ".." / ".." / ".." / ".." / ".." / "samples";
+
+        std::vector<std::string> cards;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesPath))
+        {
+            const auto& path = entry.path();
+            const auto pathString = path.generic_string();
+            if (path.extension() != ".json" || pathString.find("/HostConfig/") != std::string::npos ||
+                pathString.find("/Templates/") != std::string::npos)
+            {
+                continue;
+            }
+
+            std::ifstream file(path);
+            std::stringstream contents;
+            contents << file.rdbuf();
+            cards.push_back(contents.str());
+        }
+        return cards;
+    }
+
+    void CollectInternalIds(const std::shared_ptr<AdaptiveCard>& card, std::vector<unsigned int>& ids);
+
+    void CollectInternalIds(const std::shared_ptr<BaseElement>& element, std::vector<unsigned int>& ids)
+    {
+        if (element == nullptr)
+        {
+            return;
+        }
+
+        ids.push_back(element->GetInternalId().Hash());
+        CollectInternalIds(element->GetFallbackContent(), ids);
+
+        if (const auto showCard = std::dynamic_pointer_cast<ShowCardAction>(element))
+        {
+            CollectInternalIds(showCard->GetCard(), ids);
+        }
+        else if (const auto container = std::dynamic_pointer_cast<Container>(element))
+        {
+            for (const auto& item : container->GetItems())
+            {
+                CollectInternalIds(item, ids);
+            }
+        }
+        else if (const auto column = std::dynamic_pointer_cast<Column>(element))
+        {
+            for (const auto& item : column->GetItems())
+            {
+                CollectInternalIds(item, ids);
+            }
+        }
+        else if (const auto columnSet = std::dynamic_pointer_cast<ColumnSet>(element))
+        {
+            for (const auto& item : columnSet->GetColumns())
+            {
+                CollectInternalIds(item, ids);
+            }
+        }
+        else if (const auto carousel = std::dynamic_pointer_cast<Carousel>(element))
+        {
+            for (const auto& page : carousel->GetPages())
+            {
+                CollectInternalIds(page, ids);
+            }
+        }
+        else if (const auto table = std::dynamic_pointer_cast<Table>(element))
+        {
+            for (const auto& row : table->GetRows())
+            {
+                CollectInternalIds(row, ids);
+            }
+        }
+        else if (const auto tableRow = std::dynamic_pointer_cast<TableRow>(element))
+        {
+            for (const auto& cell : tableRow->GetCells())
+            {
+                CollectInternalIds(cell, ids);
+            }
+        }
+        else if (const auto actionSet = std::dynamic_pointer_cast<ActionSet>(element))
+        {
+            for (const auto& action : actionSet->GetActions())
+            {
+                CollectInternalIds(action, ids);
+            }
+        }
+    }
+
+    void CollectInternalIds(const std::shared_ptr<AdaptiveCard>& card, std::vector<unsigned int>& ids)
+    {
+        if (card == nullptr)
+        {
+            return;
+        }
+
+        ids.push_back(card->GetInternalId().Hash());
+        for (const auto& element : card->GetBody())
+        {
+            CollectInternalIds(element, ids);
+        }
+        for (const auto& action : card->GetActions())
+        {
+            CollectInternalIds(action, ids);
+        }
+    }
+
+    // Parses every card in cards, returning the number of cards that parsed and appending their internal ids to ids.
+    // Some elements (columns, for instance) share their parent's id, so each card contributes its distinct ids once.
+    size_t ParseCards(const std::vector<std::string>& cards, std::vector<unsigned int>& ids)
+    {
+        size_t parsedCount = 0;
+        for (const auto& card : cards)
+        {
+            try
+            {
+                const auto parseResult = AdaptiveCard::DeserializeFromString(card, "1.6");
+
+                std::vector<unsigned int> cardIds;
+                CollectInternalIds(parseResult->GetAdaptiveCard(), cardIds);
+                std::sort(cardIds.begin(), cardIds.end());
+                cardIds.erase(std::unique(cardIds.begin(), cardIds.end()), cardIds.end());
+
+                ids.insert(ids.end(), cardIds.begin(), cardIds.end());
+                ++parsedCount;
+            }
+            catch (const std::exception&)
+            {
+                // some samples are intentionally invalid. the sequential pass tells us how many to expect.
+            }
+        }
+        return parsedCount;
+    }
+
+    // Everything a parse of card produces: the serialized card and its warnings, or the error it failed with
+    std::string DescribeParse(const std::string& card, unsigned int maxParseThreads)
+    {
+        ParseContext context;
+        context.SetMaxParseThreads(maxParseThreads);
+
+        std::string description;
+        try
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(card, "1.6", context);
+            description = parseResult->GetAdaptiveCard()->Serialize();
+            for (const auto& warning : parseResult->GetWarnings())
+            {
+                description += "\nwarning " + std::to_string(static_cast<int>(warning->GetStatusCode())) + ": " + warning->GetReason();
+            }
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            description = "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + ": " + e.GetReason();
+        }
+        catch (const std::exception& e)
+        {
+            description = std::string("error: ") + e.what();
+        }
+        return description;
+    }
+
+    // A card with a body of itemCount TextBlocks, each with an id of its own and no text to warn about. The ids of the
+    // items at duplicateIndex (if any) and the one after it are the same.
+    std::string MakeLongBodyCard(size_t itemCount, std::optional<size_t> duplicateIndex = std::nullopt)
+    {
+        std::string body;
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            const size_t idIndex = (duplicateIndex.has_value() && i == duplicateIndex.value() + 1) ? i - 1 : i;
+            body += (i == 0 ? "" : ",");
+            body += R"({ "type": "TextBlock", "text": "", "id": "item)" + std::to_string(idIndex) + R"(" })";
+        }
+        return R"({ "type": "AdaptiveCard", "version": "1.5", "body": [)" + body + "] }";
+    }
+
+    TEST_CLASS(ConcurrentParsingTest)
+    {
+    public:
+        TEST_METHOD(ConcurrentParsesHaveUniqueInternalIds)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            std::vector<unsigned int> sequentialIds;
+            const size_t expectedParsedCount = ParseCards(cards, sequentialIds);
+            Assert::IsTrue(expectedParsedCount > 0);
+
+            constexpr size_t threadCount = 8;
+            constexpr size_t iterationsPerThread = 4;
+            std::vector<std::vector<unsigned int>> idsPerThread(threadCount);
+            std::vector<size_t> parsedCountPerThread(threadCount);
+
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (size_t iteration = 0; iteration < iterationsPerThread; ++iteration)
+                    {
+                        parsedCountPerThread[i] += ParseCards(cards, idsPerThread[i]);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            // a racing id allocator would surface either as spurious parse failures or as two cards sharing an id
+            std::vector<unsigned int> allIds;
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                Assert::AreEqual(expectedParsedCount * iterationsPerThread, parsedCountPerThread[i]);
+                allIds.insert(allIds.end(), idsPerThread[i].begin(), idsPerThread[i].end());
+            }
+
+            std::sort(allIds.begin(), allIds.end());
+            Assert::IsTrue(std::find(allIds.begin(), allIds.end(), InternalId::Invalid) == allIds.end());
+            Assert::IsTrue(std::adjacent_find(allIds.begin(), allIds.end()) == allIds.end());
+        }
+
+        TEST_METHOD(ParallelParsesMatchSequentialParses)
+        {
+            ParseContext context;
+            Assert::AreEqual(1u, context.GetMaxParseThreads());
+            context.SetMaxParseThreads(0);
+            Assert::AreEqual(1u, context.GetMaxParseThreads());
+
+            for (const auto& card : LoadSampleCards())
+            {
+                const auto sequential = DescribeParse(card, 1);
+                Assert::AreEqual(sequential, DescribeParse(card, 3));
+                Assert::AreEqual(sequential, DescribeParse(card, 64));
+            }
+        }
+
+        TEST_METHOD(ParallelParsesMatchSequentialParsesOfLongBodies)
+        {
+            const auto card = MakeLongBodyCard(100);
+            const auto sequential = DescribeParse(card, 1);
+            Assert::AreNotEqual(std::string::npos, sequential.find("warning"));
+            Assert::AreEqual(sequential, DescribeParse(card, 7));
+
+            // the first collision is reported, whichever runs the two elements end up in
+            for (const size_t duplicateIndex : {0, 13, 14, 49, 98})
+            {
+                const auto collidingCard = MakeLongBodyCard(100, duplicateIndex);
+                const auto sequentialError = DescribeParse(collidingCard, 1);
+                Assert::AreEqual(size_t{0}, sequentialError.find("error"));
+                Assert::AreEqual(sequentialError, DescribeParse(collidingCard, 7));
+            }
+        }
+
+        TEST_METHOD(ParallelParsesCarryStateBetweenElements)
+        {
+            // The ShowCard's card leaves its emphasis style behind as the parental style of the containers after it,
+            // so they don't get padding. The runs those containers are parsed in in parallel have to pick that up.
+            std::string body = R"({
+                "type": "ActionSet",
+                "actions": [ { "type": "Action.ShowCard", "title": "Show", "card": { "type": "AdaptiveCard", "style": "emphasis", "body": [] } } ]
+            })";
+            for (size_t i = 0; i < 20; ++i)
+            {
+                body += R"(, { "type": "Container", "style": "emphasis", "bleed": true, "items": [ { "type": "Container", "style": "good", "bleed": true, "items": [] } ] })";
+            }
+            const std::string card = R"({ "type": "AdaptiveCard", "version": "1.5", "body": [)" + body + "] }";
+
+            const auto parse = [&card](unsigned int maxParseThreads) {
+                ParseContext context;
+                context.SetMaxParseThreads(maxParseThreads);
+                return AdaptiveCard::DeserializeFromString(card, "1.5", context)->GetAdaptiveCard()->GetBody();
+            };
+            const auto sequentialBody = parse(1);
+            const auto parallelBody = parse(4);
+
+            for (size_t i = 1; i < sequentialBody.size(); ++i)
+            {
+                const auto sequentialContainer = std::static_pointer_cast<Container>(sequentialBody[i]);
+                const auto parallelContainer = std::static_pointer_cast<Container>(parallelBody[i]);
+                Assert::IsFalse(sequentialContainer->GetPadding());
+                Assert::IsFalse(parallelContainer->GetPadding());
+
+                const auto sequentialItem = std::static_pointer_cast<Container>(sequentialContainer->GetItems()[0]);
+                const auto parallelItem = std::static_pointer_cast<Container>(parallelContainer->GetItems()[0]);
+                Assert::IsTrue(sequentialItem->GetPadding() == parallelItem->GetPadding());
+                Assert::IsTrue(sequentialItem->GetBleedDirection() == parallelItem->GetBleedDirection());
+            }
+        }
+    };
+}
@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "DateTimePreparser.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // The tests in this file don't depend on the local time zone. The ones that check what dates and times convert
+    // to are in DateAndTimeUnitTest.cpp.
+    bool IsSliceOf(std::string_view slice, const std::string& str)
+    {
+        return slice.data() >= str.data() && slice.data() + slice.size() <= str.data() + str.size();
+    }
+
+    TEST_CLASS(DateTimeTokenizerTest)
+    {
+    public:
+        TEST_METHOD(TextWithoutExpressionsIsOneSlice)
+        {
+            const std::string text = "No dates {{ in here }}";
+            DateTimeTokenBuffer buffer;
+            DateTimePreparser::Tokenize(text, buffer);
+
+            Assert::AreEqual(size_t{1}, buffer.GetTokens().size());
+            Assert::IsTrue(buffer.GetTokens()[0].text.data() == text.data());
+            Assert::AreEqual(text, std::string{buffer.GetTokens()[0].text});
+            Assert::IsTrue(buffer.GetTokens()[0].format == DateTimePreparsedTokenFormat::RegularString);
+            Assert::IsFalse(buffer.HasDateTokens());
+        }
+
+        TEST_METHOD(EmptyTextHasNoTokens)
+        {
+            DateTimeTokenBuffer buffer;
+            DateTimePreparser::Tokenize("", buffer);
+
+            Assert::IsTrue(buffer.GetTokens().empty());
+            Assert::IsFalse(buffer.HasDateTokens());
+        }
+
+        TEST_METHOD(DatesAreSlicesOfTheText)
+        {
+            const std::string text = "From {{{DATE(2017-10-27T12:00:00Z, SHORT)}} to {{DATE(2017-11-03T12:00:00-07:00,LONG)}}.";
+            DateTimeTokenBuffer buffer;
+            DateTimePreparser::Tokenize(text, buffer);
+
+            const auto& tokens = buffer.GetTokens();
+            Assert::AreEqual(size_t{5}, tokens.size());
+            Assert::AreEqual("From {"s, std::string{tokens[0].text});
+            Assert::AreEqual("{{DATE(2017-10-27T12:00:00Z, SHORT)}}"s, std::string{tokens[1].text});
+            Assert::IsTrue(tokens[1].format == DateTimePreparsedTokenFormat::DateShort);
+            Assert::AreEqual(" to "s, std::string{tokens[2].text});
+            Assert::AreEqual("{{DATE(2017-11-03T12:00:00-07:00,LONG)}}"s, std::string{tokens[3].text});
+            Assert::IsTrue(tokens[3].format == DateTimePreparsedTokenFormat::DateLong);
+            Assert::AreEqual("."s, std::string{tokens[4].text});
+            Assert::IsTrue(buffer.HasDateTokens());
+
+            for (const auto& token : tokens)
+            {
+                Assert::IsTrue(IsSliceOf(token.text, text));
+            }
+        }
+
+        TEST_METHOD(InvalidExpressionsStayText)
+        {
+            const std::vector<std::string> texts = {
+                "{{DATE(2017-13-27T12:00:00Z)}}",
+                "{{DATE(2017-02-30T12:00:00Z)}}",
+                "{{DATE(2017-10-27T25:00:00Z)}}",
+                "{{TIME(2017-10-27T12:00:00Z, SHORT)}}",
+                "{{DATE(2017-10-27T12:00:00Z, short)}}",
+                "{{DATE(2017-10-27T12:00:00)}}",
+                "{{DATE(2017-10-27 12:00:00Z)}}",
+                "{{DATE(17-10-27T12:00:00Z)}}",
+                "{{date(2017-10-27T12:00:00Z)}}",
+                "{{DATE(2017-10-27T12:00:00Z)}"};
+
+            DateTimeTokenBuffer buffer;
+            for (const auto& text : texts)
+            {
+                DateTimePreparser::Tokenize(text, buffer);
+                Assert::AreEqual(size_t{1}, buffer.GetTokens().size());
+                Assert::AreEqual(text, std::string{buffer.GetTokens()[0].text});
+                Assert::IsTrue(buffer.GetTokens()[0].format == DateTimePreparsedTokenFormat::RegularString);
+                Assert::IsFalse(buffer.HasDateTokens());
+            }
+        }
+
+        TEST_METHOD(TimesAreFormattedIntoTheBuffer)
+        {
+            const std::string text = "{{TIME(2017-10-27T12:00:00Z)}} and {{TIME(2017-10-27T18:30:00+01:00)}}";
+            DateTimeTokenBuffer buffer;
+            DateTimePreparser::Tokenize(text, buffer);
+
+            const auto& tokens = buffer.GetTokens();
+            Assert::AreEqual(size_t{3}, tokens.size());
+            Assert::IsFalse(IsSliceOf(tokens[0].text, text));
+            Assert::AreEqual(" and "s, std::string{tokens[1].text});
+            Assert::IsFalse(IsSliceOf(tokens[2].text, text));
+            Assert::IsFalse(buffer.HasDateTokens());
+
+            for (const auto& token : tokens)
+            {
+                Assert::IsTrue(token.format == DateTimePreparsedTokenFormat::RegularString);
+            }
+        }
+
+        TEST_METHOD(BufferIsReset)
+        {
+            DateTimeTokenBuffer buffer;
+            DateTimePreparser::Tokenize("{{DATE(2017-10-27T12:00:00Z)}} at {{TIME(2017-10-27T12:00:00Z)}}", buffer);
+            Assert::AreEqual(size_t{3}, buffer.GetTokens().size());
+            Assert::IsTrue(buffer.HasDateTokens());
+
+            DateTimePreparser::Tokenize("plain", buffer);
+            Assert::AreEqual(size_t{1}, buffer.GetTokens().size());
+            Assert::AreEqual("plain"s, std::string{buffer.GetTokens()[0].text});
+            Assert::IsFalse(buffer.HasDateTokens());
+
+            buffer.Clear();
+            Assert::IsTrue(buffer.GetTokens().empty());
+        }
+
+        TEST_METHOD(PreparserMatchesTokenize)
+        {
+            const std::vector<std::string> texts = {
+                "",
+                "plain",
+                "{{DATE(2017-10-27T12:00:00Z, COMPACT)}}",
+                "Meet {{DATE(2017-10-27T12:00:00+05:30, SHORT)}} at {{TIME(2017-10-27T12:00:00+05:30)}}!",
+                "{{TIME(2017-10-27T12:00:00Z, LONG)}} {{DATE(2017-10-27T12:00:00Z)}}{{DATE(2017-10-27T12:00:00Z)}}"};
+
+            DateTimeTokenBuffer buffer;
+            for (const auto& text : texts)
+            {
+                TextBlock textBlock;
+                textBlock.SetText(text);
+                textBlock.GetTextForDateParsing(buffer);
+                const DateTimePreparser preparser = textBlock.GetTextForDateParsing();
+
+                const auto& tokens = buffer.GetTokens();
+                const auto& preparsedTokens = preparser.GetTextTokens();
+                Assert::AreEqual(preparsedTokens.size(), tokens.size());
+                Assert::AreEqual(preparser.HasDateTokens(), buffer.HasDateTokens());
+                for (size_t i = 0; i < tokens.size(); ++i)
+                {
+                    Assert::AreEqual(preparsedTokens[i]->GetText(), std::string{tokens[i].text});
+                    Assert::IsTrue(preparsedTokens[i]->GetFormat() == tokens[i].format);
+                    Assert::AreEqual(preparsedTokens[i]->GetYear(), tokens[i].date.tm_year + 1900);
+                    Assert::AreEqual(preparsedTokens[i]->GetMonth(), tokens[i].date.tm_mon);
+                    Assert::AreEqual(preparsedTokens[i]->GetDay(), tokens[i].date.tm_mday);
+                }
+            }
+        }
+
+        TEST_METHOD(ParseSimpleTime)
+        {
+            unsigned int hours = 0, minutes = 0;
+            Assert::IsTrue(DateTimePreparser::TryParseSimpleTime("09:45", hours, minutes));
+            Assert::AreEqual(9u, hours);
+            Assert::AreEqual(45u, minutes);
+
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleTime("9:45", hours, minutes));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleTime("09:45 ", hours, minutes));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleTime("25:00", hours, minutes));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleTime("", hours, minutes));
+            Assert::AreEqual(9u, hours);
+        }
+
+        TEST_METHOD(ParseSimpleDate)
+        {
+            unsigned int year = 0, month = 0, day = 0;
+            Assert::IsTrue(DateTimePreparser::TryParseSimpleDate("2020-02-29", year, month, day));
+            Assert::AreEqual(2020u, year);
+            Assert::AreEqual(2u, month);
+            Assert::AreEqual(29u, day);
+
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleDate("2021-02-29", year, month, day));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleDate("2020-2-29", year, month, day));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleDate("2020-02-29T", year, month, day));
+            Assert::IsFalse(DateTimePreparser::TryParseSimpleDate("", year, month, day));
+            Assert::AreEqual(2020u, year);
+        }
+    };
+}
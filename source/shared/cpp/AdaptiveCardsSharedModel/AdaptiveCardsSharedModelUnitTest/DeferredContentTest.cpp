@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "Container.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::vector<std::string> LoadSampleCards();
+
+    // The card a parse gives, with its deferred content parsed, or the error it throws along the way
+    std::string DescribeCard(const std::string& json, bool deferNestedContent)
+    {
+        try
+        {
+            ParseContext context;
+            context.SetDeferNestedContent(deferNestedContent);
+            return AdaptiveCard::DeserializeFromString(json, "1.6", context)->GetAdaptiveCard()->Serialize();
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            return "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + " " + e.GetReason();
+        }
+    }
+
+    void AssertDeferredMatches(const std::string& json)
+    {
+        Assert::AreEqual(DescribeCard(json, false), DescribeCard(json, true));
+    }
+
+    std::shared_ptr<ShowCardAction> GetShowCardAction(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        return std::static_pointer_cast<ShowCardAction>(card->GetActions().at(0));
+    }
+
+    TEST_CLASS(DeferredContentTest)
+    {
+    public:
+        TEST_METHOD(MatchesRegularPathOnSamples)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            for (const auto& card : cards)
+            {
+                AssertDeferredMatches(card);
+            }
+        }
+
+        TEST_METHOD(DetectsIdCollisions)
+        {
+            // with an element of the card
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "TextBlock", "text": "body", "id": "duplicate" } ],
+                "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                    "body": [ { "type": "Container", "items": [ { "type": "Input.Text", "id": "duplicate" } ] } ] } } ]
+            })");
+
+            // between two show cards, deep in a table
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "actions": [
+                    { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard", "body": [ { "type": "Table", "rows": [
+                        { "cells": [ { "items": [ { "type": "TextBlock", "text": "cell", "id": "cell" } ] } ] } ] } ] } },
+                    { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                        "actions": [ { "type": "Action.Submit", "id": "cell" } ] } }
+                ]
+            })");
+
+            // fallback content may share its parent's id, but two fallbacks may not share one
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "TextBlock", "text": "first", "id": "duplicate",
+                    "fallback": { "type": "TextBlock", "id": "duplicate", "text": "fallback",
+                        "fallback": { "type": "TextBlock", "id": "duplicate", "text": "fallback of fallback" } } } ]
+            })");
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [
+                    { "type": "TextBlock", "text": "first", "fallback": { "type": "TextBlock", "id": "duplicate", "text": "one" } },
+                    { "type": "TextBlock", "text": "second", "fallback": { "type": "TextBlock", "id": "duplicate", "text": "two" } }
+                ]
+            })");
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "Container", "id": "A", "items": [
+                    { "type": "Container", "id": "B", "fallback": { "type": "Container", "id": "B", "items": [
+                        { "type": "TextBlock", "text": "fallback", "id": "A" } ] },
+                      "items": [ { "type": "TextBlock", "text": "B" } ] } ] } ]
+            })");
+
+            // an id only in data isn't an element's
+            AssertDeferredMatches(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "TextBlock", "text": "body", "id": "duplicate" } ],
+                "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                    "actions": [ { "type": "Action.Submit", "data": { "type": "TextBlock", "id": "duplicate" } } ] } } ]
+            })");
+
+            ParseContext context;
+            context.SetDeferNestedContent(true);
+            Assert::ExpectException<AdaptiveCardParseException>([&context]() {
+                AdaptiveCard::DeserializeFromString(R"({
+                    "type": "AdaptiveCard", "version": "1.5",
+                    "body": [ { "type": "TextBlock", "text": "body", "id": "duplicate" } ],
+                    "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                        "body": [ { "type": "TextBlock", "text": "card", "id": "duplicate" } ] } } ]
+                })", "1.5", context);
+            });
+        }
+
+        TEST_METHOD(ParsesOnFirstAccess)
+        {
+            // neither the card nor the fallback content is a valid one, which only shows when they're parsed
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "TextBlock", "text": "text", "fallback": { "type": "Container", "items": "none" } } ],
+                "actions": [ { "type": "Action.ShowCard", "title": "Show", "card": { "type": "Container" } } ]
+            })";
+            Assert::ExpectException<AdaptiveCardParseException>([&cardJson]() { AdaptiveCard::DeserializeFromString(cardJson, "1.5"); });
+
+            ParseContext context;
+            context.SetDeferNestedContent(true);
+            const auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.5", context)->GetAdaptiveCard();
+
+            const auto showCardAction = GetShowCardAction(card);
+            Assert::AreEqual("Show"s, showCardAction->GetTitle());
+            Assert::ExpectException<AdaptiveCardParseException>([&showCardAction]() { showCardAction->GetCard(); });
+
+            const auto textBlock = card->GetBody()[0];
+            Assert::IsTrue(textBlock->GetFallbackType() == FallbackType::Content);
+            Assert::ExpectException<AdaptiveCardParseException>([&textBlock]() { textBlock->GetFallbackContent(); });
+        }
+
+        TEST_METHOD(ParsesAsTheParentWould)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard", "version": "1.5", "lang": "de",
+                "body": [ { "type": "Container", "style": "emphasis", "items": [
+                    { "type": "TextBlock", "text": "text", "fallback": { "type": "Container", "style": "emphasis", "bleed": true, "items": [] } },
+                    { "type": "ActionSet", "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                        "body": [ { "type": "TextBlock", "text": "shown" } ] } } ] }
+                ] } ],
+                "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard" } } ]
+            })";
+
+            ParseContext context;
+            context.SetDeferNestedContent(true);
+            const auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.5", context)->GetAdaptiveCard();
+
+            // a show card without a version takes the version of the card it's in, once it's parsed
+            const auto showCardAction = GetShowCardAction(card);
+            Assert::AreEqual("1.5"s, showCardAction->GetCard()->GetVersion());
+            Assert::IsTrue(showCardAction->GetCard() == showCardAction->GetCard());
+
+            const auto container = std::static_pointer_cast<Container>(card->GetBody()[0]);
+            const auto actionSet = std::static_pointer_cast<ActionSet>(container->GetItems()[1]);
+            const auto nestedCard = std::static_pointer_cast<ShowCardAction>(actionSet->GetActions()[0])->GetCard();
+            Assert::AreEqual("de"s, std::static_pointer_cast<TextBlock>(nestedCard->GetBody()[0])->GetLanguage());
+
+            AssertDeferredMatches(cardJson);
+        }
+    };
+}
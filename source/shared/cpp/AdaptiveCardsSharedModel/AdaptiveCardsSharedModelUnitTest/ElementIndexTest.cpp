@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ElementIndex.h"
+#include "FallbackResolution.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_indexedCard = R"({
+        "type": "AdaptiveCard", "version": "1.5",
+        "body": [
+            { "type": "Container", "id": "container", "items": [
+                { "type": "ColumnSet", "columns": [ { "type": "Column", "id": "column", "items": [
+                    { "type": "TextBlock", "id": "text", "text": "text", "isVisible": false,
+                      "fallback": { "type": "TextBlock", "id": "fallbackOnly", "text": "fallback" } } ] } ] } ] },
+            { "type": "Input.Text", "id": "input", "inlineAction": { "type": "Action.Submit", "id": "inlineSubmit" } }
+        ],
+        "actions": [
+            { "type": "Action.ToggleVisibility", "id": "toggle", "targetElements": [ "text", { "elementId": "missing" } ] },
+            { "type": "Action.ShowCard", "id": "showCard", "card": { "type": "AdaptiveCard", "body": [
+                { "type": "Container", "items": [ { "type": "Input.Number", "id": "shownInput" } ] } ] } }
+        ]
+    })";
+
+    std::vector<std::string> GetIds(const std::vector<std::shared_ptr<BaseElement>>& elements)
+    {
+        std::vector<std::string> ids;
+        for (const auto& element : elements)
+        {
+            ids.push_back(element->GetId());
+        }
+        return ids;
+    }
+
+    TEST_CLASS(ElementIndexTest)
+    {
+    public:
+        TEST_METHOD(FindsElementsAndActions)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_indexedCard, "1.5")->GetAdaptiveCard();
+            const auto index = card->GetElementIndex();
+            Assert::IsTrue(index == card->GetElementIndex());
+
+            const auto container = std::static_pointer_cast<Container>(card->GetBody()[0]);
+            Assert::IsTrue(index->GetCardElement("container") == container);
+            Assert::IsTrue(index->GetCardElement("column") ==
+                           std::static_pointer_cast<ColumnSet>(container->GetItems()[0])->GetColumns()[0]);
+            Assert::IsTrue(index->GetAction("toggle") == card->GetActions()[0]);
+            Assert::IsTrue(index->GetAction("inlineSubmit") != nullptr);
+            Assert::AreEqual("shownInput"s, index->GetCardElement("shownInput")->GetId());
+
+            // elements and actions are looked up by what they are
+            Assert::IsTrue(index->GetAction("container") == nullptr);
+            Assert::IsTrue(index->GetCardElement("toggle") == nullptr);
+
+            // fallback content isn't indexed
+            Assert::IsTrue(index->GetElement("fallbackOnly") == nullptr);
+            Assert::IsTrue(index->GetElement("missing") == nullptr);
+            Assert::AreEqual(size_t{8}, index->GetIdCount());
+        }
+
+        TEST_METHOD(FindsAncestors)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_indexedCard, "1.5")->GetAdaptiveCard();
+            const auto index = card->GetElementIndex();
+
+            const auto textAncestors = index->GetAncestors("text");
+            Assert::AreEqual(size_t{3}, textAncestors.size());
+            Assert::IsTrue(textAncestors[0] == card->GetBody()[0]);
+            Assert::IsTrue(std::vector<std::string>{"container", "", "column"} == GetIds(textAncestors));
+
+            Assert::IsTrue(std::vector<std::string>{"showCard", ""} == GetIds(index->GetAncestors("shownInput")));
+            Assert::IsTrue(std::vector<std::string>{"input"} == GetIds(index->GetAncestors("inlineSubmit")));
+            Assert::IsTrue(index->GetAncestors("container").empty());
+            Assert::IsTrue(index->GetAncestors("missing").empty());
+        }
+
+        TEST_METHOD(FindsToggleVisibilityTargets)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_indexedCard, "1.5")->GetAdaptiveCard();
+            const auto index = card->GetElementIndex();
+
+            const auto& targets = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0])->GetTargetElements();
+            Assert::AreEqual(size_t{2}, targets.size());
+
+            const auto target = index->GetTargetElement(*targets[0]);
+            Assert::IsTrue(target != nullptr);
+            Assert::AreEqual("text"s, target->GetId());
+            Assert::IsFalse(target->GetIsVisible());
+            Assert::IsTrue(index->GetTargetElement(*targets[1]) == nullptr);
+        }
+
+        TEST_METHOD(IndexesCopiesOnTheirOwn)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_indexedCard, "1.5")->GetAdaptiveCard();
+            Assert::IsTrue(card->GetElementIndex()->GetElement("text") != nullptr);
+
+            // the copies ResolveFallback makes have the text block's fallback content in its place, as it needs a
+            // feature the host doesn't have
+            card->GetElementIndex()->GetCardElement("text")->GetRequirements().emplace("feature", SemanticVersion("1.0"));
+            const auto resolved = ResolveFallback(card, FeatureRegistration(), ElementParserRegistration(), ActionParserRegistration())
+                                      ->GetAdaptiveCard();
+            Assert::IsTrue(resolved != card);
+            Assert::IsTrue(resolved->GetElementIndex()->GetElement("fallbackOnly") != nullptr);
+            Assert::IsTrue(resolved->GetElementIndex()->GetElement("text") == nullptr);
+            Assert::IsTrue(resolved->GetElementIndex()->GetElement("shownInput") == card->GetElementIndex()->GetElement("shownInput"));
+            Assert::IsTrue(card->GetElementIndex()->GetElement("text") != nullptr);
+        }
+
+        TEST_METHOD(IndexesDeferredCardsWithoutParsingThem)
+        {
+            ParseContext context;
+            context.SetDeferNestedContent(true);
+            const auto card = AdaptiveCard::DeserializeFromString(c_indexedCard, "1.5", context)->GetAdaptiveCard();
+            const auto showCardAction = std::static_pointer_cast<ShowCardAction>(card->GetActions()[1]);
+
+            const auto index = card->GetElementIndex();
+            Assert::AreEqual(size_t{8}, index->GetIdCount());
+            Assert::IsTrue(index->GetCardElement("container") != nullptr);
+            Assert::IsTrue(index->GetElement("missing") == nullptr);
+            Assert::IsTrue(showCardAction->GetDeferredCard()->GetJson() != nullptr);
+
+            // looking up an id in the card parses it
+            Assert::IsTrue(std::vector<std::string>{"showCard", ""} == GetIds(index->GetAncestors("shownInput")));
+            Assert::IsTrue(showCardAction->GetDeferredCard()->GetJson() == nullptr);
+            Assert::IsTrue(index->GetCardElement("shownInput") ==
+                           std::static_pointer_cast<Container>(showCardAction->GetCard()->GetBody()[0])->GetItems()[0]);
+            Assert::IsTrue(index->GetAction("shownInput") == nullptr);
+        }
+    };
+}
@@ -12,12 +12,14 @@ using namespace std::string_literals;
 #define ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
         Assert::AreEqual(ENUMNAME##ToString(VALIDVALUE), VALIDSTRING); \
         Assert::IsTrue(ENUMNAME##FromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsTrue(ENUMNAME##TryFromString(VALIDSTRING) == VALIDVALUE); \
 
 #define ENUM_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
     ENUM_TEST_START(ENUMNAME)                                           \
     {                                                                   \
         ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING);    \
         Assert::ExpectException<std::out_of_range>([]() { ENUMNAME##FromString("This is invalid."); }); \
+        Assert::IsFalse(ENUMNAME##TryFromString("This is invalid.").has_value()); \
     }                                                                   \
 
 #define ENUM_TEST_WITH_REVERSE_MAP(ENUMNAME, VALIDVALUE, VALIDSTRING, ...) \
@@ -25,10 +27,12 @@ using namespace std::string_literals;
     {                                                                   \
         ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING);    \
         Assert::ExpectException<std::out_of_range>([]() { ENUMNAME##FromString("This is invalid."); }); \
+        Assert::IsFalse(ENUMNAME##TryFromString("This is invalid.").has_value()); \
         std::unordered_map<std::string, ENUMNAME> reverseMap __VA_ARGS__; \
         for (const auto& key : reverseMap)                              \
         {                                                               \
             Assert::IsTrue(ENUMNAME##FromString(key.first) == key.second); \
+            Assert::IsTrue(ENUMNAME##TryFromString(key.first) == key.second); \
         }                                                               \
     }                                                                   \
 
@@ -58,5 +62,30 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(TryFromStringIgnoresCase)
+        {
+            Assert::IsTrue(AdaptiveCardSchemaKeyTryFromString("BACKGROUNDIMAGE") == AdaptiveCardSchemaKey::BackgroundImage);
+            Assert::IsTrue(CardElementTypeTryFromString("input.choiceset") == CardElementType::ChoiceSetInput);
+            Assert::IsTrue(ImageStyleTryFromString("Normal") == ImageStyle::Default);
+
+            // same characters in a different order, and prefixes of valid strings
+            Assert::IsFalse(ContainerStyleTryFromString("Doog").has_value());
+            Assert::IsFalse(ContainerStyleTryFromString("Goo").has_value());
+            Assert::IsFalse(ContainerStyleTryFromString("").has_value());
+        }
+
+        TEST_METHOD(StringToEnumTableIsConstexpr)
+        {
+            constexpr EnumHelpers::EnumEntry<Mode> entries[] = {{Mode::Primary, "primary"}, {Mode::Secondary, "secondary"}};
+            constexpr EnumHelpers::EnumAlias<Mode> aliases[] = {{"main", Mode::Primary}, {"PRIMARY", Mode::Secondary}};
+            constexpr auto table = EnumHelpers::MakeStringToEnumTable(entries, aliases);
+
+            // aliases come first, so the duplicate "PRIMARY" alias wins over the "primary" entry
+            static_assert(table.TryFind("Primary") == Mode::Secondary);
+            static_assert(table.TryFind("MAIN") == Mode::Primary);
+            static_assert(table.TryFind("secondary") == Mode::Secondary);
+            static_assert(!table.TryFind("tertiary").has_value());
+        }
     };
 }
@@ -17,12 +17,84 @@
 #include "ToggleInput.h"
 #include "TextBlock.h"
 #include "Media.h"
+#include "Util.h"
+#include <regex>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
+    // ParseSizeForPixelSize as it was implemented with std::regex, which the scanner has to agree with
+    std::optional<int> RegexParseSizeForPixelSize(const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+    {
+        const bool shouldParse = [&sizeString]() {
+            if (sizeString.empty())
+            {
+                return false;
+            }
+
+            if (sizeString.front() == '-' || sizeString.front() == '.')
+            {
+                return true;
+            }
+
+            int hasDigit = 0;
+            for (const char ch : sizeString)
+            {
+                hasDigit |= isdigit(ch);
+                if (hasDigit && (isalpha(ch) || '.' == ch))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }();
+
+        if (!shouldParse)
+        {
+            return std::nullopt;
+        }
+
+        static const std::regex pattern("^([1-9]+\\d*)(\\.\\d+)?(px)$");
+        std::smatch matches;
+        if (!std::regex_search(sizeString, matches, pattern))
+        {
+            warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidDimensionSpecified,
+                "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received " + sizeString));
+            return std::nullopt;
+        }
+
+        try
+        {
+            return std::stoi(matches[0]);
+        }
+        catch (const std::out_of_range&)
+        {
+            warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidDimensionSpecified, "out of range: " + sizeString));
+            return std::nullopt;
+        }
+    }
+
+    void AssertSameAsRegex(const std::string& sizeString)
+    {
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> expectedWarnings;
+        const auto expected = RegexParseSizeForPixelSize(sizeString, expectedWarnings);
+
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> actualWarnings;
+        const auto actual = ParseSizeForPixelSize(sizeString, &actualWarnings);
+
+        const std::wstring message = L"size string: " + std::wstring(sizeString.begin(), sizeString.end());
+        Assert::IsTrue(expected == actual, message.c_str());
+        Assert::AreEqual(expectedWarnings.size(), actualWarnings.size(), message.c_str());
+        for (size_t i = 0; i < expectedWarnings.size(); ++i)
+        {
+            Assert::AreEqual(expectedWarnings[i]->GetReason(), actualWarnings[i]->GetReason());
+        }
+    }
+
     TEST_CLASS(ExplicitDimensionTest)
     {
     public:
@@ -601,5 +673,37 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<std::string>("20.5px", column->GetWidth());
             Assert::AreEqual<bool>(column->GetPixelWidth() == 20, true);
         }
+
+        TEST_METHOD(ScannerMatchesRegex)
+        {
+            // every string of up to 4 characters over the characters that matter to the pattern
+            constexpr std::string_view alphabet{"019.px-a "};
+            std::vector<std::string> sizeStrings{""};
+            for (size_t begin = 0, length = 0; length < 4; ++length)
+            {
+                const size_t end = sizeStrings.size();
+                for (size_t i = begin; i < end; ++i)
+                {
+                    for (const char c : alphabet)
+                    {
+                        sizeStrings.push_back(sizeStrings[i] + c);
+                    }
+                }
+                begin = end;
+            }
+
+            for (const auto& sizeString : sizeStrings)
+            {
+                AssertSameAsRegex(sizeString);
+            }
+
+            // around the limits of int, and other shapes that are too long to enumerate
+            for (const auto& sizeString : {"2147483647px", "2147483648px", "2147483647.99px", "99999999999999999999px",
+                                           "0000000001px", "10.px", "10..5px", "10.5.5px", "10PX", "10px ", " 10px", "1e3px",
+                                           "10.5pxpx"})
+            {
+                AssertSameAsRegex(sizeString);
+            }
+        }
     };
 }
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FallbackResolution.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::shared_ptr<ParseResult> ResolveFallbackFor(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        FeatureRegistration featureRegistration;
+        featureRegistration.AddFeature("feature", "1.0");
+        return ResolveFallback(card, featureRegistration, ElementParserRegistration(), ActionParserRegistration());
+    }
+
+    std::string GetText(const std::shared_ptr<BaseCardElement>& element)
+    {
+        return std::static_pointer_cast<TextBlock>(element)->GetText();
+    }
+
+    TEST_CLASS(FallbackResolutionTest)
+    {
+    public:
+        TEST_METHOD(ReplacesAndDropsElements)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [
+                    { "type": "TextBlock", "text": "supported", "requires": { "feature": "1.0" } },
+                    { "type": "TextBlock", "text": "too new", "requires": { "feature": "2.0" },
+                      "fallback": { "type": "Graph", "fallback": { "type": "TextBlock", "text": "fallback" } } },
+                    { "type": "TextBlock", "text": "dropped", "requires": { "other": "1.0" }, "fallback": "drop" },
+                    { "type": "Graph" },
+                    { "type": "Container", "items": [ { "type": "TextBlock", "text": "unchanged" } ] }
+                ]
+            })", "1.5")->GetAdaptiveCard();
+
+            const auto parseResult = ResolveFallbackFor(card);
+            const auto resolved = parseResult->GetAdaptiveCard();
+            Assert::IsTrue(resolved != card);
+
+            const auto& body = resolved->GetBody();
+            Assert::AreEqual(size_t{3}, body.size());
+            Assert::IsTrue(body[0] == card->GetBody()[0]);
+            Assert::AreEqual("fallback"s, GetText(body[1]));
+            Assert::IsTrue(body[2] == card->GetBody()[4]);
+
+            // performing fallback twice for the second, then dropping the third and the fourth
+            Assert::AreEqual(size_t{4}, parseResult->GetWarnings().size());
+
+            // the card that was resolved is left as it was
+            Assert::AreEqual(size_t{5}, card->GetBody().size());
+            Assert::AreEqual("too new"s, GetText(card->GetBody()[1]));
+        }
+
+        TEST_METHOD(FallsBackToAncestor)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [
+                    { "type": "Container", "fallback": { "type": "TextBlock", "text": "container fallback" }, "items": [
+                        { "type": "ColumnSet", "columns": [ { "type": "Column", "items": [
+                            { "type": "TextBlock", "text": "text" },
+                            { "type": "TextBlock", "text": "too new", "requires": { "feature": "2.0" } } ] } ] } ] },
+                    { "type": "Container", "items": [
+                        { "type": "TextBlock", "text": "kept" },
+                        { "type": "Graph" } ] },
+                    { "type": "Container", "fallback": "drop", "items": [ { "type": "Graph" } ] }
+                ]
+            })", "1.5")->GetAdaptiveCard();
+
+            const auto resolved = ResolveFallbackFor(card)->GetAdaptiveCard();
+            const auto& body = resolved->GetBody();
+            Assert::AreEqual(size_t{2}, body.size());
+
+            // an element without fallback falls back to its nearest ancestor with fallback
+            Assert::AreEqual("container fallback"s, GetText(body[0]));
+
+            // and is dropped when it has none
+            const auto container = std::static_pointer_cast<Container>(body[1]);
+            Assert::IsTrue(container != card->GetBody()[1]);
+            Assert::AreEqual(size_t{1}, container->GetItems().size());
+            Assert::AreEqual("kept"s, GetText(container->GetItems()[0]));
+            Assert::IsTrue(container->GetInternalId() == card->GetBody()[1]->GetInternalId());
+            Assert::AreEqual(size_t{2}, std::static_pointer_cast<Container>(card->GetBody()[1])->GetItems().size());
+        }
+
+        TEST_METHOD(ResolvesActionsAndShowCards)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [
+                    { "type": "ActionSet", "actions": [
+                        { "type": "Action.Graph", "fallback": { "type": "Action.Submit", "title": "submit" } } ] },
+                    { "type": "Container", "selectAction": { "type": "Action.Submit", "requires": { "feature": "2.0" } },
+                      "items": [ { "type": "TextBlock", "text": "text" } ] }
+                ],
+                "actions": [
+                    { "type": "Action.OpenUrl", "url": "https://adaptivecards.io", "requires": { "other": "1.0" }, "fallback": "drop" },
+                    { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard", "body": [
+                        { "type": "TextBlock", "text": "shown" },
+                        { "type": "Graph", "fallback": { "type": "TextBlock", "text": "shown fallback" } } ] } }
+                ]
+            })", "1.5")->GetAdaptiveCard();
+
+            const auto resolved = ResolveFallbackFor(card)->GetAdaptiveCard();
+
+            const auto actionSet = std::static_pointer_cast<ActionSet>(resolved->GetBody()[0]);
+            Assert::AreEqual(size_t{1}, actionSet->GetActions().size());
+            Assert::AreEqual("submit"s, actionSet->GetActions()[0]->GetTitle());
+
+            const auto container = std::static_pointer_cast<Container>(resolved->GetBody()[1]);
+            Assert::IsTrue(container->GetSelectAction() == nullptr);
+            Assert::IsTrue(std::static_pointer_cast<Container>(card->GetBody()[1])->GetSelectAction() != nullptr);
+
+            Assert::AreEqual(size_t{1}, resolved->GetActions().size());
+            const auto showCard = std::static_pointer_cast<ShowCardAction>(resolved->GetActions()[0])->GetCard();
+            Assert::AreEqual(size_t{2}, showCard->GetBody().size());
+            Assert::AreEqual("shown fallback"s, GetText(showCard->GetBody()[1]));
+        }
+
+        TEST_METHOD(KeepsCardTheHostCanRender)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [
+                    { "type": "TextBlock", "text": "text", "requires": { "feature": "1.0" }, "fallback": "drop" },
+                    { "type": "Container", "items": [ { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png" } ] }
+                ],
+                "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard" } } ]
+            })", "1.5")->GetAdaptiveCard();
+
+            const auto parseResult = ResolveFallbackFor(card);
+            Assert::IsTrue(parseResult->GetAdaptiveCard() == card);
+            Assert::IsTrue(parseResult->GetWarnings().empty());
+        }
+    };
+}
@@ -597,6 +597,62 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::IsTrue(textBlockNoRequires->MeetsRequirements(featureRegistration));
         }
 
+        TEST_METHOD(RequiresAnyFeatureVersion)
+        {
+            std::string cardStr = R"card({
+              "type": "AdaptiveCard",
+              "version": "1.2",
+              "body": [
+                {
+                  "type": "TextBlock",
+                  "text": "This element requires any version of foobar",
+                  "requires": {
+                     "foobar": "*"
+                  }
+                },
+                {
+                  "type": "TextBlock",
+                  "text": "This element requires version 3 of FooBar",
+                  "requires": {
+                     "FooBar": "3"
+                  }
+                }
+              ]
+            })card";
+            auto parseResult = AdaptiveCard::DeserializeFromString(cardStr, "1.2");
+            auto body = parseResult->GetAdaptiveCard()->GetBody();
+            auto anyVersion = std::static_pointer_cast<TextBlock>(body[0]);
+            auto version3 = std::static_pointer_cast<TextBlock>(body[1]);
+
+            FeatureRegistration featureRegistration;
+            Assert::IsFalse(anyVersion->MeetsRequirements(featureRegistration));
+            Assert::IsFalse(version3->MeetsRequirements(featureRegistration));
+
+            featureRegistration.AddFeature("foobar", "0.1");
+            Assert::IsTrue(anyVersion->MeetsRequirements(featureRegistration));
+            Assert::IsFalse(version3->MeetsRequirements(featureRegistration));
+
+            // a host that provides any version of a feature meets every requirement on it
+            featureRegistration.RemoveFeature("FOOBAR");
+            featureRegistration.AddFeature("foobar", "*");
+            Assert::AreEqual("*"s, featureRegistration.GetFeatureVersion("fooBar"));
+            Assert::IsTrue(anyVersion->MeetsRequirements(featureRegistration));
+            Assert::IsTrue(version3->MeetsRequirements(featureRegistration));
+        }
+
+        TEST_METHOD(AdaptiveCardsVersionWithoutSemanticVersion)
+        {
+            FeatureRegistration featureRegistration;
+            Assert::IsTrue(SemanticVersion(c_sharedModelVersion) == featureRegistration.GetAdaptiveCardsVersion());
+
+            // only the exact name is refused by RemoveFeature, but feature names are case insensitive
+            featureRegistration.RemoveFeature("ADAPTIVECARDS");
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.GetAdaptiveCardsVersion(); });
+
+            featureRegistration.AddFeature("adaptiveCards", "*");
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { featureRegistration.GetAdaptiveCardsVersion(); });
+        }
+
         TEST_METHOD(NestedFallbacksSerialization)
         {
             std::string cardStr = R"card({
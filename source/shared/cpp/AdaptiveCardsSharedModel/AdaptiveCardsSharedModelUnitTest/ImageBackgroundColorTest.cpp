@@ -2,12 +2,40 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "Image.h"
+#include "Util.h"
+#include <random>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
+    // ValidateColor as it was implemented before it became a single pass scanner, which it has to agree with
+    std::string ReferenceValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+    {
+        if (backgroundColor.empty())
+        {
+            return backgroundColor;
+        }
+
+        const size_t backgroundColorLength = backgroundColor.length();
+        bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
+        for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
+        {
+            isValidColor = isxdigit(backgroundColor.at(i));
+        }
+
+        if (!isValidColor)
+        {
+            warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidColorFormat,
+                "Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format"));
+            return "#00000000";
+        }
+
+        return (backgroundColorLength == 7) ? "#FF" + backgroundColor.substr(1, 6) : backgroundColor;
+    }
+
     TEST_CLASS(ImageBackgroundColorTest)
     {
 
@@ -164,5 +192,30 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(std::string("#00000000"), backgroundColor);
         }
 
+        TEST_METHOD(ValidateColorMatchesReference)
+        {
+            // random strings of every length up to 10 over the characters that matter to the format
+            constexpr std::string_view alphabet{"#09afAFgG "};
+            std::mt19937 random(42);
+            std::uniform_int_distribution<size_t> pickCharacter(0, alphabet.size() - 1);
+
+            for (size_t length = 0; length <= 10; ++length)
+            {
+                for (int sample = 0; sample < 2000; ++sample)
+                {
+                    // every other string starts with a '#' so that valid colors come up often
+                    std::string color = (sample % 2 == 0 && length > 0) ? "#" : "";
+                    while (color.size() < length)
+                    {
+                        color += alphabet[pickCharacter(random)];
+                    }
+
+                    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> expectedWarnings;
+                    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> actualWarnings;
+                    Assert::AreEqual(ReferenceValidateColor(color, expectedWarnings), ValidateColor(color, actualWarnings));
+                    Assert::AreEqual(expectedWarnings.size(), actualWarnings.size());
+                }
+            }
+        }
     };
 }
@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "JsonWriter.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // What ParseUtil::JsonToString produced with jsoncpp's own writer
+    std::string WriteWithStreamWriter(const Json::Value& value)
+    {
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+        std::ostringstream stream;
+        writer->write(value, &stream);
+        stream << std::endl;
+        return stream.str();
+    }
+
+    TEST_CLASS(JsonWriterTest)
+    {
+    public:
+        TEST_METHOD(MatchesStreamWriter)
+        {
+            Json::Value value;
+            value["plain"] = "text";
+            value["empty"] = "";
+            value["escapes"] = "quote \" backslash \\ slash / \b\f\n\r\t \x01 \x1f \x7f";
+            value["unicode"] = "\xC3\xA9t\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80";
+            value["onlyUnicode"] = "\xD8\xB9\xD8\xB1\xD8\xA8\xD9\x8A";
+            value["invalidUtf8"] = "\xC3 \xE2\x82 \xF0\x9F \xFF \xED\xA0\x80 \xC0\xAF";
+            value["nul"] = Json::Value("a\0b", "a\0b" + 3);
+            value["int"] = -42;
+            value["largeInt"] = Json::Value::minLargestInt;
+            value["uint"] = Json::Value::maxLargestUInt;
+            value["real"] = 0.1;
+            value["wholeReal"] = 3.0;
+            value["tinyReal"] = 1e-300;
+            value["infinity"] = std::numeric_limits<double>::infinity();
+            value["true"] = true;
+            value["false"] = false;
+            value["null"] = Json::Value::null;
+            value["emptyArray"] = Json::Value(Json::arrayValue);
+            value["emptyObject"] = Json::Value(Json::objectValue);
+            value["nested"]["array"].append(1);
+            value["nested"]["array"].append("two");
+            value["nested"]["array"].append(Json::Value(Json::objectValue));
+            value["nested"]["array"][3]["deeper"].append(Json::Value(Json::arrayValue));
+            value["Upper"] = "sorts before lowercase";
+            value["\xC3\xA9"] = "sorts after ASCII";
+            value["key with \"quotes\""] = 1;
+
+            Assert::AreEqual(WriteWithStreamWriter(value), ParseUtil::JsonToString(value));
+
+            for (const auto& member : value)
+            {
+                Assert::AreEqual(WriteWithStreamWriter(member), ParseUtil::JsonToString(member));
+            }
+        }
+
+        TEST_METHOD(WritesToStreamsAndSinks)
+        {
+            Json::Value value(Json::arrayValue);
+            for (int i = 0; i < 2000; ++i)
+            {
+                value.append("item " + std::to_string(i));
+            }
+            const std::string expected = WriteWithStreamWriter(value);
+
+            std::ostringstream stream;
+            {
+                JsonWriter writer(stream);
+                writer.WriteValue(value);
+                writer.WriteRaw("\n");
+            }
+            Assert::AreEqual(expected, stream.str());
+
+            std::string sinkOutput;
+            size_t pieceCount = 0;
+            {
+                JsonWriter writer([&](std::string_view piece) {
+                    sinkOutput += piece;
+                    ++pieceCount;
+                });
+                writer.WriteValue(value);
+                writer.WriteRaw("\n");
+            }
+            Assert::AreEqual(expected, sinkOutput);
+            Assert::IsTrue(pieceCount > 1);
+        }
+
+        TEST_METHOD(BuildsDocumentsFromParts)
+        {
+            std::string output = "prefix ";
+            {
+                JsonWriter writer(output);
+                writer.BeginObject();
+                writer.WriteName("a");
+                writer.BeginArray();
+                writer.WriteValue(1);
+                writer.WriteValue(Json::Value(Json::objectValue));
+                writer.EndArray();
+                writer.WriteName("b");
+                writer.WriteValue("c");
+                writer.EndObject();
+            }
+            Assert::AreEqual(R"(prefix {"a":[1,{}],"b":"c"})"s, output);
+        }
+
+        TEST_METHOD(StreamedCardMatchesSerializeToJsonValue)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "$schema": "http://adaptivecards.io/schemas/adaptive-card.json",
+                "aardvark": { "first": true },
+                "backgroundImage": "https://adaptivecards.io/content/background.png",
+                "lang": "en",
+                "zebra": [ "last" ],
+                "body": [
+                    { "type": "TextBlock", "text": "Café", "id": "text" },
+                    { "type": "Container", "items": [ { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png" } ] }
+                ],
+                "actions": [ { "type": "Action.OpenUrl", "title": "Open", "url": "https://adaptivecards.io" } ]
+            })";
+
+            for (const auto& card : {AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard(),
+                                     std::make_shared<AdaptiveCard>()})
+            {
+                const std::string expected = WriteWithStreamWriter(card->SerializeToJsonValue());
+                Assert::AreEqual(expected, card->Serialize());
+
+                std::ostringstream stream;
+                {
+                    JsonWriter writer(stream);
+                    card->Serialize(writer);
+                }
+                Assert::AreEqual(expected, stream.str());
+            }
+        }
+    };
+}
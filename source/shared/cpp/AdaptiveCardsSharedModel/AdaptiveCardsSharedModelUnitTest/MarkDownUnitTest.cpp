@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "MarkDownParser.h"
+#include <random>
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
@@ -808,6 +810,73 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<std::string>("<p>Hello***World***</p>", MarkDownParser("Hello***World***").TransformToHtml());
         }
 
+        TEST_METHOD(LongEmphasisTextTest)
+        {
+            std::string text;
+            std::string expected = "<p>";
+            for (int i = 0; i < 200; ++i)
+            {
+                text += "*a* **b** ";
+                expected += "<em>a</em> <strong>b</strong> ";
+            }
+            expected += "</p>";
+
+            MarkDownParser parser(text);
+            Assert::AreEqual<std::string>(expected, parser.TransformToHtml());
+            Assert::IsTrue(parser.HasHtmlTags());
+        }
+
+        // The parsers rely on how std::istream sets eof and fail, so MarkDownStream has to do the same
+        TEST_METHOD(MarkDownStreamMatchesStringStreamTest)
+        {
+            std::mt19937 random(42);
+            const std::string text = "ab*";
+            for (int run = 0; run < 2000; ++run)
+            {
+                std::stringstream expected(text);
+                MarkDownStream actual(text);
+                for (int op = 0; op < 12; ++op)
+                {
+                    switch (random() % 7)
+                    {
+                    case 0:
+                        Assert::AreEqual(expected.peek(), actual.peek());
+                        break;
+                    case 1:
+                        Assert::AreEqual(expected.get(), actual.get());
+                        break;
+                    case 2:
+                    {
+                        char expectedChar = '#', actualChar = '#';
+                        expected.get(expectedChar);
+                        actual.get(actualChar);
+                        Assert::AreEqual(expectedChar, actualChar);
+                        break;
+                    }
+                    case 3:
+                        expected.unget();
+                        actual.unget();
+                        break;
+                    case 4:
+                        Assert::AreEqual(static_cast<std::streamoff>(expected.tellg()), actual.tellg());
+                        break;
+                    case 5:
+                    {
+                        const std::streamoff position = random() % (text.size() + 1);
+                        expected.seekg(position, std::ios::beg);
+                        actual.seekg(position);
+                        break;
+                    }
+                    default:
+                        expected.clear();
+                        actual.clear();
+                        break;
+                    }
+                    Assert::AreEqual(expected.eof(), actual.eof());
+                }
+            }
+        }
+
 
     };
 }
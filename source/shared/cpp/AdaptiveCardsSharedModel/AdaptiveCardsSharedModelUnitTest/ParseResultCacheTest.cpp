@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseResultCache.h"
+#include "ParseUtil.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::string MakeCardWithText(const std::string& text)
+    {
+        return R"({
+            "type": "AdaptiveCard",
+            "version": "1.5",
+            "body": [
+                {
+                    "type": "TextBlock",
+                    "text": ")" + text + R"("
+                },
+                {
+                    "type": "Fancy",
+                    "text": "custom"
+                }
+            ]
+        })";
+    }
+
+    class FancyElementParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(ParseContext& /*context*/, const Json::Value& value) override
+        {
+            auto textBlock = std::make_shared<TextBlock>();
+            textBlock->SetText(ParseUtil::GetString(value, AdaptiveCardSchemaKey::Text));
+            return textBlock;
+        }
+
+        std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+        {
+            return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        }
+    };
+
+    TEST_CLASS(ParseResultCacheTest)
+    {
+    public:
+        TEST_METHOD(ReusesResultForSameJson)
+        {
+            ParseResultCache cache;
+            const auto first = cache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+            const auto second = cache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+
+            Assert::IsTrue(first == second);
+            Assert::AreEqual(1ui64, cache.GetEntryCount());
+            Assert::AreEqual("A"s, std::static_pointer_cast<const TextBlock>(first->GetAdaptiveCard()->GetBody()[0])->GetText());
+
+            const auto otherText = cache.DeserializeFromString(MakeCardWithText("B"), "1.5");
+            Assert::IsTrue(first != otherText);
+            Assert::AreEqual(2ui64, cache.GetEntryCount());
+        }
+
+        TEST_METHOD(KeysOnRendererVersion)
+        {
+            ParseResultCache cache;
+            const auto supported = cache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+            const auto unsupported = cache.DeserializeFromString(MakeCardWithText("A"), "1.0");
+
+            Assert::IsTrue(supported != unsupported);
+            Assert::IsTrue(supported->GetWarnings().empty());
+            Assert::AreEqual(1ui64, unsupported->GetWarnings().size());
+            Assert::IsTrue(WarningStatusCode::UnsupportedSchemaVersion == unsupported->GetWarnings()[0]->GetStatusCode());
+
+            // cached warnings come back along with the cached card
+            Assert::IsTrue(unsupported == cache.DeserializeFromString(MakeCardWithText("A"), "1.0"));
+            Assert::AreEqual(1ui64, cache.DeserializeFromString(MakeCardWithText("A"), "1.0")->GetWarnings().size());
+        }
+
+        TEST_METHOD(KeysOnParseContext)
+        {
+            ParseResultCache cache;
+            ParseContext context;
+            const auto builtInParsers = cache.DeserializeFromString(MakeCardWithText("A"), "1.5", context);
+            Assert::IsTrue(builtInParsers->GetAdaptiveCard()->GetBody()[1]->GetElementType() == CardElementType::Unknown);
+
+            // a fresh context with the built-in parsers parses the same way
+            Assert::IsTrue(builtInParsers == cache.DeserializeFromString(MakeCardWithText("A"), "1.5"));
+
+            // registering a parser must not hand back a card parsed without it
+            context.elementParserRegistration->AddParser("Fancy", std::make_shared<FancyElementParser>());
+            const auto customParsers = cache.DeserializeFromString(MakeCardWithText("A"), "1.5", context);
+            Assert::IsTrue(builtInParsers != customParsers);
+            Assert::IsTrue(customParsers->GetAdaptiveCard()->GetBody()[1]->GetElementType() == CardElementType::TextBlock);
+            Assert::IsTrue(customParsers == cache.DeserializeFromString(MakeCardWithText("A"), "1.5", context));
+
+            context.elementParserRegistration->RemoveParser("Fancy");
+            Assert::IsTrue(customParsers != cache.DeserializeFromString(MakeCardWithText("A"), "1.5", context));
+
+            // the context's language is what a card without "lang" falls back to
+            ParseContext frenchContext;
+            frenchContext.SetLanguage("fr");
+            const auto french = cache.DeserializeFromString(MakeCardWithText("A"), "1.5", frenchContext);
+            Assert::IsTrue(builtInParsers != french);
+            Assert::AreEqual("fr"s, french->GetAdaptiveCard()->GetLanguage());
+            Assert::IsTrue(context.warnings.empty());
+            Assert::IsTrue(frenchContext.warnings.empty());
+        }
+
+        TEST_METHOD(EvictsLeastRecentlyUsed)
+        {
+            ParseResultCache sizingCache;
+            sizingCache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+            const size_t entrySize = sizingCache.GetMemoryUsage();
+
+            ParseResultCache cache(2 * entrySize);
+            const auto a = cache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+            const auto b = cache.DeserializeFromString(MakeCardWithText("B"), "1.5");
+            Assert::IsTrue(a == cache.DeserializeFromString(MakeCardWithText("A"), "1.5"));
+
+            // B is now the least recently used entry, so it makes room for C
+            cache.DeserializeFromString(MakeCardWithText("C"), "1.5");
+            Assert::AreEqual(2ui64, cache.GetEntryCount());
+            Assert::AreEqual(2 * entrySize, cache.GetMemoryUsage());
+            Assert::IsTrue(a == cache.DeserializeFromString(MakeCardWithText("A"), "1.5"));
+            Assert::IsTrue(b != cache.DeserializeFromString(MakeCardWithText("B"), "1.5"));
+
+            cache.Clear();
+            Assert::AreEqual(0ui64, cache.GetEntryCount());
+            Assert::AreEqual(0ui64, cache.GetMemoryUsage());
+        }
+
+        TEST_METHOD(DoesNotCacheEntriesLargerThanBudget)
+        {
+            ParseResultCache cache(1);
+            const auto first = cache.DeserializeFromString(MakeCardWithText("A"), "1.5");
+            Assert::IsTrue(first->GetAdaptiveCard() != nullptr);
+            Assert::AreEqual(0ui64, cache.GetEntryCount());
+            Assert::IsTrue(first != cache.DeserializeFromString(MakeCardWithText("A"), "1.5"));
+        }
+    };
+}
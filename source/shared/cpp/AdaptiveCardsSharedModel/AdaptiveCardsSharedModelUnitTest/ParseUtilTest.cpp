@@ -271,5 +271,18 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto actualString = ParseUtil::GetJsonString(jsonObjWithValidType, AdaptiveCardSchemaKey::Accent, true);
             Assert::AreEqual(actualString, "\"Valid\"\n"s);
         }
+
+        TEST_METHOD(ToLowercaseTests)
+        {
+            Assert::AreEqual("action.openurl 123 {}"s, ParseUtil::ToLowercase("Action.OpenUrl 123 {}"));
+            Assert::AreEqual(""s, ParseUtil::ToLowercase(""));
+
+            // only ASCII letters are folded, so the bytes of UTF-8 sequences come through untouched
+            Assert::AreEqual("\xC3\x89" "cole"s, ParseUtil::ToLowercase("\xC3\x89" "COLE"));
+
+            Assert::IsTrue(CaseInsensitiveEqualTo{}("TextBlock"s, "TEXTBLOCK"s));
+            Assert::IsFalse(CaseInsensitiveEqualTo{}("TextBlock"s, "TextBlocks"s));
+            Assert::AreEqual(CaseInsensitiveHash{}("Action.Submit"s), CaseInsensitiveHash{}("action.SUBMIT"s));
+        }
     };
 }
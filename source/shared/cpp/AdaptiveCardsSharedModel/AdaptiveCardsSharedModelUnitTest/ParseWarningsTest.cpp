@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // A card whose Action.ShowCard shows a card of the same shape, depth cards deep. Every card has an image with
+    // a width of its own depth, which is invalid in points, and the same invalid minHeight.
+    std::string MakeNestedShowCard(unsigned int depth)
+    {
+        std::string card = R"({
+            "type": "AdaptiveCard",
+            "version": "1.5",
+            "minHeight": "50pt",
+            "body": [
+                {
+                    "type": "Image",
+                    "url": "https://adaptivecards.io/content/cats/1.png",
+                    "width": ")" + std::to_string(depth) + R"(pt"
+                }
+            ])";
+
+        if (depth > 1)
+        {
+            card += R"(,
+            "actions": [
+                {
+                    "type": "Action.ShowCard",
+                    "title": "More",
+                    "card": )" + MakeNestedShowCard(depth - 1) + R"(
+                }
+            ])";
+        }
+
+        return card + "}";
+    }
+
+    TEST_CLASS(ParseWarningsTest)
+    {
+    public:
+        TEST_METHOD(NestedShowCardsReportEachWarningOnce)
+        {
+            const auto parseResult = AdaptiveCard::DeserializeFromString(MakeNestedShowCard(10), "1.5");
+
+            // each card contributes its own width warning, and the minHeight warning they share is reported once
+            const auto& warnings = parseResult->GetWarnings();
+            Assert::AreEqual(11ui64, warnings.size());
+            for (const auto& warning : warnings)
+            {
+                Assert::IsTrue(WarningStatusCode::InvalidDimensionSpecified == warning->GetStatusCode());
+            }
+
+            unsigned int depth = 0;
+            for (auto card = parseResult->GetAdaptiveCard(); card; ++depth)
+            {
+                const auto& actions = card->GetActions();
+                card = actions.empty() ? nullptr : std::static_pointer_cast<ShowCardAction>(actions[0])->GetCard();
+            }
+            Assert::AreEqual(10u, depth);
+        }
+
+        TEST_METHOD(ParseResultSharesContextWarnings)
+        {
+            ParseContext context;
+            const auto parseResult = AdaptiveCard::DeserializeFromString(MakeNestedShowCard(3), "1.5", context);
+
+            Assert::AreEqual(4ui64, context.warnings.size());
+            Assert::AreEqual(context.warnings.size(), parseResult->GetWarnings().size());
+            for (size_t i = 0; i < context.warnings.size(); ++i)
+            {
+                Assert::IsTrue(context.warnings[i] == parseResult->GetWarnings()[i]);
+            }
+        }
+
+        TEST_METHOD(MaxWarningCountCapsWarnings)
+        {
+            ParseContext context;
+            Assert::IsFalse(context.GetMaxWarningCount().has_value());
+
+            context.SetMaxWarningCount(3);
+            const auto parseResult = AdaptiveCard::DeserializeFromString(MakeNestedShowCard(10), "1.5", context);
+
+            Assert::AreEqual(3ui64, parseResult->GetWarnings().size());
+            Assert::AreEqual(
+                "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received 50pt"s,
+                parseResult->GetWarnings()[0]->GetReason());
+        }
+
+        TEST_METHOD(ConsolidateWarningsKeepsFirstOfEach)
+        {
+            ParseContext context;
+            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidValue, "a"));
+            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidValue, "b"));
+            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidValue, "a"));
+            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::UnknownElementType, "a"));
+            const auto first = context.warnings[0];
+
+            context.ConsolidateWarnings();
+
+            Assert::AreEqual(3ui64, context.warnings.size());
+            Assert::IsTrue(first == context.warnings[0]);
+            Assert::AreEqual("b"s, context.warnings[1]->GetReason());
+            Assert::IsTrue(WarningStatusCode::UnknownElementType == context.warnings[2]->GetStatusCode());
+        }
+    };
+}
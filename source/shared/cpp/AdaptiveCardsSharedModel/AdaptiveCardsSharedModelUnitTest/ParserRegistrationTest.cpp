@@ -121,5 +121,24 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParser.RemoveParser(CardElementTypeToString(CardElementType::Container)); });
             Assert::IsTrue((bool)elementParser.GetParser(CardElementTypeToString(CardElementType::Container)));
         }
+
+        TEST_METHOD(GetParserReturnsRegisteredWrapper)
+        {
+            ActionParserRegistration actionParser;
+            ElementParserRegistration elementParser;
+
+            // lookups hand out the wrapper made at registration rather than a new one each time
+            const auto textBlockParser = elementParser.GetParser(CardElementTypeToString(CardElementType::TextBlock));
+            Assert::IsTrue(textBlockParser == elementParser.GetParser(CardElementTypeToString(CardElementType::TextBlock)));
+            Assert::IsTrue(textBlockParser == elementParser.GetParser("TEXTBLOCK"));
+            Assert::IsTrue((bool)std::dynamic_pointer_cast<BaseCardElementParserWrapper>(textBlockParser));
+
+            const auto submitParser = actionParser.GetParser(ActionTypeToString(ActionType::Submit));
+            Assert::IsTrue(submitParser == actionParser.GetParser("action.submit"));
+            Assert::IsTrue((bool)std::dynamic_pointer_cast<ActionElementParserWrapper>(submitParser));
+
+            // the built-in parsers are wrapped once and shared by every registration
+            Assert::IsTrue(textBlockParser == ElementParserRegistration().GetParser(CardElementTypeToString(CardElementType::TextBlock)));
+        }
     };
 }
@@ -0,0 +1,230 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "Container.h"
+#include "ElementIndex.h"
+#include "FactSet.h"
+#include "Fact.h"
+#include "ParseUtil.h"
+#include "PatchableCard.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string patchableCardJson = R"({
+        "type": "AdaptiveCard",
+        "version": "1.5",
+        "lang": "de",
+        "body": [
+            { "type": "TextBlock", "text": "Status", "id": "title" },
+            { "type": "FactSet", "facts": [ { "title": "State", "value": "Pending" } ] },
+            { "type": "Container", "style": "emphasis", "items": [
+                { "type": "TextBlock", "text": "Inside" },
+                { "type": "ActionSet", "actions": [ { "type": "Action.Submit", "title": "Nested", "id": "nested" } ] }
+            ] }
+        ],
+        "actions": [ { "type": "Action.Submit", "title": "Approve", "id": "approve" } ]
+    })";
+
+    Json::Value MakePatch(const std::string& patch)
+    {
+        return ParseUtil::GetJsonValueFromString(patch);
+    }
+
+    // The patched card has to be the card a full parse of the patched json gives
+    void AssertMatchesFullParse(const PatchableCard& card)
+    {
+        ParseContext context;
+        const auto fullParse = AdaptiveCard::Deserialize(card.GetJson(), "1.5", context);
+        Assert::AreEqual(fullParse->GetAdaptiveCard()->Serialize(), card.GetAdaptiveCard()->Serialize());
+    }
+
+    TEST_CLASS(PatchableCardTest)
+    {
+    public:
+        TEST_METHOD(ParsesOnlyThePatchedElement)
+        {
+            PatchableCard card(patchableCardJson, "1.5");
+            const auto adaptiveCard = card.GetAdaptiveCard();
+            const auto title = adaptiveCard->GetBody()[0];
+            const auto oldFactSet = adaptiveCard->GetBody()[1];
+
+            const auto result = card.Replace("/body/1/facts/0/value", "Approved");
+
+            Assert::IsFalse(result.reparsedCard);
+            Assert::IsTrue(adaptiveCard == card.GetAdaptiveCard());
+            Assert::IsTrue(title == adaptiveCard->GetBody()[0]);
+            Assert::AreEqual(1ui64, result.patchedElements.size());
+            Assert::IsTrue(oldFactSet->GetInternalId() == result.patchedElements[0].previousInternalId);
+
+            const auto factSet = std::dynamic_pointer_cast<FactSet>(adaptiveCard->GetBody()[1]);
+            Assert::IsTrue(factSet == result.patchedElements[0].element);
+            Assert::AreEqual("Approved"s, factSet->GetFacts()[0]->GetValue());
+            // the fact keeps the language of the card
+            Assert::AreEqual("de"s, factSet->GetFacts()[0]->GetLanguage());
+            Assert::AreEqual("Approved"s, card.GetJson()["body"][1]["facts"][0]["value"].asString());
+            AssertMatchesFullParse(card);
+        }
+
+        TEST_METHOD(PatchesActions)
+        {
+            PatchableCard card(patchableCardJson, "1.5");
+            const auto result = card.ApplyPatch(MakePatch(R"([
+                { "op": "add", "path": "/actions/0/isEnabled", "value": false },
+                { "op": "replace", "path": "/body/2/items/1/actions/0/title", "value": "Renamed" },
+                { "op": "test", "path": "/actions/0/title", "value": "Approve" }
+            ])"));
+
+            Assert::IsFalse(result.reparsedCard);
+            Assert::AreEqual(2ui64, result.patchedElements.size());
+            Assert::IsFalse(card.GetAdaptiveCard()->GetActions()[0]->GetIsEnabled());
+
+            const auto container = std::dynamic_pointer_cast<Container>(card.GetAdaptiveCard()->GetBody()[2]);
+            const auto actionSet = std::dynamic_pointer_cast<ActionSet>(container->GetItems()[1]);
+            Assert::AreEqual("Renamed"s, actionSet->GetActions()[0]->GetTitle());
+            AssertMatchesFullParse(card);
+        }
+
+        TEST_METHOD(ReparsesCardForStructuralChanges)
+        {
+            PatchableCard card(patchableCardJson, "1.5");
+            const auto oldCard = card.GetAdaptiveCard();
+
+            // adding an element to the body changes the card itself
+            auto result = card.ApplyPatch(MakePatch(R"([ { "op": "add", "path": "/body/1", "value": { "type": "TextBlock", "text": "" } } ])"));
+            Assert::IsTrue(result.reparsedCard);
+            Assert::IsTrue(result.patchedElements.empty());
+            Assert::IsFalse(oldCard == card.GetAdaptiveCard());
+            Assert::AreEqual(4ui64, card.GetAdaptiveCard()->GetBody().size());
+            Assert::IsFalse(result.warnings.empty());
+            AssertMatchesFullParse(card);
+
+            // as does changing a container, whose items take its style
+            result = card.Replace("/body/3/style", "good");
+            Assert::IsTrue(result.reparsedCard);
+            AssertMatchesFullParse(card);
+
+            // and changing an element's type
+            result = card.Replace("/body/0", MakePatch(R"({ "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png" })"));
+            Assert::IsTrue(result.reparsedCard);
+            AssertMatchesFullParse(card);
+        }
+
+        TEST_METHOD(ReparsesCardForIdChanges)
+        {
+            PatchableCard card(patchableCardJson, "1.5");
+
+            const auto result = card.Replace("/body/0/id", "renamed");
+            Assert::IsTrue(result.reparsedCard);
+            AssertMatchesFullParse(card);
+
+            // an id that collides with another element's fails like a full parse does, and leaves the card alone
+            const auto adaptiveCard = card.GetAdaptiveCard();
+            try
+            {
+                card.Replace("/actions/0/id", "renamed");
+                Assert::Fail(L"Expected an id collision");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::AreEqual(static_cast<int>(ErrorStatusCode::IdCollision), static_cast<int>(e.GetStatusCode()));
+            }
+            Assert::IsTrue(adaptiveCard == card.GetAdaptiveCard());
+            Assert::AreEqual("approve"s, card.GetJson()["actions"][0]["id"].asString());
+        }
+
+        TEST_METHOD(RejectsBadPatches)
+        {
+            PatchableCard card(patchableCardJson, "1.5");
+            const std::string json = ParseUtil::JsonToString(card.GetJson());
+            const auto adaptiveCard = card.GetAdaptiveCard();
+            const auto factSet = adaptiveCard->GetBody()[1];
+
+            for (const auto& patch : {
+                     R"({ "op": "replace", "path": "/body/0/text", "value": "x" })"s,
+                     R"([ { "op": "replace", "path": "/body/7/text", "value": "x" } ])"s,
+                     R"([ { "op": "replace", "path": "/body/01/text", "value": "x" } ])"s,
+                     R"([ { "op": "remove", "path": "/body/0/missing" } ])"s,
+                     R"([ { "op": "replace", "path": "body/0/text", "value": "x" } ])"s,
+                     R"([ { "op": "frobnicate", "path": "/body/0/text" } ])"s,
+                     R"([ { "op": "move", "from": "/body/2", "path": "/body/2/items/0" } ])"s,
+                     R"([ { "op": "replace", "path": "/body/1/facts/0/value", "value": "Done" }, { "op": "test", "path": "/version", "value": "1.0" } ])"s,
+                 })
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { card.ApplyPatch(MakePatch(patch)); });
+                Assert::AreEqual(json, ParseUtil::JsonToString(card.GetJson()));
+                Assert::IsTrue(adaptiveCard == card.GetAdaptiveCard());
+                Assert::IsTrue(factSet == adaptiveCard->GetBody()[1]);
+            }
+        }
+
+        TEST_METHOD(AppliesJsonPatchOperations)
+        {
+            PatchableCard card(R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "body": [ { "type": "FactSet", "facts": [
+                    { "title": "a/b", "value": "1" }, { "title": "c~d", "value": "2" }
+                ], "x/y": { "m~n": "escaped" } } ]
+            })", "1.5");
+
+            const auto result = card.ApplyPatch(MakePatch(R"([
+                { "op": "test", "path": "/body/0/x~1y/m~0n", "value": "escaped" },
+                { "op": "copy", "from": "/body/0/facts/0", "path": "/body/0/facts/-" },
+                { "op": "move", "from": "/body/0/facts/1", "path": "/body/0/facts/0" },
+                { "op": "remove", "path": "/body/0/x~1y" },
+                { "op": "add", "path": "/body/0/facts/1/value", "value": "3" }
+            ])"));
+
+            Assert::IsFalse(result.reparsedCard);
+            Assert::AreEqual(1ui64, result.patchedElements.size());
+
+            const auto facts = std::dynamic_pointer_cast<FactSet>(card.GetAdaptiveCard()->GetBody()[0])->GetFacts();
+            Assert::AreEqual(3ui64, facts.size());
+            Assert::AreEqual("c~d"s, facts[0]->GetTitle());
+            Assert::AreEqual("3"s, facts[1]->GetValue());
+            Assert::AreEqual("a/b"s, facts[2]->GetTitle());
+            Assert::IsFalse(card.GetJson()["body"][0].isMember("x/y"));
+            AssertMatchesFullParse(card);
+        }
+
+        TEST_METHOD(RebuildsElementIndexOfPatchedCards)
+        {
+            PatchableCard card(R"({
+                "type": "AdaptiveCard", "version": "1.5",
+                "body": [ { "type": "TextBlock", "id": "t", "text": "old" } ],
+                "actions": [ { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard",
+                    "body": [ { "type": "TextBlock", "id": "shown", "text": "old" } ] } } ]
+            })", "1.5");
+            const auto adaptiveCard = card.GetAdaptiveCard();
+            const auto shownCard = std::static_pointer_cast<ShowCardAction>(adaptiveCard->GetActions()[0])->GetCard();
+            const auto getText = [](const ElementIndex& index, const std::string& id) {
+                return std::static_pointer_cast<TextBlock>(index.GetCardElement(id))->GetText();
+            };
+            Assert::AreEqual("old"s, getText(*adaptiveCard->GetElementIndex(), "t"));
+            Assert::AreEqual("old"s, getText(*shownCard->GetElementIndex(), "shown"));
+
+            const auto indexBeforePatch = adaptiveCard->GetElementIndex();
+            Assert::IsFalse(card.Replace("/body/0/text", "new").reparsedCard);
+            Assert::IsTrue(adaptiveCard->GetElementIndex()->GetCardElement("t") == adaptiveCard->GetBody()[0]);
+            Assert::AreEqual("new"s, getText(*adaptiveCard->GetElementIndex(), "t"));
+
+            // whoever still holds the index from before the patch keeps it as it was
+            Assert::IsTrue(indexBeforePatch != adaptiveCard->GetElementIndex());
+            Assert::AreEqual("old"s, getText(*indexBeforePatch, "t"));
+
+            // an element of a show card is in the index of the show card's card too
+            Assert::IsFalse(card.Replace("/actions/0/card/body/0/text", "new").reparsedCard);
+            Assert::AreEqual("new"s, getText(*adaptiveCard->GetElementIndex(), "shown"));
+            Assert::AreEqual("new"s, getText(*shownCard->GetElementIndex(), "shown"));
+        }
+    };
+}
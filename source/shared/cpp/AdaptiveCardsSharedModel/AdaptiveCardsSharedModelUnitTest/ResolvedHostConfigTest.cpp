@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ResolvedHostConfig.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Checks every lookup of resolved against the HostConfig it was built from
+    void VerifyResolvedHostConfig(const HostConfig& hostConfig, const ResolvedHostConfig& resolved)
+    {
+        for (const auto style : {ContainerStyle::None, ContainerStyle::Default, ContainerStyle::Emphasis, ContainerStyle::Good,
+                                 ContainerStyle::Attention, ContainerStyle::Warning, ContainerStyle::Accent})
+        {
+            Assert::AreEqual(hostConfig.GetBackgroundColor(style), resolved.GetBackgroundColor(style));
+            Assert::AreEqual(hostConfig.GetBorderColor(style), resolved.GetBorderColor(style));
+            Assert::AreEqual(hostConfig.GetBorderThickness(style), resolved.GetBorderThickness(style));
+
+            for (const auto color : {ForegroundColor::Default, ForegroundColor::Dark, ForegroundColor::Light, ForegroundColor::Accent,
+                                     ForegroundColor::Good, ForegroundColor::Warning, ForegroundColor::Attention})
+            {
+                for (const bool isSubtle : {false, true})
+                {
+                    Assert::AreEqual(hostConfig.GetForegroundColor(style, color, isSubtle), resolved.GetForegroundColor(style, color, isSubtle));
+                    Assert::AreEqual(hostConfig.GetHighlightColor(style, color, isSubtle), resolved.GetHighlightColor(style, color, isSubtle));
+                }
+            }
+        }
+
+        for (const auto fontType : {FontType::Default, FontType::Monospace})
+        {
+            Assert::AreEqual(hostConfig.GetFontFamily(fontType), resolved.GetFontFamily(fontType));
+
+            for (const auto size : {TextSize::Small, TextSize::Default, TextSize::Medium, TextSize::Large, TextSize::ExtraLarge})
+            {
+                Assert::AreEqual(hostConfig.GetFontSize(fontType, size), resolved.GetFontSize(fontType, size));
+            }
+
+            for (const auto weight : {TextWeight::Lighter, TextWeight::Default, TextWeight::Bolder})
+            {
+                Assert::AreEqual(hostConfig.GetFontWeight(fontType, weight), resolved.GetFontWeight(fontType, weight));
+            }
+        }
+
+        const auto spacing = hostConfig.GetSpacing();
+        Assert::AreEqual(0u, resolved.GetSpacing(Spacing::None));
+        Assert::AreEqual(spacing.smallSpacing, resolved.GetSpacing(Spacing::Small));
+        Assert::AreEqual(spacing.defaultSpacing, resolved.GetSpacing(Spacing::Default));
+        Assert::AreEqual(spacing.mediumSpacing, resolved.GetSpacing(Spacing::Medium));
+        Assert::AreEqual(spacing.largeSpacing, resolved.GetSpacing(Spacing::Large));
+        Assert::AreEqual(spacing.extraLargeSpacing, resolved.GetSpacing(Spacing::ExtraLarge));
+        Assert::AreEqual(spacing.paddingSpacing, resolved.GetSpacing(Spacing::Padding));
+
+        Assert::AreEqual(hostConfig.GetSeparator().lineColor, resolved.GetSeparator().lineColor);
+        Assert::AreEqual(hostConfig.GetSeparator().lineThickness, resolved.GetSeparator().lineThickness);
+        Assert::AreEqual(hostConfig.GetActions().maxActions, resolved.GetActions().maxActions);
+        Assert::AreEqual(hostConfig.GetInputs().label.requiredInputs.suffix, resolved.GetInputs().label.requiredInputs.suffix);
+        Assert::AreEqual(hostConfig.GetTable().cellSpacing, resolved.GetTable().cellSpacing);
+    }
+
+    TEST_CLASS(ResolvedHostConfigTest)
+    {
+    public:
+        TEST_METHOD(MatchesDefaultHostConfig)
+        {
+            const HostConfig hostConfig;
+            VerifyResolvedHostConfig(hostConfig, ResolvedHostConfig(hostConfig));
+        }
+
+        TEST_METHOD(MatchesCustomHostConfig)
+        {
+            const std::string hostConfigJson = R"({
+                "fontFamily": "Deprecated",
+                "fontSizes": { "small": 11, "large": 21 },
+                "fontWeights": { "bolder": 700 },
+                "fontTypes": {
+                    "default": { "fontFamily": "Segoe UI", "fontSizes": { "medium": 15 } },
+                    "monospace": { "fontFamily": "Consolas", "fontWeights": { "lighter": 100 } }
+                },
+                "spacing": { "small": 4, "default": 9, "medium": 21, "large": 31, "extraLarge": 41, "padding": 17 },
+                "separator": { "lineThickness": 2, "lineColor": "#FF00FF00" },
+                "containerStyles": {
+                    "emphasis": {
+                        "backgroundColor": "#FFEEEEEE",
+                        "foregroundColors": {
+                            "accent": { "default": "#FF111111", "subtle": "#88111111", "highlightColors": { "default": "#FF222222" } }
+                        }
+                    }
+                },
+                "actions": { "maxActions": 7 },
+                "inputs": { "label": { "requiredInputs": { "suffix": " [required]" } } },
+                "table": { "cellSpacing": 3 }
+            })";
+
+            const auto hostConfig = HostConfig::DeserializeFromString(hostConfigJson);
+            const ResolvedHostConfig resolved(hostConfig);
+            VerifyResolvedHostConfig(hostConfig, resolved);
+
+            Assert::AreEqual("Segoe UI"s, resolved.GetFontFamily(FontType::Default));
+            Assert::AreEqual(15u, resolved.GetFontSize(FontType::Monospace, TextSize::Medium));
+            Assert::AreEqual(21u, resolved.GetFontSize(FontType::Monospace, TextSize::Large));
+            Assert::AreEqual(100u, resolved.GetFontWeight(FontType::Monospace, TextWeight::Lighter));
+            Assert::AreEqual("#88111111"s, resolved.GetForegroundColor(ContainerStyle::Emphasis, ForegroundColor::Accent, true));
+            Assert::AreEqual(17u, resolved.GetSpacing(Spacing::Padding));
+        }
+
+        TEST_METHOD(SnapshotIsUnaffectedByLaterChanges)
+        {
+            HostConfig hostConfig;
+            const ResolvedHostConfig resolved(hostConfig);
+            const auto backgroundColor = resolved.GetBackgroundColor(ContainerStyle::Default);
+
+            auto containerStyles = hostConfig.GetContainerStyles();
+            containerStyles.defaultPalette.backgroundColor = "#FF123456";
+            hostConfig.SetContainerStyles(containerStyles);
+
+            Assert::AreEqual(backgroundColor, resolved.GetBackgroundColor(ContainerStyle::Default));
+            Assert::AreEqual("#FF123456"s, ResolvedHostConfig(hostConfig).GetBackgroundColor(ContainerStyle::Default));
+        }
+    };
+}
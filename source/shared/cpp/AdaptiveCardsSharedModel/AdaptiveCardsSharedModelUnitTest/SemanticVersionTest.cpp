@@ -73,6 +73,19 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.c"); });
         }
 
+        TEST_METHOD(TryParseTest)
+        {
+            const auto version = SemanticVersion::TryParse("1.02.3");
+            Assert::IsTrue(version.has_value());
+            Assert::IsTrue(SemanticVersion(1, 2, 3, 0) == version.value());
+            Assert::IsTrue(SemanticVersion::TryParse("2147483647").has_value());
+
+            for (const auto& invalid : {"", "text", "2147483648", "1.", ".1", "1..2", "1.2.3.4.5", " 1.0", "-1", "1.c"})
+            {
+                Assert::IsFalse(SemanticVersion::TryParse(invalid).has_value());
+            }
+        }
+
         TEST_METHOD(CompareTest)
         {
             {
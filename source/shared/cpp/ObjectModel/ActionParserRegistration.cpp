@@ -11,6 +11,23 @@
 #include "SubmitAction.h"
 #include "ToggleVisibilityAction.h"
 #include "UnknownAction.h"
+#include <atomic>
+
+namespace
+{
+// Revisions are handed out process-wide so that no two registrations ever end up with the same one
+std::uint64_t NextRevision()
+{
+    static std::atomic<std::uint64_t> s_nextRevision{1};
+    return s_nextRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename TParser>
+std::shared_ptr<AdaptiveCards::ActionElementParser> MakeWrappedParser()
+{
+    return std::make_shared<AdaptiveCards::ActionElementParserWrapper>(std::make_shared<TParser>());
+}
+} // namespace
 
 namespace AdaptiveCards
 {
@@ -35,32 +52,49 @@ std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ActionParserRegistration::ActionParserRegistration()
+ActionParserRegistration::ActionParserRegistration() : m_cardElementParsers{GetBuiltInParsers()}, m_revision{0}
 {
-    m_knownElements.insert({
+}
+
+const std::unordered_set<std::string>& ActionParserRegistration::GetKnownElements()
+{
+    static const std::unordered_set<std::string> knownElements{
         ActionTypeToString(ActionType::Execute),
         ActionTypeToString(ActionType::OpenUrl),
         ActionTypeToString(ActionType::ShowCard),
         ActionTypeToString(ActionType::Submit),
         ActionTypeToString(ActionType::ToggleVisibility),
-        ActionTypeToString(ActionType::UnknownAction),
-    });
+        ActionTypeToString(ActionType::UnknownAction)};
+    return knownElements;
+}
 
-    m_cardElementParsers.insert(
-        {{ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
-         {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-         {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-         {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-         {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-         {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+// Why do we wrap the parsers? As we parse elements, we need to push and pop state from the stack for ID collision
+// detection. We *could* do this within the implementation of parsers themselves, but that would mean having to explain
+// all of this to custom element parser implementors. Instead, we wrap every parser we hand out with a helper class that
+// performs the push/pop on behalf of the element parser. For more details, refer to the giant comment on ID collision
+// detection in ParseContext.cpp.
+//
+// GetParser is called for every element of every card, so parsers are wrapped once, when they're registered. The
+// built-in parsers hold no state, so they're wrapped once per process and shared by every registration.
+const ActionParserRegistration::ParserMap& ActionParserRegistration::GetBuiltInParsers()
+{
+    static const ParserMap builtInParsers{
+        {ActionTypeToString(ActionType::Execute), MakeWrappedParser<ExecuteActionParser>()},
+        {ActionTypeToString(ActionType::OpenUrl), MakeWrappedParser<OpenUrlActionParser>()},
+        {ActionTypeToString(ActionType::ShowCard), MakeWrappedParser<ShowCardActionParser>()},
+        {ActionTypeToString(ActionType::Submit), MakeWrappedParser<SubmitActionParser>()},
+        {ActionTypeToString(ActionType::ToggleVisibility), MakeWrappedParser<ToggleVisibilityActionParser>()},
+        {ActionTypeToString(ActionType::UnknownAction), MakeWrappedParser<UnknownActionParser>()}};
+    return builtInParsers;
 }
 
 void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
 {
     // make sure caller isn't attempting to overwrite a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (GetKnownElements().find(elementType) == GetKnownElements().end())
     {
-        ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+        ActionParserRegistration::m_cardElementParsers[elementType] = std::make_shared<ActionElementParserWrapper>(parser);
+        m_revision = NextRevision();
     }
     else
     {
@@ -72,9 +106,10 @@ void ActionParserRegistration::AddParser(std::string const& elementType, std::sh
 void ActionParserRegistration::RemoveParser(std::string const& elementType)
 {
     // make sure caller isn't attempting to remove a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (GetKnownElements().find(elementType) == GetKnownElements().end())
     {
         ActionParserRegistration::m_cardElementParsers.erase(elementType);
+        m_revision = NextRevision();
     }
     else
     {
@@ -88,17 +123,16 @@ std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::st
     auto parser = m_cardElementParsers.find(elementType);
     if (parser != ActionParserRegistration::m_cardElementParsers.end())
     {
-        // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
-        // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<ActionElementParser> wrappedParser = std::make_shared<ActionElementParserWrapper>(parser->second);
-        return wrappedParser;
+        return parser->second;
     }
     else
     {
         return std::shared_ptr<ActionElementParser>(nullptr);
     }
 }
+
+std::uint64_t ActionParserRegistration::GetRevision() const
+{
+    return m_revision;
+}
 } // namespace AdaptiveCards
@@ -0,0 +1,422 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "AdaptiveCardTemplate.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "TemplateExpression.h"
+
+using namespace AdaptiveCards;
+
+namespace AdaptiveCards
+{
+struct AdaptiveCardTemplate::Node
+{
+    enum class Kind
+    {
+        // json without any binding, which expands to itself
+        Constant,
+        // a string that's exactly "${expression}", which expands to the value of the expression
+        Expression,
+        // a string with literal text and expressions, which expands to a string
+        String,
+        Array,
+        Object,
+    };
+
+    // A piece of a String node: literal text, or an expression whose text is shown if it can't be evaluated
+    struct StringPart
+    {
+        std::string literal;
+        std::unique_ptr<TemplateExpression> expression;
+    };
+
+    explicit Node(Kind kind) : kind(kind) {}
+
+    Kind kind;
+    Json::Value constant;
+    std::unique_ptr<TemplateExpression> expression;
+    std::vector<StringPart> parts;
+    std::vector<std::unique_ptr<Node>> items;
+    std::vector<std::pair<std::string, std::unique_ptr<Node>>> members;
+    // $data and $when of an Object
+    std::unique_ptr<Node> data;
+    std::unique_ptr<Node> when;
+};
+} // namespace AdaptiveCards
+
+namespace
+{
+using Node = AdaptiveCardTemplate::Node;
+using NodeKind = AdaptiveCardTemplate::Node::Kind;
+using Warnings = std::vector<std::shared_ptr<AdaptiveCardParseWarning>>;
+
+constexpr const char* dataKey = "$data";
+constexpr const char* whenKey = "$when";
+
+// Keys that bind the template rather than being part of the card
+bool IsReservedKey(const std::string& key)
+{
+    return key == dataKey || key == whenKey || key == "$root" || key == "$index" || key == "$host" || key == "$_acTemplateVersion";
+}
+
+// The position just past the "}" that closes the "${" at text[begin], or npos if it isn't closed. Braces and quotes
+// within the expression are skipped over.
+size_t FindExpressionEnd(const std::string& text, size_t begin)
+{
+    size_t depth = 0;
+    char quote = 0;
+    for (size_t i = begin + 1; i < text.size(); ++i)
+    {
+        const char c = text[i];
+        if (quote)
+        {
+            if (c == '\\')
+            {
+                ++i;
+            }
+            else if (c == quote)
+            {
+                quote = 0;
+            }
+        }
+        else if (c == '\'' || c == '"')
+        {
+            quote = c;
+        }
+        else if (c == '{')
+        {
+            ++depth;
+        }
+        else if (c == '}' && --depth == 0)
+        {
+            return i + 1;
+        }
+    }
+    return std::string::npos;
+}
+
+std::unique_ptr<Node> MakeConstant(const Json::Value& json)
+{
+    auto node = std::make_unique<Node>(NodeKind::Constant);
+    node->constant = json;
+    return node;
+}
+
+std::unique_ptr<Node> CompileString(const Json::Value& json)
+{
+    const std::string text = json.asString();
+    std::vector<Node::StringPart> parts;
+    std::string literal;
+    bool hasExpression = false;
+
+    for (size_t position = 0; position < text.size();)
+    {
+        const size_t begin = text.find("${", position);
+        const size_t end = begin == std::string::npos ? std::string::npos : FindExpressionEnd(text, begin);
+        if (end == std::string::npos)
+        {
+            literal.append(text, position, std::string::npos);
+            break;
+        }
+
+        literal.append(text, position, begin - position);
+        try
+        {
+            auto expression = std::make_unique<TemplateExpression>(std::string_view(text).substr(begin + 2, end - begin - 3));
+            if (!literal.empty())
+            {
+                parts.push_back({std::move(literal), nullptr});
+                literal.clear();
+            }
+            parts.push_back({std::string(), std::move(expression)});
+            hasExpression = true;
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+            // The templating library leaves what it can't parse in the card
+            literal.append(text, begin, end - begin);
+        }
+        position = end;
+    }
+
+    if (!hasExpression)
+    {
+        return MakeConstant(json);
+    }
+    if (!literal.empty())
+    {
+        parts.push_back({std::move(literal), nullptr});
+    }
+
+    if (parts.size() == 1)
+    {
+        auto node = std::make_unique<Node>(NodeKind::Expression);
+        node->expression = std::move(parts[0].expression);
+        return node;
+    }
+
+    auto node = std::make_unique<Node>(NodeKind::String);
+    node->parts = std::move(parts);
+    return node;
+}
+
+std::unique_ptr<Node> Compile(const Json::Value& json)
+{
+    if (json.isString())
+    {
+        return CompileString(json);
+    }
+
+    if (json.isArray())
+    {
+        auto node = std::make_unique<Node>(NodeKind::Array);
+        bool isConstant = true;
+        for (const auto& item : json)
+        {
+            node->items.push_back(Compile(item));
+            isConstant = isConstant && node->items.back()->kind == NodeKind::Constant;
+        }
+        return isConstant ? MakeConstant(json) : std::move(node);
+    }
+
+    if (json.isObject())
+    {
+        auto node = std::make_unique<Node>(NodeKind::Object);
+        bool isConstant = true;
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            const std::string key = it.name();
+            if (key == dataKey)
+            {
+                node->data = Compile(*it);
+            }
+            else if (key == whenKey)
+            {
+                node->when = Compile(*it);
+            }
+            else if (!IsReservedKey(key))
+            {
+                node->members.emplace_back(key, Compile(*it));
+                isConstant = isConstant && node->members.back().second->kind == NodeKind::Constant;
+                continue;
+            }
+            isConstant = false;
+        }
+        return isConstant ? MakeConstant(json) : std::move(node);
+    }
+
+    return MakeConstant(json);
+}
+
+class TemplateExpander
+{
+public:
+    TemplateExpander(const Json::Value& root, const Json::Value& host, Warnings& warnings) :
+        m_root(root), m_host(host), m_warnings(warnings)
+    {
+    }
+
+    Json::Value ExpandRoot(const Node& node)
+    {
+        return Expand(node, {&m_root, &m_host, &m_root, nullptr});
+    }
+
+private:
+    // The value of node's expression, or nothing if it can't be evaluated or is a path that isn't in the data, in
+    // which case the template shows the expression as it's written
+    std::optional<TemplateValue> Evaluate(const TemplateExpression& expression, const TemplateScope& scope)
+    {
+        try
+        {
+            TemplateValue value = expression.Evaluate(scope);
+            if (!value.IsReference() && value.Get().isNull() && expression.IsPath())
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            m_warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidValue, "Unable to evaluate ${" + expression.GetText() + "}: " + e.GetReason()));
+            return std::nullopt;
+        }
+    }
+
+    Json::Value Expand(const Node& node, const TemplateScope& scope)
+    {
+        switch (node.kind)
+        {
+        case NodeKind::Constant:
+            return node.constant;
+
+        case NodeKind::Expression:
+        {
+            auto value = Evaluate(*node.expression, scope);
+            return value ? value->Take() : Json::Value("${" + node.expression->GetText() + "}");
+        }
+
+        case NodeKind::String:
+        {
+            std::string text;
+            for (const auto& part : node.parts)
+            {
+                if (!part.expression)
+                {
+                    text += part.literal;
+                    continue;
+                }
+
+                const auto value = Evaluate(*part.expression, scope);
+                text += value ? TemplateExpression::ToString(value->Get()) : "${" + part.expression->GetText() + "}";
+            }
+            return text;
+        }
+
+        case NodeKind::Array:
+        {
+            Json::Value items(Json::arrayValue);
+            for (const auto& item : node.items)
+            {
+                if (item->kind == NodeKind::Object)
+                {
+                    ExpandObject(*item, scope, items);
+                }
+                else
+                {
+                    items.append(Expand(*item, scope));
+                }
+            }
+            return items;
+        }
+
+        case NodeKind::Object:
+        {
+            Json::Value results(Json::arrayValue);
+            ExpandObject(node, scope, results);
+            return results.size() == 1 ? std::move(results[0]) : results.empty() ? Json::Value() : std::move(results);
+        }
+        }
+        return Json::Value();
+    }
+
+    // Appends what node expands to, which is nothing, one object or one for each item of its $data, to results
+    void ExpandObject(const Node& node, const TemplateScope& scope, Json::Value& results)
+    {
+        if (!node.data)
+        {
+            ExpandObjectWithData(node, scope, results);
+            return;
+        }
+
+        // $data is evaluated in the scope of the object's parent. One the template leaves as written, such as a path
+        // that isn't in the data, binds the object to its text as the templating library does.
+        std::optional<TemplateValue> data;
+        if (node.data->kind != NodeKind::Expression)
+        {
+            data.emplace(Expand(*node.data, scope));
+        }
+        else if (!(data = Evaluate(*node.data->expression, scope)))
+        {
+            data.emplace(Json::Value("${" + node.data->expression->GetText() + "}"));
+        }
+
+        const Json::Value& value = data->Get();
+        if (value.isArray())
+        {
+            for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+            {
+                const Json::Value index(i);
+                ExpandObjectWithData(node, {scope.root, scope.host, &value[i], &index}, results);
+            }
+        }
+        else
+        {
+            ExpandObjectWithData(node, {scope.root, scope.host, &value, scope.index}, results);
+        }
+    }
+
+    void ExpandObjectWithData(const Node& node, const TemplateScope& scope, Json::Value& results)
+    {
+        if (node.when && !IsIncluded(*node.when, scope))
+        {
+            return;
+        }
+
+        Json::Value object(Json::objectValue);
+        for (const auto& [key, member] : node.members)
+        {
+            Json::Value value = Expand(*member, scope);
+            // An object that expands to nothing takes its key with it
+            if (member->kind != NodeKind::Object || !value.isNull())
+            {
+                object[key] = std::move(value);
+            }
+        }
+        results.append(std::move(object));
+    }
+
+    bool IsIncluded(const Node& when, const TemplateScope& scope)
+    {
+        if (when.kind == NodeKind::Expression)
+        {
+            const auto value = Evaluate(*when.expression, scope);
+            return value && value->Get().isBool() && value->Get().asBool();
+        }
+        if (when.kind == NodeKind::Constant && when.constant.isBool())
+        {
+            return when.constant.asBool();
+        }
+
+        m_warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
+            WarningStatusCode::InvalidValue, "$when must be a boolean or a ${...} expression; the object is left out"));
+        return false;
+    }
+
+    const Json::Value& m_root;
+    const Json::Value& m_host;
+    Warnings& m_warnings;
+};
+} // namespace
+
+namespace AdaptiveCards
+{
+AdaptiveCardTemplate::AdaptiveCardTemplate(const std::string& jsonString) :
+    AdaptiveCardTemplate(ParseUtil::GetJsonValueFromString(jsonString))
+{
+}
+
+AdaptiveCardTemplate::AdaptiveCardTemplate(const char* jsonString) : AdaptiveCardTemplate(std::string(jsonString))
+{
+}
+
+AdaptiveCardTemplate::AdaptiveCardTemplate(const Json::Value& json) : m_root(Compile(json))
+{
+}
+
+AdaptiveCardTemplate::~AdaptiveCardTemplate() = default;
+
+Json::Value AdaptiveCardTemplate::Expand(const Json::Value& data, const Json::Value& host) const
+{
+    Warnings warnings;
+    return Expand(data, host, warnings);
+}
+
+Json::Value AdaptiveCardTemplate::Expand(const Json::Value& data, const Json::Value& host, Warnings& warnings) const
+{
+    return TemplateExpander(data, host, warnings).ExpandRoot(*m_root);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCardTemplate::ExpandToCard(const Json::Value& data, const std::string& rendererVersion, ParseContext& context) const
+{
+    const Json::Value json = Expand(data, Json::Value(), context.warnings);
+    return AdaptiveCard::Deserialize(json, rendererVersion, context);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCardTemplate::ExpandToCard(const Json::Value& data, const std::string& rendererVersion) const
+{
+    ParseContext context;
+    return ExpandToCard(data, rendererVersion, context);
+}
+} // namespace AdaptiveCards
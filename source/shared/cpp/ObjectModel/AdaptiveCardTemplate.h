@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "AdaptiveCardParseWarning.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+
+namespace AdaptiveCards
+{
+// A card template with ${...} data binding, compiled once so that it can be expanded against any number of data
+// objects without parsing its json or its expressions again. Expansion follows the adaptivecards-templating
+// library: $data binds a new data context and repeats an object for each item of an array (setting $index), $when
+// drops an object unless it evaluates to true, a string that is exactly "${expression}" becomes the value of the
+// expression and any other string gets its expressions replaced with their text. A path that isn't in the data is
+// left as written. The expressions are those TemplateExpression supports.
+//
+// Expand and ExpandToCard don't change the template, so one template can be expanded on several threads at once.
+class AdaptiveCardTemplate
+{
+public:
+    // Throws an AdaptiveCardParseException if jsonString isn't json. Expressions that don't parse are left in the
+    // template as they're written.
+    explicit AdaptiveCardTemplate(const std::string& jsonString);
+    explicit AdaptiveCardTemplate(const char* jsonString);
+    explicit AdaptiveCardTemplate(const Json::Value& json);
+    ~AdaptiveCardTemplate();
+
+    AdaptiveCardTemplate(const AdaptiveCardTemplate&) = delete;
+    AdaptiveCardTemplate& operator=(const AdaptiveCardTemplate&) = delete;
+
+    // Expands the template against data, which is $root, and host, which is $host. Expressions that fail to
+    // evaluate are left as they're written and give a warning.
+    Json::Value Expand(const Json::Value& data, const Json::Value& host = Json::Value()) const;
+    Json::Value Expand(const Json::Value& data, const Json::Value& host, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings) const;
+
+    // Expands the template against data and parses the card it gives, as AdaptiveCard::Deserialize does. The
+    // warnings of the expansion come first in the result's warnings.
+    std::shared_ptr<ParseResult> ExpandToCard(const Json::Value& data, const std::string& rendererVersion, ParseContext& context) const;
+    std::shared_ptr<ParseResult> ExpandToCard(const Json::Value& data, const std::string& rendererVersion) const;
+
+    struct Node;
+
+private:
+    std::unique_ptr<Node> m_root;
+};
+} // namespace AdaptiveCards
@@ -155,14 +155,16 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ActionRole)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::IconUrl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Mode,
+         AdaptiveCardSchemaKey::Tooltip,
+         AdaptiveCardSchemaKey::IsEnabled,
+         AdaptiveCardSchemaKey::ActionRole});
+    m_knownProperties = &knownProperties;
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -201,8 +203,8 @@ void BaseActionElement::DeserializeBaseProperties(ParseContext& context, const J
     element->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
     element->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
     element->SetStyle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Style, defaultStyle, false));
-    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeFromString));
+    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeTryFromString));
     element->SetTooltip(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Tooltip));
     element->SetIsEnabled(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsEnabled, true));
-    element->SetRole(ParseUtil::GetEnumValue<ActionRole>(json, AdaptiveCardSchemaKey::ActionRole, ActionRole::Button, ActionRoleFromString));
+    element->SetRole(ParseUtil::GetEnumValue<ActionRole>(json, AdaptiveCardSchemaKey::ActionRole, ActionRole::Button, ActionRoleTryFromString));
 }
@@ -27,12 +27,14 @@ BaseCardElement::BaseCardElement(CardElementType type) :
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::IsVisible,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Separator,
+         AdaptiveCardSchemaKey::Spacing});
+    m_knownProperties = &knownProperties;
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -154,8 +156,8 @@ void BaseCardElement::DeserializeBaseProperties(ParseContext& context, const Jso
 
     element->DeserializeBase<BaseCardElement>(context, json);
     element->SetCanFallbackToAncestor(context.GetCanFallbackToAncestor());
-    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString));
+    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString));
     element->SetIsVisible(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsVisible, true));
     element->SetSeparator(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Separator, false));
-    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString));
+    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingTryFromString));
 }
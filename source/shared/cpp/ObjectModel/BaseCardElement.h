@@ -9,6 +9,7 @@
 #include "Separator.h"
 #include "RemoteResourceInformation.h"
 
+void HandleUnknownProperties(const Json::Value& json, const AdaptiveCards::KnownPropertiesSet& knownProperties, Json::Value& unknownProperties);
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
 
 namespace AdaptiveCards
@@ -67,12 +68,12 @@ private:
 template <typename T>
 std::shared_ptr<T> BaseCardElement::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> cardElement = std::make_shared<T>();
+    std::shared_ptr<T> cardElement = context.MakeShared<T>();
     std::shared_ptr<BaseCardElement> baseCardElement = std::static_pointer_cast<BaseCardElement>(cardElement);
     DeserializeBaseProperties(context, json, baseCardElement);
 
     // Walk all properties and put any unknown ones in the additional properties json
-    HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
+    HandleUnknownProperties(json, *baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
 
     return cardElement;
 }
@@ -8,7 +8,8 @@
 
 namespace AdaptiveCards
 {
-unsigned int InternalId::s_currentInternalId = 1;
+std::atomic<unsigned int> InternalId::s_nextInternalId{2};
+thread_local unsigned int InternalId::s_currentInternalId = 1;
 
 InternalId InternalId::Current()
 {
@@ -18,14 +19,15 @@ InternalId InternalId::Current()
 
 InternalId InternalId::Next()
 {
-    s_currentInternalId++;
+    unsigned int nextInternalId = s_nextInternalId.fetch_add(1, std::memory_order_relaxed);
 
     // handle overflow case
-    if (s_currentInternalId == InternalId::Invalid)
+    if (nextInternalId == InternalId::Invalid)
     {
-        s_currentInternalId++;
+        nextInternalId = s_nextInternalId.fetch_add(1, std::memory_order_relaxed);
     }
 
+    s_currentInternalId = nextInternalId;
     return Current();
 }
 
@@ -72,11 +74,10 @@ void BaseElement::SetElementTypeString(const std::string& value)
 
 void BaseElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        KnownPropertiesSet{},
+        {AdaptiveCardSchemaKey::Fallback, AdaptiveCardSchemaKey::Id, AdaptiveCardSchemaKey::Requires, AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
 
 const Json::Value& BaseElement::GetAdditionalProperties() const
@@ -98,25 +99,11 @@ bool BaseElement::MeetsRequirements(const AdaptiveCards::FeatureRegistration& fe
 {
     for (const auto& requirement : m_requires)
     {
-        // special case for adaptive cards version
-        const auto& requirementName = requirement.first;
-        const auto& requirementVersion = requirement.second;
-        const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
-        if (featureVersion.empty())
+        if (!featureRegistration.ProvidesFeature(requirement.first, requirement.second))
         {
-            // host doesn't provide this requirement
+            // host doesn't provide this requirement, or its provided version is too low
             return false;
         }
-        else
-        {
-            // host provides this requirement, but does it provide an acceptible version?
-            const SemanticVersion providesVersion{featureVersion};
-            if (providesVersion < requirementVersion)
-            {
-                // host's provided version is too low
-                return false;
-            }
-        }
     }
 
     return true;
@@ -153,7 +140,7 @@ Json::Value BaseElement::SerializeToJsonValue() const
     }
     else if (m_fallbackType == FallbackType::Content)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = m_fallbackContent->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = GetFallbackContent()->SerializeToJsonValue();
     }
 
     // Handle requires
@@ -179,7 +166,7 @@ void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>&
 
 void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
 {
-    const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+    const auto& requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
     if (!requiresValue.isNull())
     {
         if (requiresValue.isObject())
@@ -194,21 +181,16 @@ void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& js
                 if (memberValue == "*")
                 {
                     // * means any version.
-                    m_requires.emplace(memberName, "0");
+                    m_requires.emplace(memberName, SemanticVersion(0, 0, 0, 0));
+                }
+                else if (const auto memberVersion = SemanticVersion::TryParse(memberValue))
+                {
+                    m_requires.emplace(memberName, memberVersion.value());
                 }
                 else
                 {
-                    try
-                    {
-                        SemanticVersion memberVersion(memberValue);
-                        m_requires.emplace(memberName, memberVersion);
-                    }
-                    catch (const AdaptiveCardParseException&)
-                    {
-                        throw AdaptiveCardParseException(
-                            ErrorStatusCode::InvalidPropertyValue,
-                            "Invalid version in requires value: '" + memberValue + "'");
-                    }
+                    throw AdaptiveCardParseException(
+                        ErrorStatusCode::InvalidPropertyValue, "Invalid version in requires value: '" + memberValue + "'");
                 }
             }
             return;
@@ -4,7 +4,9 @@
 
 #include "pch.h"
 #include "json/json.h"
+#include "DeferredContent.h"
 #include "InternalId.h"
+#include "KnownProperties.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
@@ -17,12 +19,15 @@ namespace AdaptiveCards
 class ParseContext;
 #endif
 class FeatureRegistration;
+class BaseActionElement;
 
 class BaseElement
 {
+    friend class CardSnapshot;
+
 public:
     BaseElement() :
-        m_typeString{}, m_additionalProperties{}, m_requires{},
+        m_typeString{}, m_knownProperties(nullptr), m_additionalProperties{}, m_requires{},
         m_fallbackContent(nullptr), m_id{}, m_internalId{InternalId::Current()}, m_fallbackType(FallbackType::None),
         m_canFallbackToAncestor(false)
     {
@@ -63,9 +68,10 @@ public:
     {
         return m_fallbackType;
     }
+    // Parses the fallback content first, if its parse was deferred (see ParseContext::SetDeferNestedContent)
     const std::shared_ptr<BaseElement>& GetFallbackContent() const
     {
-        return m_fallbackContent;
+        return m_deferredFallbackContent ? m_deferredFallbackContent->Get() : m_fallbackContent;
     }
     bool CanFallbackToAncestor() const
     {
@@ -77,6 +83,7 @@ public:
     }
     void SetFallbackContent(std::shared_ptr<BaseElement> element)
     {
+        m_deferredFallbackContent.reset();
         m_fallbackContent = std::move(element);
     }
 
@@ -103,7 +110,7 @@ protected:
     }
 
     std::string m_typeString;
-    std::unordered_set<std::string> m_knownProperties;
+    const KnownPropertiesSet* m_knownProperties;
     Json::Value m_additionalProperties;
 
 private:
@@ -114,6 +121,7 @@ private:
 
     std::unordered_map<std::string, AdaptiveCards::SemanticVersion> m_requires;
     std::shared_ptr<BaseElement> m_fallbackContent;
+    std::shared_ptr<DeferredContent<BaseElement>> m_deferredFallbackContent;
     std::string m_id;
     InternalId m_internalId;
     FallbackType m_fallbackType;
@@ -135,7 +143,7 @@ void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json
 template <typename T>
 void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
 {
-    const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    const auto& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
     if (!fallbackValue.empty())
     {
         // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
@@ -157,6 +165,33 @@ void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
             // fallback value is a JSON object. parse it and add it as fallback content. For more details, refer to
             // the giant comment on ID collision detection in ParseContext.cpp.
             context.PushElement(GetId(), GetInternalId(), true /*isFallback*/);
+            if (DeferredContentIds::IsDeferring(context))
+            {
+                if constexpr (std::is_same_v<T, BaseActionElement>)
+                {
+                    DeferredContentIds::ScanAction(context, fallbackValue);
+                }
+                else
+                {
+                    DeferredContentIds::ScanElement(context, fallbackValue);
+                }
+                context.PopElement();
+
+                m_fallbackType = FallbackType::Content;
+                m_deferredFallbackContent = std::make_shared<DeferredContent<BaseElement>>(
+                    context, fallbackValue, [](ParseContext& fallbackContext, const Json::Value& json) {
+                        std::shared_ptr<BaseElement> fallbackElement;
+                        T::ParseJsonObject(fallbackContext, json, fallbackElement);
+                        if (!fallbackElement)
+                        {
+                            throw AdaptiveCardParseException(
+                                ErrorStatusCode::InvalidPropertyValue, "Fallback content did not parse correctly.");
+                        }
+                        return fallbackElement;
+                    });
+                return;
+            }
+
             std::shared_ptr<BaseElement> fallbackElement;
             T::ParseJsonObject(context, fallbackValue, fallbackElement);
             context.PopElement();
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardArena.h"
+
+namespace AdaptiveCards
+{
+void* CardArena::Allocate(size_t size, size_t alignment)
+{
+    if (void* allocation = std::align(alignment, size, m_current, m_remaining))
+    {
+        m_current = static_cast<std::byte*>(m_current) + size;
+        m_remaining -= size;
+        return allocation;
+    }
+
+    const size_t blockSize = std::max(BlockSize, size + alignment);
+    m_blocks.emplace_back(new std::byte[blockSize]);
+    m_reservedSize += blockSize;
+
+    void* block = m_blocks.back().get();
+    size_t blockRemaining = blockSize;
+    void* allocation = std::align(alignment, size, block, blockRemaining);
+    block = static_cast<std::byte*>(block) + size;
+    blockRemaining -= size;
+
+    // An allocation that takes up much of a block keeps its block to itself, so that what's left of the current block
+    // isn't abandoned for it
+    if (size <= BlockSize / 4)
+    {
+        m_current = block;
+        m_remaining = blockRemaining;
+    }
+    return allocation;
+}
+
+size_t CardArena::GetReservedSize() const
+{
+    return m_reservedSize;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A monotonic arena for the nodes of one parsed card. Allocations are carved out of large blocks and never freed one
+// by one; every block is released at once when the arena is destroyed. Allocating isn't thread safe, which is fine as
+// a card is parsed on a single thread.
+class CardArena
+{
+public:
+    CardArena() = default;
+    CardArena(const CardArena&) = delete;
+    CardArena& operator=(const CardArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment);
+
+    // The bytes of all blocks the arena holds
+    size_t GetReservedSize() const;
+
+private:
+    static constexpr size_t BlockSize = 16 * 1024;
+
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    size_t m_reservedSize{0};
+    void* m_current{nullptr};
+    size_t m_remaining{0};
+};
+
+// Allocates from a CardArena, and keeps the arena alive for as long as anything it allocated. Given to
+// std::allocate_shared, both a node and its control block live in the arena, and the arena is destroyed along with the
+// last of its card's nodes.
+template <typename T>
+class CardArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit CardArenaAllocator(std::shared_ptr<CardArena> arena) noexcept : m_arena(std::move(arena)) {}
+
+    template <typename U>
+    CardArenaAllocator(const CardArenaAllocator<U>& other) noexcept : m_arena(other.GetArena())
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept
+    {
+        // released with the arena
+    }
+
+    const std::shared_ptr<CardArena>& GetArena() const noexcept
+    {
+        return m_arena;
+    }
+
+private:
+    std::shared_ptr<CardArena> m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(const CardArenaAllocator<T>& lhs, const CardArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.GetArena() == rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const CardArenaAllocator<T>& lhs, const CardArenaAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+} // namespace AdaptiveCards
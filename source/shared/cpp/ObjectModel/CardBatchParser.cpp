@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardBatchParser.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+#include <atomic>
+#include <future>
+
+namespace AdaptiveCards
+{
+BatchParseResult::BatchParseResult(std::shared_ptr<ParseResult> parseResult) : m_parseResult(std::move(parseResult))
+{
+}
+
+BatchParseResult::BatchParseResult(std::exception_ptr error) : m_error(std::move(error))
+{
+}
+
+bool BatchParseResult::Succeeded() const
+{
+    return m_parseResult != nullptr;
+}
+
+std::shared_ptr<ParseResult> BatchParseResult::GetParseResult() const
+{
+    return m_parseResult;
+}
+
+std::exception_ptr BatchParseResult::GetError() const
+{
+    return m_error;
+}
+
+CardBatchParser::CardBatchParser(std::string rendererVersion, const ParseContext& context) :
+    m_rendererVersion(std::move(rendererVersion)),
+    m_cardContext(context.CreateSettingsCopy()), m_maxThreads(1)
+{
+}
+
+unsigned int CardBatchParser::GetMaxThreads() const
+{
+    return m_maxThreads;
+}
+
+void CardBatchParser::SetMaxThreads(unsigned int value)
+{
+    m_maxThreads = std::max(value, 1u);
+}
+
+std::vector<BatchParseResult> CardBatchParser::Deserialize(const std::vector<std::string_view>& jsonStrings) const
+{
+    const size_t cardCount = jsonStrings.size();
+    const size_t threadCount = std::min<size_t>(m_maxThreads, cardCount);
+    if (threadCount < 2)
+    {
+        std::vector<BatchParseResult> results;
+        results.reserve(cardCount);
+        for (const auto& jsonString : jsonStrings)
+        {
+            results.push_back(DeserializeCard(jsonString));
+        }
+        return results;
+    }
+
+    // Cards vary a lot in size, so threads take the next card as they finish one rather than a fixed share
+    std::vector<std::optional<BatchParseResult>> results(cardCount);
+    std::atomic<size_t> nextCard{0};
+    const auto parseCards = [&]() {
+        for (size_t i = nextCard++; i < cardCount; i = nextCard++)
+        {
+            results[i].emplace(DeserializeCard(jsonStrings[i]));
+        }
+    };
+
+    // The calling thread parses cards too. If a thread can't be started, the others pick up its cards.
+    std::vector<std::future<void>> pending;
+    pending.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        try
+        {
+            pending.push_back(std::async(std::launch::async, parseCards));
+        }
+        catch (const std::system_error&)
+        {
+            break;
+        }
+    }
+    parseCards();
+    for (auto& thread : pending)
+    {
+        thread.wait();
+    }
+
+    std::vector<BatchParseResult> orderedResults;
+    orderedResults.reserve(cardCount);
+    for (auto& result : results)
+    {
+        orderedResults.push_back(std::move(result.value()));
+    }
+    return orderedResults;
+}
+
+BatchParseResult CardBatchParser::DeserializeCard(std::string_view jsonString) const
+{
+    try
+    {
+        ParseContext context{m_cardContext};
+        return BatchParseResult{AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), m_rendererVersion, context)};
+    }
+    catch (...)
+    {
+        return BatchParseResult{std::current_exception()};
+    }
+}
+} // namespace AdaptiveCards
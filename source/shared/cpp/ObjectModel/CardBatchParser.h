@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+
+namespace AdaptiveCards
+{
+// The outcome of parsing one card of a batch: its ParseResult, or the exception parsing it threw
+class BatchParseResult
+{
+public:
+    explicit BatchParseResult(std::shared_ptr<ParseResult> parseResult);
+    explicit BatchParseResult(std::exception_ptr error);
+
+    bool Succeeded() const;
+    // null if parsing the card threw
+    std::shared_ptr<ParseResult> GetParseResult() const;
+    // null if the card parsed; otherwise usually an AdaptiveCardParseException
+    std::exception_ptr GetError() const;
+
+private:
+    std::shared_ptr<ParseResult> m_parseResult;
+    std::exception_ptr m_error;
+};
+
+// Parses many cards with the same renderer version, parser registrations and settings, for hosts that validate or
+// ingest cards in bulk. The registrations are shared by every card of every batch instead of being created for each
+// card, as AdaptiveCard::DeserializeFromString(jsonString, rendererVersion) does, and every card is parsed with a
+// fresh ParseContext of its own, so the state one card leaves behind never affects another.
+//
+// Each card gives the same result as AdaptiveCard::DeserializeFromString. A card that fails to parse doesn't stop the
+// batch; its error is reported in its BatchParseResult instead.
+class CardBatchParser
+{
+public:
+    // Parses with the parser registrations and settings of context (see ParseContext::CreateSettingsCopy), so each
+    // card's body may be parsed on up to context.GetMaxParseThreads() threads of its own. context itself is never
+    // modified, but its registrations must not change while a batch is being parsed.
+    explicit CardBatchParser(std::string rendererVersion, const ParseContext& context = ParseContext());
+
+    // The most threads the cards of a batch are parsed on. 1, the default, parses them one after the other on the
+    // calling thread. Custom parsers must be safe to call concurrently when this is more than 1.
+    unsigned int GetMaxThreads() const;
+    void SetMaxThreads(unsigned int value);
+
+    // Parses every card in jsonStrings, any range of values convertible to std::string_view. The results are in
+    // the same order as jsonStrings.
+    template <typename JsonStrings>
+    std::vector<BatchParseResult> DeserializeFromStrings(const JsonStrings& jsonStrings) const
+    {
+        std::vector<std::string_view> jsonViews;
+        for (const auto& jsonString : jsonStrings)
+        {
+            jsonViews.emplace_back(jsonString);
+        }
+        return Deserialize(jsonViews);
+    }
+
+private:
+    std::vector<BatchParseResult> Deserialize(const std::vector<std::string_view>& jsonStrings) const;
+    BatchParseResult DeserializeCard(std::string_view jsonString) const;
+
+    std::string m_rendererVersion;
+    // Holds the registrations and settings of every card's context, and none of the state of a parse
+    ParseContext m_cardContext;
+    unsigned int m_maxThreads;
+};
+} // namespace AdaptiveCards
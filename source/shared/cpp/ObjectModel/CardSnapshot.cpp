@@ -0,0 +1,1453 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardSnapshot.h"
+
+#include "ActionSet.h"
+#include "AdaptiveCardParseWarning.h"
+#include "Authentication.h"
+#include "AuthCardButton.h"
+#include "BackgroundImage.h"
+#include "CaptionSource.h"
+#include "Carousel.h"
+#include "CarouselPage.h"
+#include "ChoiceInput.h"
+#include "ChoicesData.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "ExecuteAction.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "Refresh.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableColumnDefinition.h"
+#include "TableRow.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+#include "TokenExchangeResource.h"
+#include "UnknownAction.h"
+#include "UnknownElement.h"
+
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+// A snapshot is laid out as:
+//   "ACSN"                         magic
+//   u32 format version             little endian, as are the other u32s
+//   u32 string count n
+//   u32 string offsets[n + 1]      into the string data, so that string i is [offsets[i], offsets[i + 1])
+//   string data
+//   the warnings and the card, as a stream of values
+//
+// Values in the stream are varints (LEB128, zigzagged when signed), single bytes for bools, 8 little endian bytes
+// for doubles and string table indices for strings. Elements and actions start with their type plus one, or 0 when
+// there's none, and are followed by their properties in the order the Transfer functions below list them.
+
+namespace
+{
+constexpr char snapshotMagic[] = {'A', 'C', 'S', 'N'};
+constexpr size_t headerSize = sizeof(snapshotMagic) + 2 * sizeof(uint32_t);
+
+enum class JsonTag : uint8_t
+{
+    Null = 0,
+    False,
+    True,
+    Int,
+    UInt,
+    Real,
+    String,
+    Array,
+    Object,
+};
+
+template <typename T>
+struct TypeTag
+{
+    using Type = T;
+};
+
+template <typename T>
+struct IsOptional : std::false_type
+{
+};
+template <typename T>
+struct IsOptional<std::optional<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct IsSharedPtr : std::false_type
+{
+};
+template <typename T>
+struct IsSharedPtr<std::shared_ptr<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct IsVector : std::false_type
+{
+};
+template <typename T>
+struct IsVector<std::vector<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct DependentFalse : std::false_type
+{
+};
+
+// Calls function with the TypeTag of the class built-in elements of type are, returning false if there's none
+template <typename Function>
+bool VisitElementType(CardElementType type, Function&& function)
+{
+    switch (type)
+    {
+    case CardElementType::ActionSet:
+        function(TypeTag<ActionSet>());
+        return true;
+    case CardElementType::Carousel:
+        function(TypeTag<Carousel>());
+        return true;
+    case CardElementType::CarouselPage:
+        function(TypeTag<CarouselPage>());
+        return true;
+    case CardElementType::ChoiceSetInput:
+        function(TypeTag<ChoiceSetInput>());
+        return true;
+    case CardElementType::Column:
+        function(TypeTag<Column>());
+        return true;
+    case CardElementType::ColumnSet:
+        function(TypeTag<ColumnSet>());
+        return true;
+    case CardElementType::Container:
+        function(TypeTag<Container>());
+        return true;
+    case CardElementType::DateInput:
+        function(TypeTag<DateInput>());
+        return true;
+    case CardElementType::FactSet:
+        function(TypeTag<FactSet>());
+        return true;
+    case CardElementType::Image:
+        function(TypeTag<Image>());
+        return true;
+    case CardElementType::ImageSet:
+        function(TypeTag<ImageSet>());
+        return true;
+    case CardElementType::Media:
+        function(TypeTag<Media>());
+        return true;
+    case CardElementType::NumberInput:
+        function(TypeTag<NumberInput>());
+        return true;
+    case CardElementType::RichTextBlock:
+        function(TypeTag<RichTextBlock>());
+        return true;
+    case CardElementType::Table:
+        function(TypeTag<Table>());
+        return true;
+    case CardElementType::TableCell:
+        function(TypeTag<TableCell>());
+        return true;
+    case CardElementType::TableRow:
+        function(TypeTag<TableRow>());
+        return true;
+    case CardElementType::TextBlock:
+        function(TypeTag<TextBlock>());
+        return true;
+    case CardElementType::TextInput:
+        function(TypeTag<TextInput>());
+        return true;
+    case CardElementType::TimeInput:
+        function(TypeTag<TimeInput>());
+        return true;
+    case CardElementType::ToggleInput:
+        function(TypeTag<ToggleInput>());
+        return true;
+    case CardElementType::Unknown:
+        function(TypeTag<UnknownElement>());
+        return true;
+    default:
+        return false;
+    }
+}
+
+template <typename Function>
+bool VisitActionType(ActionType type, Function&& function)
+{
+    switch (type)
+    {
+    case ActionType::Execute:
+        function(TypeTag<ExecuteAction>());
+        return true;
+    case ActionType::OpenUrl:
+        function(TypeTag<OpenUrlAction>());
+        return true;
+    case ActionType::ShowCard:
+        function(TypeTag<ShowCardAction>());
+        return true;
+    case ActionType::Submit:
+        function(TypeTag<SubmitAction>());
+        return true;
+    case ActionType::ToggleVisibility:
+        function(TypeTag<ToggleVisibilityAction>());
+        return true;
+    case ActionType::UnknownAction:
+        function(TypeTag<UnknownAction>());
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The properties of each class, listed once for both saving and loading. archive.Property(get, set) writes what get
+// returns when saving and passes what it reads to set when loading; archive.Value(value) writes or reads value in
+// place.
+
+template <typename Archive, typename Object, typename Getter, typename Setter>
+void Property(Archive& archive, Object& object, Getter getter, Setter setter)
+{
+    archive.Property([&]() -> decltype(auto) { return (object.*getter)(); }, [&](auto&& value) { (object.*setter)(std::move(value)); });
+}
+
+// For properties whose setters are overloaded for strings
+template <typename Archive, typename Object, typename Getter>
+void Property(Archive& archive, Object& object, Getter getter, void (Object::*setter)(const std::string&))
+{
+    archive.Property([&]() -> decltype(auto) { return (object.*getter)(); }, [&](const std::string& value) { (object.*setter)(value); });
+}
+
+template <typename Archive>
+void TransferBaseElement(Archive& archive, BaseElement& element)
+{
+    Property(archive, element, &BaseElement::GetElementTypeString, &BaseElement::SetElementTypeString);
+    Property(archive, element, &BaseElement::GetId, &BaseElement::SetId);
+    archive.Property(
+        [&]() -> const Json::Value& { return element.GetAdditionalProperties(); },
+        [&](Json::Value&& value) { element.SetAdditionalProperties(std::move(value)); });
+    archive.Value(element.GetRequirements());
+    Property(archive, element, &BaseElement::GetFallbackType, &BaseElement::SetFallbackType);
+    archive.CanFallbackToAncestor(element);
+}
+
+// Fallback content is an element for elements and an action for actions
+template <typename Fallback, typename Archive>
+void TransferFallbackContent(Archive& archive, BaseElement& element)
+{
+    archive.Property(
+        [&]() { return std::static_pointer_cast<Fallback>(element.GetFallbackContent()); },
+        [&](std::shared_ptr<Fallback>&& content) { element.SetFallbackContent(std::move(content)); });
+}
+
+template <typename Archive>
+void TransferBaseCardElement(Archive& archive, BaseCardElement& element)
+{
+    TransferBaseElement(archive, element);
+    Property(archive, element, &BaseCardElement::GetSpacing, &BaseCardElement::SetSpacing);
+    Property(archive, element, &BaseCardElement::GetSeparator, &BaseCardElement::SetSeparator);
+    Property(archive, element, &BaseCardElement::GetHeight, &BaseCardElement::SetHeight);
+    Property(archive, element, &BaseCardElement::GetIsVisible, &BaseCardElement::SetIsVisible);
+    TransferFallbackContent<BaseCardElement>(archive, element);
+}
+
+template <typename Archive>
+void TransferBaseInputElement(Archive& archive, BaseInputElement& input)
+{
+    TransferBaseCardElement(archive, input);
+    Property(archive, input, &BaseInputElement::GetLabel, &BaseInputElement::SetLabel);
+    Property(archive, input, &BaseInputElement::GetIsRequired, &BaseInputElement::SetIsRequired);
+    Property(archive, input, &BaseInputElement::GetErrorMessage, &BaseInputElement::SetErrorMessage);
+}
+
+template <typename Archive>
+void TransferBaseActionElement(Archive& archive, BaseActionElement& action)
+{
+    TransferBaseElement(archive, action);
+    Property(archive, action, &BaseActionElement::GetTitle, &BaseActionElement::SetTitle);
+    Property(archive, action, &BaseActionElement::GetIconUrl, &BaseActionElement::SetIconUrl);
+    Property(archive, action, &BaseActionElement::GetStyle, &BaseActionElement::SetStyle);
+    Property(archive, action, &BaseActionElement::GetTooltip, &BaseActionElement::SetTooltip);
+    Property(archive, action, &BaseActionElement::GetMode, &BaseActionElement::SetMode);
+    Property(archive, action, &BaseActionElement::GetIsEnabled, &BaseActionElement::SetIsEnabled);
+    Property(archive, action, &BaseActionElement::GetRole, &BaseActionElement::SetRole);
+    TransferFallbackContent<BaseActionElement>(archive, action);
+}
+
+template <typename Archive>
+void TransferStyledCollectionElement(Archive& archive, StyledCollectionElement& collection)
+{
+    TransferBaseCardElement(archive, collection);
+    Property(archive, collection, &StyledCollectionElement::GetStyle, &StyledCollectionElement::SetStyle);
+    Property(archive, collection, &StyledCollectionElement::GetVerticalContentAlignment, &StyledCollectionElement::SetVerticalContentAlignment);
+    Property(archive, collection, &StyledCollectionElement::GetPadding, &StyledCollectionElement::SetPadding);
+    Property(archive, collection, &StyledCollectionElement::GetBleed, &StyledCollectionElement::SetBleed);
+    archive.BleedDirection(collection);
+    Property(archive, collection, &StyledCollectionElement::GetSelectAction, &StyledCollectionElement::SetSelectAction);
+    Property(archive, collection, &StyledCollectionElement::GetBackgroundImage, &StyledCollectionElement::SetBackgroundImage);
+    Property(archive, collection, &StyledCollectionElement::GetMinHeight, &StyledCollectionElement::SetMinHeight);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Container& container)
+{
+    TransferStyledCollectionElement(archive, container);
+    archive.Value(container.GetItems());
+    Property(archive, container, &Container::GetRtl, &Container::SetRtl);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Column& column)
+{
+    TransferStyledCollectionElement(archive, column);
+    // the pixel width is worked out from the width
+    Property(archive, column, &Column::GetWidth, &Column::SetWidth);
+    archive.Value(column.GetItems());
+    Property(archive, column, &Column::GetRtl, &Column::SetRtl);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ColumnSet& columnSet)
+{
+    TransferStyledCollectionElement(archive, columnSet);
+    Property(archive, columnSet, &ColumnSet::GetHorizontalAlignment, &ColumnSet::SetHorizontalAlignment);
+    archive.Value(columnSet.GetColumns());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Carousel& carousel)
+{
+    TransferStyledCollectionElement(archive, carousel);
+    archive.Value(carousel.GetPages());
+    Property(archive, carousel, &Carousel::GetHeightInPixels, &Carousel::SetHeightInPixels);
+    Property(archive, carousel, &Carousel::GetTimer, &Carousel::SetTimer);
+    Property(archive, carousel, &Carousel::GetInitialPage, &Carousel::SetInitialPage);
+    Property(archive, carousel, &Carousel::GetOrientation, &Carousel::SetOrientation);
+    Property(archive, carousel, &Carousel::GetAutoLoop, &Carousel::setAutoLoop);
+    Property(archive, carousel, &Carousel::GetRtl, &Carousel::SetRtl);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, CarouselPage& page)
+{
+    Transfer(archive, static_cast<Container&>(page));
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TableCell& cell)
+{
+    Transfer(archive, static_cast<Container&>(cell));
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TableColumnDefinition& column)
+{
+    Property(archive, column, &TableColumnDefinition::GetHorizontalCellContentAlignment, &TableColumnDefinition::SetHorizontalCellContentAlignment);
+    Property(archive, column, &TableColumnDefinition::GetVerticalCellContentAlignment, &TableColumnDefinition::SetVerticalCellContentAlignment);
+    // setting either width clears the other
+    archive.Property(
+        [&]() { return column.GetWidth(); },
+        [&](std::optional<unsigned int>&& width) {
+            if (width.has_value())
+            {
+                column.SetWidth(width);
+            }
+        });
+    archive.Property(
+        [&]() { return column.GetPixelWidth(); },
+        [&](std::optional<unsigned int>&& pixelWidth) {
+            if (pixelWidth.has_value())
+            {
+                column.SetPixelWidth(pixelWidth);
+            }
+        });
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TableRow& row)
+{
+    TransferBaseCardElement(archive, row);
+    archive.Value(row.GetCells());
+    Property(archive, row, &TableRow::GetVerticalCellContentAlignment, &TableRow::SetVerticalCellContentAlignment);
+    Property(archive, row, &TableRow::GetHorizontalCellContentAlignment, &TableRow::SetHorizontalCellContentAlignment);
+    Property(archive, row, &TableRow::GetStyle, &TableRow::SetStyle);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Table& table)
+{
+    TransferBaseCardElement(archive, table);
+    Property(archive, table, &Table::GetShowGridLines, &Table::SetShowGridLines);
+    Property(archive, table, &Table::GetFirstRowAsHeaders, &Table::SetFirstRowAsHeaders);
+    Property(archive, table, &Table::GetHorizontalCellContentAlignment, &Table::SetHorizontalCellContentAlignment);
+    Property(archive, table, &Table::GetVerticalCellContentAlignment, &Table::SetVerticalCellContentAlignment);
+    Property(archive, table, &Table::GetGridStyle, &Table::SetGridStyle);
+    archive.Value(table.GetColumns());
+    archive.Value(table.GetRows());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ActionSet& actionSet)
+{
+    TransferBaseCardElement(archive, actionSet);
+    archive.Value(actionSet.GetActions());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TextBlock& textBlock)
+{
+    TransferBaseCardElement(archive, textBlock);
+    Property(archive, textBlock, &TextBlock::GetText, &TextBlock::SetText);
+    Property(archive, textBlock, &TextBlock::GetStyle, &TextBlock::SetStyle);
+    Property(archive, textBlock, &TextBlock::GetTextSize, &TextBlock::SetTextSize);
+    Property(archive, textBlock, &TextBlock::GetTextWeight, &TextBlock::SetTextWeight);
+    Property(archive, textBlock, &TextBlock::GetFontType, &TextBlock::SetFontType);
+    Property(archive, textBlock, &TextBlock::GetTextColor, &TextBlock::SetTextColor);
+    Property(archive, textBlock, &TextBlock::GetWrap, &TextBlock::SetWrap);
+    Property(archive, textBlock, &TextBlock::GetIsSubtle, &TextBlock::SetIsSubtle);
+    Property(archive, textBlock, &TextBlock::GetMaxLines, &TextBlock::SetMaxLines);
+    Property(archive, textBlock, &TextBlock::GetHorizontalAlignment, &TextBlock::SetHorizontalAlignment);
+    Property(archive, textBlock, &TextBlock::GetLanguage, &TextBlock::SetLanguage);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TextRun& textRun)
+{
+    archive.Property(
+        [&]() -> const Json::Value& { return textRun.GetAdditionalProperties(); },
+        [&](Json::Value&& value) { textRun.SetAdditionalProperties(std::move(value)); });
+    Property(archive, textRun, &TextRun::GetText, &TextRun::SetText);
+    Property(archive, textRun, &TextRun::GetTextSize, &TextRun::SetTextSize);
+    Property(archive, textRun, &TextRun::GetTextWeight, &TextRun::SetTextWeight);
+    Property(archive, textRun, &TextRun::GetFontType, &TextRun::SetFontType);
+    Property(archive, textRun, &TextRun::GetTextColor, &TextRun::SetTextColor);
+    Property(archive, textRun, &TextRun::GetIsSubtle, &TextRun::SetIsSubtle);
+    Property(archive, textRun, &TextRun::GetItalic, &TextRun::SetItalic);
+    Property(archive, textRun, &TextRun::GetStrikethrough, &TextRun::SetStrikethrough);
+    Property(archive, textRun, &TextRun::GetHighlight, &TextRun::SetHighlight);
+    Property(archive, textRun, &TextRun::GetUnderline, &TextRun::SetUnderline);
+    Property(archive, textRun, &TextRun::GetLanguage, &TextRun::SetLanguage);
+    Property(archive, textRun, &TextRun::GetSelectAction, &TextRun::SetSelectAction);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, RichTextBlock& richTextBlock)
+{
+    TransferBaseCardElement(archive, richTextBlock);
+    Property(archive, richTextBlock, &RichTextBlock::GetHorizontalAlignment, &RichTextBlock::SetHorizontalAlignment);
+    archive.Value(richTextBlock.GetInlines());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Image& image)
+{
+    TransferBaseCardElement(archive, image);
+    Property(archive, image, &Image::GetUrl, &Image::SetUrl);
+    Property(archive, image, &Image::GetBackgroundColor, &Image::SetBackgroundColor);
+    Property(archive, image, &Image::GetImageStyle, &Image::SetImageStyle);
+    Property(archive, image, &Image::GetImageSize, &Image::SetImageSize);
+    Property(archive, image, &Image::GetAltText, &Image::SetAltText);
+    Property(archive, image, &Image::GetHorizontalAlignment, &Image::SetHorizontalAlignment);
+    Property(archive, image, &Image::GetSelectAction, &Image::SetSelectAction);
+    Property(archive, image, &Image::GetPixelWidth, &Image::SetPixelWidth);
+    Property(archive, image, &Image::GetPixelHeight, &Image::SetPixelHeight);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ImageSet& imageSet)
+{
+    TransferBaseCardElement(archive, imageSet);
+    Property(archive, imageSet, &ImageSet::GetImageSize, &ImageSet::SetImageSize);
+    archive.Value(imageSet.GetImages());
+}
+
+template <typename Archive>
+void TransferContentSource(Archive& archive, ContentSource& source)
+{
+    Property(archive, source, &ContentSource::GetMimeType, &ContentSource::SetMimeType);
+    Property(archive, source, &ContentSource::GetUrl, &ContentSource::SetUrl);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, MediaSource& source)
+{
+    TransferContentSource(archive, source);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, CaptionSource& source)
+{
+    TransferContentSource(archive, source);
+    Property(archive, source, &CaptionSource::GetLabel, &CaptionSource::SetLabel);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Media& media)
+{
+    TransferBaseCardElement(archive, media);
+    Property(archive, media, &Media::GetPoster, &Media::SetPoster);
+    Property(archive, media, &Media::GetAltText, &Media::SetAltText);
+    archive.Value(media.GetSources());
+    archive.Value(media.GetCaptionSources());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Fact& fact)
+{
+    Property(archive, fact, &Fact::GetTitle, &Fact::SetTitle);
+    Property(archive, fact, &Fact::GetValue, &Fact::SetValue);
+    Property(archive, fact, &Fact::GetLanguage, &Fact::SetLanguage);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, FactSet& factSet)
+{
+    TransferBaseCardElement(archive, factSet);
+    archive.Value(factSet.GetFacts());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TextInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &TextInput::GetPlaceholder, &TextInput::SetPlaceholder);
+    Property(archive, input, &TextInput::GetValue, &TextInput::SetValue);
+    Property(archive, input, &TextInput::GetIsMultiline, &TextInput::SetIsMultiline);
+    Property(archive, input, &TextInput::GetMaxLength, &TextInput::SetMaxLength);
+    Property(archive, input, &TextInput::GetTextInputStyle, &TextInput::SetTextInputStyle);
+    Property(archive, input, &TextInput::GetInlineAction, &TextInput::SetInlineAction);
+    Property(archive, input, &TextInput::GetRegex, &TextInput::SetRegex);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, NumberInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &NumberInput::GetPlaceholder, &NumberInput::SetPlaceholder);
+    Property(archive, input, &NumberInput::GetValue, &NumberInput::SetValue);
+    Property(archive, input, &NumberInput::GetMax, &NumberInput::SetMax);
+    Property(archive, input, &NumberInput::GetMin, &NumberInput::SetMin);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, DateInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &DateInput::GetMax, &DateInput::SetMax);
+    Property(archive, input, &DateInput::GetMin, &DateInput::SetMin);
+    Property(archive, input, &DateInput::GetPlaceholder, &DateInput::SetPlaceholder);
+    Property(archive, input, &DateInput::GetValue, &DateInput::SetValue);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TimeInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &TimeInput::GetMax, &TimeInput::SetMax);
+    Property(archive, input, &TimeInput::GetMin, &TimeInput::SetMin);
+    Property(archive, input, &TimeInput::GetPlaceholder, &TimeInput::SetPlaceholder);
+    Property(archive, input, &TimeInput::GetValue, &TimeInput::SetValue);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ToggleInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &ToggleInput::GetTitle, &ToggleInput::SetTitle);
+    Property(archive, input, &ToggleInput::GetValue, &ToggleInput::SetValue);
+    Property(archive, input, &ToggleInput::GetValueOff, &ToggleInput::SetValueOff);
+    Property(archive, input, &ToggleInput::GetValueOn, &ToggleInput::SetValueOn);
+    Property(archive, input, &ToggleInput::GetWrap, &ToggleInput::SetWrap);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ChoiceInput& choice)
+{
+    Property(archive, choice, &ChoiceInput::GetTitle, &ChoiceInput::SetTitle);
+    Property(archive, choice, &ChoiceInput::GetValue, &ChoiceInput::SetValue);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ChoicesData& choicesData)
+{
+    Property(archive, choicesData, &ChoicesData::GetChoicesDataType, &ChoicesData::SetChoicesDataType);
+    Property(archive, choicesData, &ChoicesData::GetDataset, &ChoicesData::SetDataset);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ChoiceSetInput& input)
+{
+    TransferBaseInputElement(archive, input);
+    Property(archive, input, &ChoiceSetInput::GetIsMultiSelect, &ChoiceSetInput::SetIsMultiSelect);
+    Property(archive, input, &ChoiceSetInput::GetChoiceSetStyle, &ChoiceSetInput::SetChoiceSetStyle);
+    archive.Value(input.GetChoices());
+    Property(archive, input, &ChoiceSetInput::GetChoicesData, &ChoiceSetInput::SetChoicesData);
+    Property(archive, input, &ChoiceSetInput::GetValue, &ChoiceSetInput::SetValue);
+    Property(archive, input, &ChoiceSetInput::GetWrap, &ChoiceSetInput::SetWrap);
+    Property(archive, input, &ChoiceSetInput::GetPlaceholder, &ChoiceSetInput::SetPlaceholder);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, UnknownElement& element)
+{
+    TransferBaseCardElement(archive, element);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, OpenUrlAction& action)
+{
+    TransferBaseActionElement(archive, action);
+    Property(archive, action, &OpenUrlAction::GetUrl, &OpenUrlAction::SetUrl);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ShowCardAction& action)
+{
+    TransferBaseActionElement(archive, action);
+    Property(archive, action, &ShowCardAction::GetCard, &ShowCardAction::SetCard);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, SubmitAction& action)
+{
+    TransferBaseActionElement(archive, action);
+    archive.Property([&]() { return action.GetDataJsonAsValue(); }, [&](const Json::Value& value) { action.SetDataJson(value); });
+    Property(archive, action, &SubmitAction::GetAssociatedInputs, &SubmitAction::SetAssociatedInputs);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ExecuteAction& action)
+{
+    TransferBaseActionElement(archive, action);
+    archive.Property([&]() { return action.GetDataJsonAsValue(); }, [&](const Json::Value& value) { action.SetDataJson(value); });
+    Property(archive, action, &ExecuteAction::GetVerb, &ExecuteAction::SetVerb);
+    Property(archive, action, &ExecuteAction::GetAssociatedInputs, &ExecuteAction::SetAssociatedInputs);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ToggleVisibilityTarget& target)
+{
+    Property(archive, target, &ToggleVisibilityTarget::GetElementId, &ToggleVisibilityTarget::SetElementId);
+    Property(archive, target, &ToggleVisibilityTarget::GetIsVisible, &ToggleVisibilityTarget::SetIsVisible);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, ToggleVisibilityAction& action)
+{
+    TransferBaseActionElement(archive, action);
+    archive.Value(action.GetTargetElements());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, UnknownAction& action)
+{
+    TransferBaseActionElement(archive, action);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, BackgroundImage& backgroundImage)
+{
+    Property(archive, backgroundImage, &BackgroundImage::GetUrl, &BackgroundImage::SetUrl);
+    Property(archive, backgroundImage, &BackgroundImage::GetFillMode, &BackgroundImage::SetFillMode);
+    Property(archive, backgroundImage, &BackgroundImage::GetHorizontalAlignment, &BackgroundImage::SetHorizontalAlignment);
+    Property(archive, backgroundImage, &BackgroundImage::GetVerticalAlignment, &BackgroundImage::SetVerticalAlignment);
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Refresh& refresh)
+{
+    archive.Property([&]() { return refresh.GetAction(); }, [&](std::shared_ptr<BaseActionElement>&& action) { refresh.SetAction(std::move(action)); });
+    archive.Value(refresh.GetUserIds());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, TokenExchangeResource& resource)
+{
+    archive.Property([&]() { return resource.GetId(); }, [&](std::string&& value) { resource.SetId(std::move(value)); });
+    archive.Property([&]() { return resource.GetUri(); }, [&](std::string&& value) { resource.SetUri(std::move(value)); });
+    archive.Property([&]() { return resource.GetProviderId(); }, [&](std::string&& value) { resource.SetProviderId(std::move(value)); });
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, AuthCardButton& button)
+{
+    archive.Property([&]() { return button.GetType(); }, [&](std::string&& value) { button.SetType(std::move(value)); });
+    archive.Property([&]() { return button.GetTitle(); }, [&](std::string&& value) { button.SetTitle(std::move(value)); });
+    archive.Property([&]() { return button.GetImage(); }, [&](std::string&& value) { button.SetImage(std::move(value)); });
+    archive.Property([&]() { return button.GetValue(); }, [&](std::string&& value) { button.SetValue(std::move(value)); });
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, Authentication& authentication)
+{
+    archive.Property([&]() { return authentication.GetText(); }, [&](std::string&& value) { authentication.SetText(std::move(value)); });
+    archive.Property(
+        [&]() { return authentication.GetConnectionName(); }, [&](std::string&& value) { authentication.SetConnectionName(std::move(value)); });
+    archive.Property(
+        [&]() { return authentication.GetTokenExchangeResource(); },
+        [&](std::shared_ptr<TokenExchangeResource>&& value) { authentication.SetTokenExchangeResource(std::move(value)); });
+    archive.Value(authentication.GetButtons());
+}
+
+template <typename Archive>
+void Transfer(Archive& archive, AdaptiveCard& card)
+{
+    Property(archive, card, &AdaptiveCard::GetVersion, &AdaptiveCard::SetVersion);
+    Property(archive, card, &AdaptiveCard::GetFallbackText, &AdaptiveCard::SetFallbackText);
+    Property(archive, card, &AdaptiveCard::GetBackgroundImage, &AdaptiveCard::SetBackgroundImage);
+    Property(archive, card, &AdaptiveCard::GetRefresh, &AdaptiveCard::SetRefresh);
+    Property(archive, card, &AdaptiveCard::GetAuthentication, &AdaptiveCard::SetAuthentication);
+    Property(archive, card, &AdaptiveCard::GetSpeak, &AdaptiveCard::SetSpeak);
+    Property(archive, card, &AdaptiveCard::GetStyle, &AdaptiveCard::SetStyle);
+    Property(archive, card, &AdaptiveCard::GetLanguage, &AdaptiveCard::SetLanguage);
+    Property(archive, card, &AdaptiveCard::GetVerticalContentAlignment, &AdaptiveCard::SetVerticalContentAlignment);
+    Property(archive, card, &AdaptiveCard::GetHeight, &AdaptiveCard::SetHeight);
+    Property(archive, card, &AdaptiveCard::GetMinHeight, &AdaptiveCard::SetMinHeight);
+    Property(archive, card, &AdaptiveCard::GetRtl, &AdaptiveCard::SetRtl);
+    Property(archive, card, &AdaptiveCard::GetSelectAction, &AdaptiveCard::SetSelectAction);
+    archive.Property(
+        [&]() -> const Json::Value& { return card.GetAdditionalProperties(); },
+        [&](Json::Value&& value) { card.SetAdditionalProperties(std::move(value)); });
+    archive.Value(card.GetBody());
+    archive.Value(card.GetActions());
+}
+
+[[noreturn]] void ThrowUnsupported(const std::string& type)
+{
+    throw AdaptiveCardParseException(
+        ErrorStatusCode::UnsupportedParserOverride, "Cards with " + type + " elements of custom parsers can't be snapshotted");
+}
+
+[[noreturn]] void ThrowInvalidSnapshot()
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Not a card snapshot of format version " + std::to_string(CardSnapshot::FormatVersion));
+}
+
+void AppendUInt32(std::string& output, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        output += static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+uint32_t ReadUInt32(const char* bytes)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+class CardSnapshot::Writer
+{
+public:
+    Writer() : m_nextOrdinal(0) {}
+
+    template <typename Getter, typename Setter>
+    void Property(Getter&& getter, Setter&&)
+    {
+        Write(getter());
+    }
+
+    template <typename T>
+    void Value(T& value)
+    {
+        Write(value);
+    }
+
+    void CanFallbackToAncestor(const BaseElement& element)
+    {
+        Write(element.CanFallbackToAncestor());
+    }
+
+    // The parental id is written as the ordinal of the element it is, plus one, or 0 if it isn't one of the card's
+    void BleedDirection(const StyledCollectionElement& collection)
+    {
+        Write(collection.GetBleedDirection());
+        const auto ordinal = m_ordinals.find(collection.GetParentalId().Hash());
+        WriteNumber(ordinal == m_ordinals.end() ? 0 : ordinal->second + 1);
+    }
+
+    template <typename T>
+    void Write(const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            m_stream += static_cast<char>(value ? 1 : 0);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            Write(static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            const auto number = static_cast<int64_t>(value);
+            WriteNumber((static_cast<uint64_t>(number) << 1) ^ static_cast<uint64_t>(number >> 63));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            WriteNumber(value);
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (int i = 0; i < 8; ++i)
+            {
+                m_stream += static_cast<char>((bits >> (8 * i)) & 0xFF);
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            const auto inserted = m_stringIndices.emplace(value, static_cast<uint32_t>(m_strings.size()));
+            if (inserted.second)
+            {
+                m_strings.push_back(&inserted.first->first);
+            }
+            WriteNumber(inserted.first->second);
+        }
+        else if constexpr (std::is_same_v<T, Json::Value>)
+        {
+            WriteJson(value);
+        }
+        else if constexpr (std::is_same_v<T, SemanticVersion>)
+        {
+            WriteNumber(value.GetMajor());
+            WriteNumber(value.GetMinor());
+            WriteNumber(value.GetBuild());
+            WriteNumber(value.GetRevision());
+        }
+        else if constexpr (IsOptional<T>::value)
+        {
+            Write(value.has_value());
+            if (value.has_value())
+            {
+                Write(*value);
+            }
+        }
+        else if constexpr (IsSharedPtr<T>::value)
+        {
+            WriteObject(value);
+        }
+        else if constexpr (IsVector<T>::value)
+        {
+            WriteNumber(value.size());
+            for (const auto& item : value)
+            {
+                Write(item);
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::unordered_map<std::string, SemanticVersion>>)
+        {
+            WriteNumber(value.size());
+            for (const auto& [name, version] : value)
+            {
+                Write(name);
+                Write(version);
+            }
+        }
+        else
+        {
+            static_assert(DependentFalse<T>::value, "no snapshot encoding for this type");
+        }
+    }
+
+    std::string Finish()
+    {
+        std::string snapshot(snapshotMagic, sizeof(snapshotMagic));
+        AppendUInt32(snapshot, FormatVersion);
+        AppendUInt32(snapshot, static_cast<uint32_t>(m_strings.size()));
+
+        uint32_t offset = 0;
+        AppendUInt32(snapshot, offset);
+        for (const auto string : m_strings)
+        {
+            offset += static_cast<uint32_t>(string->size());
+            AppendUInt32(snapshot, offset);
+        }
+
+        snapshot.reserve(snapshot.size() + offset + m_stream.size());
+        for (const auto string : m_strings)
+        {
+            snapshot += *string;
+        }
+        snapshot += m_stream;
+        return snapshot;
+    }
+
+private:
+    void WriteNumber(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            m_stream += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        m_stream += static_cast<char>(value);
+    }
+
+    void WriteJson(const Json::Value& value)
+    {
+        switch (value.type())
+        {
+        case Json::nullValue:
+            Write(JsonTag::Null);
+            break;
+        case Json::booleanValue:
+            Write(value.asBool() ? JsonTag::True : JsonTag::False);
+            break;
+        case Json::intValue:
+            Write(JsonTag::Int);
+            Write(value.asLargestInt());
+            break;
+        case Json::uintValue:
+            Write(JsonTag::UInt);
+            Write(value.asLargestUInt());
+            break;
+        case Json::realValue:
+            Write(JsonTag::Real);
+            Write(value.asDouble());
+            break;
+        case Json::stringValue:
+            Write(JsonTag::String);
+            Write(value.asString());
+            break;
+        case Json::arrayValue:
+            Write(JsonTag::Array);
+            WriteNumber(value.size());
+            for (const auto& item : value)
+            {
+                WriteJson(item);
+            }
+            break;
+        case Json::objectValue:
+            Write(JsonTag::Object);
+            WriteNumber(value.size());
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                Write(it.name());
+                WriteJson(*it);
+            }
+            break;
+        }
+    }
+
+    void AddOrdinal(InternalId internalId)
+    {
+        m_ordinals.emplace(internalId.Hash(), m_nextOrdinal++);
+    }
+
+    // Elements of built-in types are written as exactly those types, so anything else came from a custom parser
+    template <typename Expected, typename Element>
+    void ThrowIfNotBuiltIn(const Element& element)
+    {
+        if (typeid(element) != typeid(Expected))
+        {
+            ThrowUnsupported(element.GetElementTypeString());
+        }
+    }
+
+    template <typename T>
+    void WriteObject(const std::shared_ptr<T>& object)
+    {
+        if constexpr (std::is_same_v<T, BaseCardElement>)
+        {
+            if (!object)
+            {
+                WriteNumber(0);
+                return;
+            }
+            WriteNumber(static_cast<uint64_t>(object->GetElementType()) + 1);
+            if (!VisitElementType(object->GetElementType(), [this, &object](auto tag) {
+                    using Element = typename decltype(tag)::Type;
+                    ThrowIfNotBuiltIn<Element>(*object);
+                    AddOrdinal(object->GetInternalId());
+                    Transfer(*this, static_cast<Element&>(*object));
+                }))
+            {
+                ThrowUnsupported(object->GetElementTypeString());
+            }
+        }
+        else if constexpr (std::is_same_v<T, BaseActionElement>)
+        {
+            if (!object)
+            {
+                WriteNumber(0);
+                return;
+            }
+            WriteNumber(static_cast<uint64_t>(object->GetElementType()) + 1);
+            if (!VisitActionType(object->GetElementType(), [this, &object](auto tag) {
+                    using Action = typename decltype(tag)::Type;
+                    ThrowIfNotBuiltIn<Action>(*object);
+                    AddOrdinal(object->GetInternalId());
+                    Transfer(*this, static_cast<Action&>(*object));
+                }))
+            {
+                ThrowUnsupported(object->GetElementTypeString());
+            }
+        }
+        else if constexpr (std::is_same_v<T, Inline>)
+        {
+            // TextRun is the only kind of inline
+            Write(static_cast<bool>(object));
+            if (object)
+            {
+                Transfer(*this, static_cast<TextRun&>(*object));
+            }
+        }
+        else
+        {
+            Write(static_cast<bool>(object));
+            if (object)
+            {
+                if constexpr (std::is_base_of_v<BaseElement, T>)
+                {
+                    ThrowIfNotBuiltIn<T>(*object);
+                    AddOrdinal(object->GetInternalId());
+                }
+                else if constexpr (std::is_same_v<T, AdaptiveCard>)
+                {
+                    AddOrdinal(object->GetInternalId());
+                }
+                Transfer(*this, *object);
+            }
+        }
+    }
+
+    std::string m_stream;
+    std::unordered_map<std::string, uint32_t> m_stringIndices;
+    // The pooled strings in the order of their indices; keys of m_stringIndices, which don't move
+    std::vector<const std::string*> m_strings;
+    // The ordinals of the elements written so far, by their internal ids, in the order they were written
+    std::unordered_map<unsigned int, uint32_t> m_ordinals;
+    uint32_t m_nextOrdinal;
+};
+
+class CardSnapshot::Reader
+{
+public:
+    explicit Reader(std::string_view snapshot) : m_position(nullptr), m_end(nullptr), m_stringCount(0)
+    {
+        if (snapshot.size() < headerSize || snapshot.compare(0, sizeof(snapshotMagic), snapshotMagic, sizeof(snapshotMagic)) != 0 ||
+            ReadUInt32(snapshot.data() + sizeof(snapshotMagic)) != FormatVersion)
+        {
+            ThrowInvalidSnapshot();
+        }
+
+        m_stringCount = ReadUInt32(snapshot.data() + sizeof(snapshotMagic) + sizeof(uint32_t));
+        const size_t offsetsSize = (static_cast<size_t>(m_stringCount) + 1) * sizeof(uint32_t);
+        if (m_stringCount >= snapshot.size() || snapshot.size() - headerSize < offsetsSize)
+        {
+            ThrowInvalidSnapshot();
+        }
+
+        m_stringOffsets = snapshot.data() + headerSize;
+        m_stringData = m_stringOffsets + offsetsSize;
+        const size_t stringDataSize = ReadUInt32(m_stringOffsets + m_stringCount * sizeof(uint32_t));
+        if (snapshot.size() - headerSize - offsetsSize < stringDataSize)
+        {
+            ThrowInvalidSnapshot();
+        }
+
+        m_position = m_stringData + stringDataSize;
+        m_end = snapshot.data() + snapshot.size();
+    }
+
+    template <typename Getter, typename Setter>
+    void Property(Getter&&, Setter&& setter)
+    {
+        setter(Read<std::decay_t<std::invoke_result_t<Getter>>>());
+    }
+
+    template <typename T>
+    void Value(T& value)
+    {
+        value = Read<T>();
+    }
+
+    void CanFallbackToAncestor(BaseElement& element)
+    {
+        CardSnapshot::SetCanFallbackToAncestor(element, Read<bool>());
+    }
+
+    void BleedDirection(StyledCollectionElement& collection)
+    {
+        CardSnapshot::SetBleedDirection(collection, Read<ContainerBleedDirection>());
+        const uint64_t parent = ReadNumber();
+        if (parent > m_internalIds.size())
+        {
+            ThrowInvalidSnapshot();
+        }
+        if (parent != 0)
+        {
+            collection.SetParentalId(m_internalIds[parent - 1]);
+        }
+    }
+
+    template <typename T>
+    T Read()
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return ReadByte() != 0;
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return static_cast<T>(Read<std::underlying_type_t<T>>());
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            const uint64_t number = ReadNumber();
+            return static_cast<T>(static_cast<int64_t>(number >> 1) ^ -static_cast<int64_t>(number & 1));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            return static_cast<T>(ReadNumber());
+        }
+        else if constexpr (std::is_same_v<T, double>)
+        {
+            if (m_end - m_position < 8)
+            {
+                ThrowInvalidSnapshot();
+            }
+            uint64_t bits = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                bits |= static_cast<uint64_t>(static_cast<unsigned char>(m_position[i])) << (8 * i);
+            }
+            m_position += 8;
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            return std::string(ReadString());
+        }
+        else if constexpr (std::is_same_v<T, Json::Value>)
+        {
+            return ReadJson();
+        }
+        else if constexpr (std::is_same_v<T, SemanticVersion>)
+        {
+            const auto major = Read<unsigned int>();
+            const auto minor = Read<unsigned int>();
+            const auto build = Read<unsigned int>();
+            const auto revision = Read<unsigned int>();
+            return SemanticVersion(major, minor, build, revision);
+        }
+        else if constexpr (IsOptional<T>::value)
+        {
+            if (!Read<bool>())
+            {
+                return std::nullopt;
+            }
+            return Read<typename T::value_type>();
+        }
+        else if constexpr (IsSharedPtr<T>::value)
+        {
+            return ReadObject<typename T::element_type>();
+        }
+        else if constexpr (IsVector<T>::value)
+        {
+            T items;
+            const size_t count = ReadCount();
+            items.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                items.push_back(Read<typename T::value_type>());
+            }
+            return items;
+        }
+        else if constexpr (std::is_same_v<T, std::unordered_map<std::string, SemanticVersion>>)
+        {
+            T requirements;
+            const size_t count = ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                std::string name = Read<std::string>();
+                requirements.emplace(std::move(name), Read<SemanticVersion>());
+            }
+            return requirements;
+        }
+        else
+        {
+            static_assert(DependentFalse<T>::value, "no snapshot encoding for this type");
+        }
+    }
+
+    bool AtEnd() const
+    {
+        return m_position == m_end;
+    }
+
+private:
+    unsigned char ReadByte()
+    {
+        if (m_position == m_end)
+        {
+            ThrowInvalidSnapshot();
+        }
+        return static_cast<unsigned char>(*m_position++);
+    }
+
+    uint64_t ReadNumber()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            const unsigned char byte = ReadByte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        ThrowInvalidSnapshot();
+    }
+
+    // Every item takes at least a byte, so a count can't be more than the bytes that are left
+    size_t ReadCount()
+    {
+        const uint64_t count = ReadNumber();
+        if (count > static_cast<uint64_t>(m_end - m_position))
+        {
+            ThrowInvalidSnapshot();
+        }
+        return static_cast<size_t>(count);
+    }
+
+    std::string_view ReadString()
+    {
+        const uint64_t index = ReadNumber();
+        if (index >= m_stringCount)
+        {
+            ThrowInvalidSnapshot();
+        }
+
+        const uint32_t begin = ReadUInt32(m_stringOffsets + index * sizeof(uint32_t));
+        const uint32_t end = ReadUInt32(m_stringOffsets + (index + 1) * sizeof(uint32_t));
+        if (begin > end || m_stringData + end > m_position)
+        {
+            ThrowInvalidSnapshot();
+        }
+        return std::string_view(m_stringData + begin, end - begin);
+    }
+
+    Json::Value ReadJson()
+    {
+        switch (static_cast<JsonTag>(ReadByte()))
+        {
+        case JsonTag::Null:
+            return Json::Value();
+        case JsonTag::False:
+            return Json::Value(false);
+        case JsonTag::True:
+            return Json::Value(true);
+        case JsonTag::Int:
+            return Json::Value(Read<Json::Int64>());
+        case JsonTag::UInt:
+            return Json::Value(Read<Json::UInt64>());
+        case JsonTag::Real:
+            return Json::Value(Read<double>());
+        case JsonTag::String:
+        {
+            const std::string_view string = ReadString();
+            return Json::Value(string.data(), string.data() + string.size());
+        }
+        case JsonTag::Array:
+        {
+            Json::Value array(Json::arrayValue);
+            const size_t count = ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                array.append(ReadJson());
+            }
+            return array;
+        }
+        case JsonTag::Object:
+        {
+            Json::Value object(Json::objectValue);
+            const size_t count = ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string_view name = ReadString();
+                object[std::string(name)] = ReadJson();
+            }
+            return object;
+        }
+        }
+        ThrowInvalidSnapshot();
+    }
+
+    // Elements get new internal ids as the parser would give them, in the order they're written
+    template <typename Element>
+    std::shared_ptr<Element> MakeElement()
+    {
+        InternalId::Next();
+        auto element = std::make_shared<Element>();
+        m_internalIds.push_back(element->GetInternalId());
+        return element;
+    }
+
+    template <typename T>
+    std::shared_ptr<T> ReadObject()
+    {
+        if constexpr (std::is_same_v<T, BaseCardElement>)
+        {
+            const uint64_t type = ReadNumber();
+            if (type == 0)
+            {
+                return nullptr;
+            }
+
+            std::shared_ptr<BaseCardElement> result;
+            if (type - 1 > static_cast<uint64_t>(CardElementType::Unknown) ||
+                !VisitElementType(static_cast<CardElementType>(type - 1), [this, &result](auto tag) {
+                    auto element = MakeElement<typename decltype(tag)::Type>();
+                    result = element;
+                    Transfer(*this, *element);
+                }))
+            {
+                ThrowInvalidSnapshot();
+            }
+            return result;
+        }
+        else if constexpr (std::is_same_v<T, BaseActionElement>)
+        {
+            const uint64_t type = ReadNumber();
+            if (type == 0)
+            {
+                return nullptr;
+            }
+
+            std::shared_ptr<BaseActionElement> result;
+            if (type - 1 > static_cast<uint64_t>(ActionType::Overflow) ||
+                !VisitActionType(static_cast<ActionType>(type - 1), [this, &result](auto tag) {
+                    auto action = MakeElement<typename decltype(tag)::Type>();
+                    result = action;
+                    Transfer(*this, *action);
+                }))
+            {
+                ThrowInvalidSnapshot();
+            }
+            return result;
+        }
+        else if constexpr (std::is_same_v<T, Inline>)
+        {
+            if (!Read<bool>())
+            {
+                return nullptr;
+            }
+            auto textRun = std::make_shared<TextRun>();
+            Transfer(*this, *textRun);
+            return textRun;
+        }
+        else
+        {
+            if (!Read<bool>())
+            {
+                return nullptr;
+            }
+
+            std::shared_ptr<T> object;
+            if constexpr (std::is_base_of_v<BaseElement, T>)
+            {
+                object = MakeElement<T>();
+            }
+            else
+            {
+                object = std::make_shared<T>();
+                if constexpr (std::is_same_v<T, AdaptiveCard>)
+                {
+                    m_internalIds.push_back(object->GetInternalId());
+                }
+            }
+            Transfer(*this, *object);
+            return object;
+        }
+    }
+
+    const char* m_position;
+    const char* m_end;
+    uint32_t m_stringCount;
+    const char* m_stringOffsets;
+    const char* m_stringData;
+    // The internal ids of the elements read so far, by their ordinals
+    std::vector<InternalId> m_internalIds;
+};
+
+std::string CardSnapshot::Save(const ParseResult& parseResult)
+{
+    Writer writer;
+
+    const auto& warnings = parseResult.GetWarnings();
+    writer.Write(static_cast<uint64_t>(warnings.size()));
+    for (const auto& warning : warnings)
+    {
+        writer.Write(warning->GetStatusCode());
+        writer.Write(warning->GetReason());
+    }
+
+    writer.Write(parseResult.GetAdaptiveCard());
+    return writer.Finish();
+}
+
+std::shared_ptr<ParseResult> CardSnapshot::Load(std::string_view snapshot)
+{
+    Reader reader(snapshot);
+
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings(reader.Read<uint64_t>());
+    for (auto& warning : warnings)
+    {
+        const auto statusCode = reader.Read<WarningStatusCode>();
+        warning = std::make_shared<AdaptiveCardParseWarning>(statusCode, reader.Read<std::string>());
+    }
+
+    auto card = reader.Read<std::shared_ptr<AdaptiveCard>>();
+    if (!card || !reader.AtEnd())
+    {
+        ThrowInvalidSnapshot();
+    }
+    return std::make_shared<ParseResult>(std::move(card), std::move(warnings));
+}
+
+void CardSnapshot::SetBleedDirection(StyledCollectionElement& element, ContainerBleedDirection bleedDirection)
+{
+    element.SetBleedDirection(bleedDirection);
+}
+
+void CardSnapshot::SetCanFallbackToAncestor(BaseElement& element, bool canFallbackToAncestor)
+{
+    element.SetCanFallbackToAncestor(canFallbackToAncestor);
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseResult.h"
+
+namespace AdaptiveCards
+{
+class BaseElement;
+class StyledCollectionElement;
+
+// A compact, versioned binary form of a parsed card, for cards that are parsed and validated once (on a server, say)
+// and loaded many times afterwards. Loading a snapshot rebuilds the card's object model directly: there's no json to
+// parse, no enum strings to look up and no id collisions to check, since all of that happened when the card was first
+// parsed.
+//
+// A snapshot holds every element and action with its enums as integers, its strings in one pooled table and its
+// additionalProperties as json values, as well as the warnings the card was parsed with. Snapshots don't point into
+// themselves, so one can be loaded straight from a memory-mapped file. Cards with elements or actions of registered
+// custom parsers can't be snapshotted, since there's no parser to rebuild them with.
+class CardSnapshot
+{
+public:
+    // Snapshots of any other version of the format are rejected by Load
+    static constexpr unsigned int FormatVersion = 1;
+
+    // Throws an AdaptiveCardParseException with UnsupportedParserOverride if the card has an element or action that
+    // wasn't parsed by the built-in parsers
+    static std::string Save(const ParseResult& parseResult);
+
+    // Throws an AdaptiveCardParseException with InvalidJson if snapshot isn't a snapshot of this version of the
+    // format, or is cut short
+    static std::shared_ptr<ParseResult> Load(std::string_view snapshot);
+
+private:
+    class Reader;
+    class Writer;
+
+    // Restore what the parser works out from an element's ancestors
+    static void SetBleedDirection(StyledCollectionElement& element, ContainerBleedDirection bleedDirection);
+    static void SetCanFallbackToAncestor(BaseElement& element, bool canFallbackToAncestor);
+};
+} // namespace AdaptiveCards
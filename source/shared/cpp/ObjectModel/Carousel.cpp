@@ -14,14 +14,15 @@ Carousel::Carousel() : StyledCollectionElement(CardElementType::Carousel)
 
 void Carousel::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HeightInPixels),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::InitialPage),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Loop),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Orientation),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Pages),
-        AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Timer),
-    });
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::HeightInPixels,
+         AdaptiveCardSchemaKey::InitialPage,
+         AdaptiveCardSchemaKey::Loop,
+         AdaptiveCardSchemaKey::Orientation,
+         AdaptiveCardSchemaKey::Pages,
+         AdaptiveCardSchemaKey::Timer});
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value Carousel::SerializeToJsonValue() const
@@ -182,7 +183,7 @@ std::shared_ptr<BaseCardElement> CarouselParser::Deserialize(ParseContext& conte
     carousel->setAutoLoop(ParseUtil::GetOptionalBool(value, AdaptiveCardSchemaKey::Loop));
 
     carousel->SetOrientation(ParseUtil::GetOptionalEnumValue<CarouselOrientation>(
-        value, AdaptiveCardSchemaKey::Orientation, CarouselOrientationFromString));
+        value, AdaptiveCardSchemaKey::Orientation, CarouselOrientationTryFromString));
 
     carousel->SetRtl(ParseUtil::GetOptionalBool(value, AdaptiveCardSchemaKey::Rtl));
 
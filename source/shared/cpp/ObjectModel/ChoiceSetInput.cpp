@@ -132,7 +132,7 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext&
     auto choiceSet = BaseInputElement::Deserialize<ChoiceSetInput>(context, json);
 
     choiceSet->SetChoiceSetStyle(ParseUtil::GetEnumValue<ChoiceSetStyle>(
-        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleTryFromString));
     choiceSet->SetIsMultiSelect(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiSelect, false));
     choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
     choiceSet->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
@@ -162,12 +162,14 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(Par
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ChoicesData),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Choices,
+         AdaptiveCardSchemaKey::ChoicesData,
+         AdaptiveCardSchemaKey::IsMultiSelect,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
@@ -41,7 +41,7 @@ bool ChoicesData::ShouldSerialize() const
 
 std::shared_ptr<ChoicesData> ChoicesData::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto choicesData = std::make_shared<ChoicesData>();
+    auto choicesData = context.MakeShared<ChoicesData>();
     if (json.isNull())
     {
         return choicesData;
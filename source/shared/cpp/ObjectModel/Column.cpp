@@ -95,13 +95,15 @@ Json::Value Column::SerializeToJsonValue() const
 
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Items,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Width,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -127,18 +129,11 @@ std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context
 {
     auto column = StyledCollectionElement::Deserialize<Column>(context, value);
 
-    const auto& fallbackElement = column->GetFallbackContent();
-    if (fallbackElement)
+    if (column->GetFallbackType() == FallbackType::Content)
     {
-        bool isFallbackColumn;
-        try
-        {
-            isFallbackColumn = CardElementTypeFromString(fallbackElement->GetElementTypeString()) == CardElementType::Column;
-        }
-        catch (const std::out_of_range&)
-        {
-            isFallbackColumn = false;
-        }
+        // checks the type in the json, so that fallback content whose parse was deferred isn't parsed here
+        const auto& fallbackJson = ParseUtil::ExtractJsonValue(value, AdaptiveCardSchemaKey::Fallback);
+        const bool isFallbackColumn = CardElementTypeTryFromString(ParseUtil::GetTypeAsString(fallbackJson)) == CardElementType::Column;
 
         if (!isFallbackColumn)
         {
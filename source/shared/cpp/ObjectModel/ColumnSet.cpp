@@ -98,11 +98,13 @@ void AdaptiveCards::ColumnSet::SetHorizontalAlignment(std::optional<HorizontalAl
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -119,7 +121,7 @@ std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(ParseContext& cont
     auto container = StyledCollectionElement::Deserialize<ColumnSet>(context, value);
 
     container->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        value, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        value, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     return container;
 }
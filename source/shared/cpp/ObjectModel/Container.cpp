@@ -89,13 +89,15 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Items});
+    m_knownProperties = &knownProperties;
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -29,9 +29,9 @@ private:
 };
 
 template <typename T>
-std::shared_ptr<T> ContentSource::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<T> ContentSource::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<T> base = std::make_shared<T>();
+    std::shared_ptr<T> base = context.MakeShared<T>();
     std::shared_ptr<ContentSource> contentSource = std::static_pointer_cast<ContentSource>(base);
 
     contentSource->SetMimeType(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MimeType, false));
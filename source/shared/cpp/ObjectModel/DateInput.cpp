@@ -100,9 +100,11 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Placeholder});
+    m_knownProperties = &knownProperties;
 }
@@ -17,16 +17,174 @@
 
 using namespace AdaptiveCards;
 
+namespace
+{
+constexpr bool IsAsciiDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Reads the digitCount digits at in[index] into value and advances index past them
+bool TryScanDigits(std::string_view in, size_t& index, size_t digitCount, int& value)
+{
+    if (in.size() - index < digitCount)
+    {
+        return false;
+    }
+
+    int scanned = 0;
+    for (size_t end = index + digitCount; index < end; ++index)
+    {
+        if (!IsAsciiDigit(in[index]))
+        {
+            return false;
+        }
+        scanned = scanned * 10 + (in[index] - '0');
+    }
+    value = scanned;
+    return true;
+}
+
+// Advances index past expected if in continues with it there
+bool TryScanLiteral(std::string_view in, size_t& index, std::string_view expected)
+{
+    if (in.substr(index, expected.size()) != expected)
+    {
+        return false;
+    }
+    index += expected.size();
+    return true;
+}
+
+// The parts of a {{DATE(...)}} or {{TIME(...)}} expression
+struct DateTimeExpression
+{
+    bool isDate{};
+    int year{}, month{}, day{}, hours{}, minutes{}, seconds{};
+    // '+' or '-' when the time has an offset from UTC, 0 for Z
+    char offsetSign{};
+    int offsetHours{}, offsetMinutes{};
+    // 'S', 'L' or 'C' for the SHORT, LONG and COMPACT styles, 0 when there is none
+    char style{};
+};
+
+// Scans the expression at the start of in, which has the form
+//   {{(DATE|TIME)(YYYY-MM-DDThh:mm:ss(Z|[+-]hh:mm)(, ?(SHORT|LONG|COMPACT))?)}}
+// and returns its length, or 0 if in doesn't start with one
+size_t TryScanDateTimeExpression(std::string_view in, DateTimeExpression& expression)
+{
+    size_t index = 0;
+    if (!TryScanLiteral(in, index, "{{"))
+    {
+        return 0;
+    }
+
+    if (TryScanLiteral(in, index, "DATE("))
+    {
+        expression.isDate = true;
+    }
+    else if (!TryScanLiteral(in, index, "TIME("))
+    {
+        return 0;
+    }
+
+    if (!TryScanDigits(in, index, 4, expression.year) || !TryScanLiteral(in, index, "-") ||
+        !TryScanDigits(in, index, 2, expression.month) || !TryScanLiteral(in, index, "-") ||
+        !TryScanDigits(in, index, 2, expression.day) || !TryScanLiteral(in, index, "T") ||
+        !TryScanDigits(in, index, 2, expression.hours) || !TryScanLiteral(in, index, ":") ||
+        !TryScanDigits(in, index, 2, expression.minutes) || !TryScanLiteral(in, index, ":") ||
+        !TryScanDigits(in, index, 2, expression.seconds))
+    {
+        return 0;
+    }
+
+    if (index < in.size() && (in[index] == '+' || in[index] == '-'))
+    {
+        expression.offsetSign = in[index++];
+        if (!TryScanDigits(in, index, 2, expression.offsetHours) || !TryScanLiteral(in, index, ":") ||
+            !TryScanDigits(in, index, 2, expression.offsetMinutes))
+        {
+            return 0;
+        }
+    }
+    else if (!TryScanLiteral(in, index, "Z"))
+    {
+        return 0;
+    }
+
+    if (TryScanLiteral(in, index, ","))
+    {
+        TryScanLiteral(in, index, " ");
+        if (TryScanLiteral(in, index, "SHORT"))
+        {
+            expression.style = 'S';
+        }
+        else if (TryScanLiteral(in, index, "LONG"))
+        {
+            expression.style = 'L';
+        }
+        else if (TryScanLiteral(in, index, "COMPACT"))
+        {
+            expression.style = 'C';
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    return TryScanLiteral(in, index, ")}}") ? index : 0;
+}
+} // namespace
+
+DateTimeTokenBuffer::DateTimeTokenBuffer() : m_hasDateTokens(false)
+{
+}
+
+const std::vector<DateTimeTextToken>& DateTimeTokenBuffer::GetTokens() const
+{
+    return m_tokens;
+}
+
+bool DateTimeTokenBuffer::HasDateTokens() const
+{
+    return m_hasDateTokens;
+}
+
+void DateTimeTokenBuffer::Clear()
+{
+    m_tokens.clear();
+    m_formattedText.clear();
+    m_formattedTokens.clear();
+    m_hasDateTokens = false;
+}
+
 DateTimePreparser::DateTimePreparser() : m_hasDateTokens(false)
 {
 }
 
 DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(false)
 {
-    ParseDateTime(in);
+    DateTimeTokenBuffer buffer;
+    Tokenize(in, buffer);
+
+    m_textTokenCollection.reserve(buffer.GetTokens().size());
+    for (const auto& token : buffer.GetTokens())
+    {
+        if (token.format == DateTimePreparsedTokenFormat::RegularString)
+        {
+            m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(std::string{token.text}, token.format));
+        }
+        else
+        {
+            m_textTokenCollection.emplace_back(
+                std::make_shared<DateTimePreparsedToken>(std::string{token.text}, token.date, token.format));
+        }
+    }
+    m_hasDateTokens = buffer.HasDateTokens();
 }
 
-std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
+const std::vector<std::shared_ptr<DateTimePreparsedToken>>& DateTimePreparser::GetTextTokens() const
 {
     return m_textTokenCollection;
 }
@@ -36,18 +194,32 @@ bool DateTimePreparser::HasDateTokens() const
     return m_hasDateTokens;
 }
 
-void DateTimePreparser::AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddTextToken(DateTimeTokenBuffer& buffer, std::string_view text)
 {
     if (!text.empty())
     {
-        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, format));
+        buffer.m_tokens.push_back({text, DateTimePreparsedTokenFormat::RegularString, {}});
+    }
+}
+
+void DateTimePreparser::AddTimeToken(DateTimeTokenBuffer& buffer, const struct tm& time)
+{
+    std::ostringstream parsedTime;
+    parsedTime << std::put_time(&time, "%I:%M %p");
+    const std::string formattedTime = parsedTime.str();
+    if (!formattedTime.empty())
+    {
+        // the text is pointed at once tokenizing is done, see Tokenize
+        buffer.m_formattedTokens.emplace_back(buffer.m_tokens.size(), buffer.m_formattedText.size());
+        buffer.m_formattedText += formattedTime;
+        buffer.m_tokens.push_back({{}, DateTimePreparsedTokenFormat::RegularString, {}});
     }
 }
 
-void DateTimePreparser::AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddDateToken(DateTimeTokenBuffer& buffer, std::string_view text, const struct tm& date, DateTimePreparsedTokenFormat format)
 {
-    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, date, format));
-    m_hasDateTokens = true;
+    buffer.m_tokens.push_back({text, format, date});
+    buffer.m_hasDateTokens = true;
 }
 
 std::string DateTimePreparser::Concatenate() const
@@ -103,193 +275,159 @@ constexpr time_t IntToTimeT(int timeToConvert)
 #pragma warning(pop)
 }
 
-void DateTimePreparser::ParseDateTime(const std::string& in)
+void DateTimePreparser::Tokenize(std::string_view in, DateTimeTokenBuffer& buffer)
 {
-    if (in.find("{{") != std::string::npos)
+    buffer.Clear();
+
+    size_t textStart = 0;
+    size_t expressionStart = in.find("{{");
+    while (expressionStart != std::string_view::npos)
     {
-        static const std::regex pattern(
-            "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}"
-            "):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
-        std::smatch matches;
-        std::string text = in;
-        enum MatchIndex
+        DateTimeExpression expression;
+        const size_t expressionLength = TryScanDateTimeExpression(in.substr(expressionStart), expression);
+        if (expressionLength == 0)
         {
-            IsDate = 2,
-            Year = 4,
-            Month,
-            Day,
-            Hour,
-            Min,
-            Sec,
-            TimeZone = 12,
-            TZHr,
-            TZMn,
-            Format,
-            Style,
-        };
-        std::vector<int> indexer = {Year, Month, Day, Hour, Min, Sec, TZHr, TZMn};
+            expressionStart = in.find("{{", expressionStart + 1);
+            continue;
+        }
 
-        while (std::regex_search(text, matches, pattern))
-        {
-            int formatStyle{};
-            // Date is matched
-            const bool isDate = matches[IsDate].matched;
-            int hours{}, minutes{};
-            struct tm parsedTm
-            {
-            };
-            std::vector<int*> addrs = {
-                &parsedTm.tm_year, &parsedTm.tm_mon, &parsedTm.tm_mday, &parsedTm.tm_hour, &parsedTm.tm_min, &parsedTm.tm_sec, &hours, &minutes};
+        const std::string_view expressionText = in.substr(expressionStart, expressionLength);
+        AddTextToken(buffer, in.substr(textStart, expressionStart - textStart));
+        textStart = expressionStart + expressionLength;
+        expressionStart = in.find("{{", textStart);
 
-            if (matches[Style].matched)
-            {
-                // match for long/short/compact
-                bool formatHasSpace = matches[Format].str().at(1) == ' ';
-                const int formatStartIndex = formatHasSpace ? 2 : 1;
-                formatStyle = matches[Format].str().at(formatStartIndex);
-            }
+        if (!expression.isDate && expression.style)
+        {
+            AddTextToken(buffer, expressionText);
+            continue;
+        }
 
-            AddTextToken(matches.prefix().str(), DateTimePreparsedTokenFormat::RegularString);
+        int hours = expression.offsetHours;
+        int minutes = expression.offsetMinutes;
+        struct tm parsedTm
+        {
+        };
+        parsedTm.tm_year = expression.year;
+        parsedTm.tm_mon = expression.month;
+        parsedTm.tm_mday = expression.day;
+        parsedTm.tm_hour = expression.hours;
+        parsedTm.tm_min = expression.minutes;
+        parsedTm.tm_sec = expression.seconds;
+
+        // check for date and time validation
+        if (!IsValidTimeAndDate(parsedTm, hours, minutes))
+        {
+            AddTextToken(buffer, expressionText);
+            continue;
+        }
 
-            if (!isDate && formatStyle)
-            {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-                text = matches.suffix().str();
-                continue;
-            }
+        time_t offset{};
+        // maches offset sign,
+        // Z == UTC,
+        // + == time added from UTC
+        // - == time subtracted from UTC
+        if (expression.offsetSign)
+        {
+            // converts to seconds
+            hours *= 3600;
+            minutes *= 60;
+            offset = IntToTimeT(hours) + IntToTimeT(minutes);
 
-            for (unsigned int idx = 0; idx < indexer.size(); idx++)
+            // time zone offset calculation
+            if (expression.offsetSign == '+')
             {
-                if (matches[indexer.at(idx)].matched)
-                {
-                    // get indexes for time attributes to index into corresponding matches
-                    // and convert it to string
-                    *(addrs.at(idx)) = stoi(matches[indexer.at(idx)]);
-                }
+                offset *= -1;
             }
+        }
 
-            // check for date and time validation
-            if (IsValidTimeAndDate(parsedTm, hours, minutes))
-            {
-                time_t offset{};
-                // maches offset sign,
-                // Z == UTC,
-                // + == time added from UTC
-                // - == time subtracted from UTC
-                if (matches[TimeZone].matched)
-                {
-                    // converts to seconds
-                    hours *= 3600;
-                    minutes *= 60;
-                    offset = IntToTimeT(hours) + IntToTimeT(minutes);
-
-                    wchar_t zone = matches[TimeZone].str().at(0);
-                    // time zone offset calculation
-                    if (zone == '+')
-                    {
-                        offset *= -1;
-                    }
-                }
-
-                // measured from year 1900
-                parsedTm.tm_year -= 1900;
-                parsedTm.tm_mon -= 1;
+        // measured from year 1900
+        parsedTm.tm_year -= 1900;
+        parsedTm.tm_mon -= 1;
 
-                time_t utc{};
-                // converts to ticks in UTC
-                utc = mktime(&parsedTm);
-                if (utc == -1)
-                {
-                    AddTextToken(matches[0], DateTimePreparsedTokenFormat::RegularString);
-                }
+        time_t utc{};
+        // converts to ticks in UTC
+        utc = mktime(&parsedTm);
+        if (utc == -1)
+        {
+            AddTextToken(buffer, expressionText);
+        }
 
 // Disable "array to pointer decay" check for tzOffsetBuff since we can't change strftime's signature
 #pragma warning(push)
 #pragma warning(disable : 26485)
-                char tzOffsetBuff[6]{};
-                // gets local time zone offset
-                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
-                std::string localTimeZoneOffsetStr(tzOffsetBuff);
-                const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
-                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
-                // add offset to utc
-                utc += offset;
-                struct tm result
-                {
-                };
+        char tzOffsetBuff[6]{};
+        // gets local time zone offset
+        strftime(tzOffsetBuff, 6, "%z", &parsedTm);
+        const time_t nTzOffset = IntToTimeT(std::stoi(tzOffsetBuff));
+        offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
+        // add offset to utc
+        utc += offset;
+        struct tm result
+        {
+        };
 #pragma warning(pop)
 
-                // converts to local time from utc
-                if (!LOCALTIME(&result, &utc))
+        // converts to local time from utc
+        if (!LOCALTIME(&result, &utc))
+        {
+            // localtime() set dst, put_time adjusts time accordingly which is not what we want since
+            // we have already taken cared of it in our calculation
+            if (result.tm_isdst == 1)
+            {
+                result.tm_hour -= 1;
+            }
+
+            if (expression.isDate)
+            {
+                switch (expression.style)
                 {
-                    // localtime() set dst, put_time adjusts time accordingly which is not what we want since
-                    // we have already taken cared of it in our calculation
-                    if (result.tm_isdst == 1)
-                    {
-                        result.tm_hour -= 1;
-                    }
-
-                    if (isDate)
-                    {
-                        switch (formatStyle)
-                        {
-                        // SHORT Style
-                        case 'S':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateShort);
-                            break;
-                        // LONG Style
-                        case 'L':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateLong);
-                            break;
-                        // COMPACT or DEFAULT Style
-                        case 'C':
-                        default:
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateCompact);
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        std::ostringstream parsedTime;
-                        parsedTime << std::put_time(&result, "%I:%M %p");
-                        AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
-                    }
+                // SHORT Style
+                case 'S':
+                    AddDateToken(buffer, expressionText, result, DateTimePreparsedTokenFormat::DateShort);
+                    break;
+                // LONG Style
+                case 'L':
+                    AddDateToken(buffer, expressionText, result, DateTimePreparsedTokenFormat::DateLong);
+                    break;
+                // COMPACT or DEFAULT Style
+                case 'C':
+                default:
+                    AddDateToken(buffer, expressionText, result, DateTimePreparsedTokenFormat::DateCompact);
+                    break;
                 }
             }
             else
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
+                AddTimeToken(buffer, result);
             }
-
-            text = matches.suffix().str();
         }
-
-        AddTextToken(text, DateTimePreparsedTokenFormat::RegularString);
     }
-    else
+    AddTextToken(buffer, in.substr(textStart));
+
+    // m_formattedText won't grow anymore, so the TIME() tokens can point into it now
+    const std::string_view formattedText = buffer.m_formattedText;
+    for (size_t i = 0; i < buffer.m_formattedTokens.size(); ++i)
     {
-        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+        const auto& [tokenIndex, formattedStart] = buffer.m_formattedTokens[i];
+        const size_t formattedEnd =
+            (i + 1 < buffer.m_formattedTokens.size()) ? buffer.m_formattedTokens[i + 1].second : formattedText.size();
+        buffer.m_tokens[tokenIndex].text = formattedText.substr(formattedStart, formattedEnd - formattedStart);
     }
 }
 
 // Parses a time of the form HH:MM
 bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
 {
-    std::smatch subMatches;
-    static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, timeMatch))
+    size_t index = 0;
+    int parsedHours{}, parsedMinutes{};
+    if (TryScanDigits(string, index, 2, parsedHours) && TryScanLiteral(string, index, ":") &&
+        TryScanDigits(string, index, 2, parsedMinutes) && index == string.size())
     {
-        if (subMatches[1].matched && subMatches[2].matched)
+        if (IsValidTime(parsedHours, parsedMinutes, 0))
         {
-            unsigned int parsedHours = std::stoul(subMatches[1]);
-            unsigned int parsedMinutes = std::stoul(subMatches[2]);
-
-            if (IsValidTime(parsedHours, parsedMinutes, 0))
-            {
-                hours = parsedHours;
-                minutes = parsedMinutes;
-                return true;
-            }
+            hours = parsedHours;
+            minutes = parsedMinutes;
+            return true;
         }
     }
     return false;
@@ -298,23 +436,18 @@ bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned i
 // Parses a date of the form YYYY-MM-DD
 bool DateTimePreparser::TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day)
 {
-    std::smatch subMatches;
-    static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, dateMatch))
+    size_t index = 0;
+    int parsedYear{}, parsedMonth{}, parsedDay{};
+    if (TryScanDigits(string, index, 4, parsedYear) && TryScanLiteral(string, index, "-") &&
+        TryScanDigits(string, index, 2, parsedMonth) && TryScanLiteral(string, index, "-") &&
+        TryScanDigits(string, index, 2, parsedDay) && index == string.size())
     {
-        if (subMatches[1].matched && subMatches[2].matched && subMatches[3].matched)
+        if (IsValidDate(parsedYear, parsedMonth, parsedDay))
         {
-            unsigned int parsedYear = std::stoul(subMatches[1]);
-            unsigned int parsedMonth = std::stoul(subMatches[2]);
-            unsigned int parsedDay = std::stoul(subMatches[3]);
-
-            if (IsValidDate(parsedYear, parsedMonth, parsedDay))
-            {
-                year = parsedYear;
-                month = parsedMonth;
-                day = parsedDay;
-                return true;
-            }
+            year = parsedYear;
+            month = parsedMonth;
+            day = parsedDay;
+            return true;
         }
     }
     return false;
@@ -7,21 +7,56 @@
 
 namespace AdaptiveCards
 {
+// A token produced by DateTimePreparser::Tokenize. text is a slice of the tokenized string, except for TIME() tokens,
+// whose formatted text lives in the DateTimeTokenBuffer. date is only set for date tokens.
+struct DateTimeTextToken
+{
+    std::string_view text;
+    DateTimePreparsedTokenFormat format;
+    struct tm date;
+};
+
+// Holds the tokens of one string. Tokenizing into a buffer clears it but keeps its capacity, so a single buffer can
+// be reused for every text element of a card without allocating per token.
+class DateTimeTokenBuffer
+{
+public:
+    DateTimeTokenBuffer();
+
+    const std::vector<DateTimeTextToken>& GetTokens() const;
+    bool HasDateTokens() const;
+    void Clear();
+
+private:
+    friend class DateTimePreparser;
+
+    std::vector<DateTimeTextToken> m_tokens;
+    // text of the TIME() tokens, and where each of them is in it. Tokens only point into m_formattedText once
+    // tokenizing is done, since it may reallocate until then.
+    std::string m_formattedText;
+    std::vector<std::pair<size_t, size_t>> m_formattedTokens;
+    bool m_hasDateTokens;
+};
+
 class DateTimePreparser
 {
 public:
     DateTimePreparser();
     DateTimePreparser(const std::string& in);
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
+    const std::vector<std::shared_ptr<DateTimePreparsedToken>>& GetTextTokens() const;
     bool HasDateTokens() const;
+
+    // Splits in into text and {{DATE()}}/{{TIME()}} tokens. The tokens are valid until in or buffer change.
+    static void Tokenize(std::string_view in, DateTimeTokenBuffer& buffer);
+
     static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
     static bool TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day);
 
 private:
-    void AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format);
-    void AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format);
+    static void AddTextToken(DateTimeTokenBuffer& buffer, std::string_view text);
+    static void AddTimeToken(DateTimeTokenBuffer& buffer, const struct tm& time);
+    static void AddDateToken(DateTimeTokenBuffer& buffer, std::string_view text, const struct tm& date, DateTimePreparsedTokenFormat format);
     std::string Concatenate() const;
-    void ParseDateTime(const std::string& in);
     static inline bool IsValidDate(const int year, const int month, const int day);
     static inline bool IsValidTime(const int hours, const int minutes, const int seconds);
     static inline bool IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes);
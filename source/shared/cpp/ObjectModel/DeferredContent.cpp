@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "DeferredContent.h"
+#include "ParseUtil.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+enum class ScanKind
+{
+    Element,
+    TableRow,
+    TableCell,
+};
+
+const Json::Value& GetMember(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    return ParseUtil::ExtractJsonValue(json, key, false);
+}
+
+// The fallback content of an element is parsed between pushing the element's id again, as fallback, and popping it
+void ScanFallback(ParseContext& context, const Json::Value& json, const std::string& id, InternalId internalId, bool isAction)
+{
+    const auto& fallback = GetMember(json, AdaptiveCardSchemaKey::Fallback);
+    if (!fallback.isObject())
+    {
+        return;
+    }
+
+    context.PushElement(id, internalId, true /*isFallback*/);
+    if (isAction)
+    {
+        DeferredContentIds::ScanAction(context, fallback);
+    }
+    else
+    {
+        DeferredContentIds::ScanElement(context, fallback);
+    }
+    context.PopElement();
+}
+
+void ScanElements(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, ScanKind kind);
+
+void ScanActions(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    const auto& actions = GetMember(json, key);
+    if (actions.isArray())
+    {
+        for (const auto& action : actions)
+        {
+            DeferredContentIds::ScanAction(context, action);
+        }
+    }
+}
+
+void ScanAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    const auto& action = GetMember(json, key);
+    if (action.isObject())
+    {
+        DeferredContentIds::ScanAction(context, action);
+    }
+}
+
+// The children an element of type has, in the order its parser parses them
+void ScanChildren(ParseContext& context, const Json::Value& json, CardElementType type)
+{
+    switch (type)
+    {
+    case CardElementType::Container:
+    case CardElementType::Column:
+    case CardElementType::CarouselPage:
+    case CardElementType::TableCell:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Items, ScanKind::Element);
+        ScanAction(context, json, AdaptiveCardSchemaKey::SelectAction);
+        break;
+    case CardElementType::ColumnSet:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Columns, ScanKind::Element);
+        ScanAction(context, json, AdaptiveCardSchemaKey::SelectAction);
+        break;
+    case CardElementType::Carousel:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Pages, ScanKind::Element);
+        ScanAction(context, json, AdaptiveCardSchemaKey::SelectAction);
+        break;
+    case CardElementType::Table:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Rows, ScanKind::TableRow);
+        break;
+    case CardElementType::TableRow:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Cells, ScanKind::TableCell);
+        break;
+    case CardElementType::ActionSet:
+        ScanActions(context, json, AdaptiveCardSchemaKey::Actions);
+        break;
+    case CardElementType::Image:
+        ScanAction(context, json, AdaptiveCardSchemaKey::SelectAction);
+        break;
+    case CardElementType::ImageSet:
+        ScanElements(context, json, AdaptiveCardSchemaKey::Images, ScanKind::Element);
+        break;
+    case CardElementType::RichTextBlock:
+        if (const auto& inlines = GetMember(json, AdaptiveCardSchemaKey::Inlines); inlines.isArray())
+        {
+            for (const auto& textRun : inlines)
+            {
+                if (textRun.isObject())
+                {
+                    ScanAction(context, textRun, AdaptiveCardSchemaKey::SelectAction);
+                }
+            }
+        }
+        break;
+    case CardElementType::TextInput:
+        ScanAction(context, json, AdaptiveCardSchemaKey::InlineAction);
+        break;
+    default:
+        break;
+    }
+}
+
+// Elements are pushed by the parser wrapper, except for table rows and cells, which push themselves
+void ScanElement(ParseContext& context, const Json::Value& json, ScanKind kind)
+{
+    if (!json.isObject())
+    {
+        return;
+    }
+
+    CardElementType type = CardElementType::Unknown;
+    switch (kind)
+    {
+    case ScanKind::TableRow:
+        type = CardElementType::TableRow;
+        break;
+    case ScanKind::TableCell:
+        type = CardElementType::TableCell;
+        break;
+    default:
+        // types without a parser are parsed as UnknownElements, which have no children
+        const std::string typeString = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Type);
+        if (context.elementParserRegistration->GetParser(typeString))
+        {
+            type = CardElementTypeTryFromString(typeString).value_or(CardElementType::Unknown);
+        }
+        break;
+    }
+
+    const std::string id = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id);
+    const InternalId internalId = InternalId::Next();
+
+    context.PushElement(id, internalId);
+    ScanFallback(context, json, id, internalId, false);
+    ScanChildren(context, json, type);
+    context.PopElement();
+}
+
+void ScanElements(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, ScanKind kind)
+{
+    const auto& elements = GetMember(json, key);
+    if (elements.isArray())
+    {
+        for (const auto& element : elements)
+        {
+            ScanElement(context, element, kind);
+        }
+    }
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+bool DeferredContentIds::IsDeferring(const ParseContext& context)
+{
+    return context.GetDeferNestedContent() && context.elementParserRegistration->GetRevision() == 0 &&
+           context.actionParserRegistration->GetRevision() == 0;
+}
+
+void DeferredContentIds::ScanCard(ParseContext& context, const Json::Value& json)
+{
+    if (const auto& refresh = GetMember(json, AdaptiveCardSchemaKey::Refresh); refresh.isObject())
+    {
+        ::ScanAction(context, refresh, AdaptiveCardSchemaKey::Action);
+    }
+    ScanElements(context, json, AdaptiveCardSchemaKey::Body, ScanKind::Element);
+    ScanActions(context, json, AdaptiveCardSchemaKey::Actions);
+    ::ScanAction(context, json, AdaptiveCardSchemaKey::SelectAction);
+}
+
+void DeferredContentIds::ScanElement(ParseContext& context, const Json::Value& json)
+{
+    ::ScanElement(context, json, ScanKind::Element);
+}
+
+void DeferredContentIds::ScanAction(ParseContext& context, const Json::Value& json)
+{
+    if (!json.isObject())
+    {
+        return;
+    }
+
+    const std::string typeString = ParseUtil::GetTypeAsString(json);
+    context.ShouldParse(typeString);
+
+    const std::string id = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id);
+    const InternalId internalId = InternalId::Next();
+
+    context.PushElement(id, internalId);
+    ScanFallback(context, json, id, internalId, true);
+    if (context.actionParserRegistration->GetParser(typeString) &&
+        ActionTypeTryFromString(typeString) == ActionType::ShowCard)
+    {
+        if (const auto& card = GetMember(json, AdaptiveCardSchemaKey::Card); card.isObject())
+        {
+            ScanCard(context, card);
+        }
+    }
+    context.PopElement();
+}
+} // namespace AdaptiveCards
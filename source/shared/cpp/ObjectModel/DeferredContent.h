@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+
+#include <mutex>
+
+namespace AdaptiveCards
+{
+// Nested content (the card of an Action.ShowCard, the fallback content of an element or action) that's kept as json
+// and parsed the first time it's asked for, when ParseContext::GetDeferNestedContent() is set. It's parsed with the
+// settings and scope (styles, bleed, language and so on) its parent had, so it comes out as it would have had it been
+// parsed along with the rest of the card. Copies of an element share its deferred content, which is parsed at most
+// once however many threads ask for it.
+template <typename T>
+class DeferredContent
+{
+public:
+    using Parser = std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value& json)>;
+
+    // Points into the json context is parsing when the parse owns it, which keeps all of that json alive until the
+    // content is parsed, and copies json otherwise
+    DeferredContent(const ParseContext& context, const Json::Value& json, Parser parser) :
+        m_context(context.CreateSubtreeContext()),
+        m_json(context.m_sourceJson ? std::shared_ptr<const Json::Value>(context.m_sourceJson, &json) :
+                                      std::make_shared<const Json::Value>(json)),
+        m_parser(std::move(parser))
+    {
+        // content deferred again within this content points into the same json
+        m_context->m_sourceJson = m_json;
+    }
+
+    DeferredContent(const DeferredContent&) = delete;
+    DeferredContent& operator=(const DeferredContent&) = delete;
+
+    // Parses the content if it hasn't been parsed yet. If parsing throws, the exception is passed on and the next call
+    // tries again. Warnings the parse gives are dropped, as there's no parse result left to give them to.
+    const std::shared_ptr<T>& Get() const
+    {
+        std::call_once(m_parsed, [this]() {
+            m_content = m_parser(*m_context, *m_json);
+            if (m_afterParse)
+            {
+                m_afterParse(*m_content);
+            }
+
+            m_context.reset();
+            std::atomic_store(&m_json, std::shared_ptr<const Json::Value>());
+        });
+        return m_content;
+    }
+
+    // The json the content is parsed from, or nullptr once it's been parsed
+    std::shared_ptr<const Json::Value> GetJson() const
+    {
+        return std::atomic_load(&m_json);
+    }
+
+    // Has fixup change the content once it's parsed, for changes a parse makes to nested content after parsing it
+    void SetAfterParse(std::function<void(T&)> fixup)
+    {
+        m_afterParse = std::move(fixup);
+    }
+
+private:
+    mutable std::once_flag m_parsed;
+    mutable std::optional<ParseContext> m_context;
+    mutable std::shared_ptr<const Json::Value> m_json;
+    Parser m_parser;
+    std::function<void(T&)> m_afterParse;
+    mutable std::shared_ptr<T> m_content;
+};
+
+// Deferring nested content skips parsing it, but its ids still have to be checked for collisions with the rest of the
+// card as the card's parsed. These make the ParseContext::Push/PopElement calls on context that parsing json with the
+// built-in parsers would, without parsing it.
+class DeferredContentIds
+{
+public:
+    // Whether nested content parsed with context is deferred: GetDeferNestedContent() has to be set, and only the
+    // built-in parsers registered, since the scans can't know which ids a custom parser would push
+    static bool IsDeferring(const ParseContext& context);
+
+    static void ScanCard(ParseContext& context, const Json::Value& json);
+    static void ScanElement(ParseContext& context, const Json::Value& json);
+    static void ScanAction(ParseContext& context, const Json::Value& json);
+};
+} // namespace AdaptiveCards
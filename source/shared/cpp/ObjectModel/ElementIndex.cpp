@@ -0,0 +1,433 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ElementIndex.h"
+#include "ActionSet.h"
+#include "Carousel.h"
+#include "CarouselPage.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "ParseUtil.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "ToggleVisibilityTarget.h"
+
+namespace
+{
+using namespace AdaptiveCards;
+
+const Json::Value& GetMember(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    return ParseUtil::ExtractJsonValue(json, key, false);
+}
+
+std::string GetStringMember(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    const auto& value = GetMember(json, key);
+    return value.isString() ? value.asString() : std::string();
+}
+
+void AddActionIds(const Json::Value& json, std::vector<std::string>& ids);
+void AddElementIds(const Json::Value& json, CardElementType impliedType, std::vector<std::string>& ids);
+
+void AddActionsIds(const Json::Value& json, AdaptiveCardSchemaKey key, std::vector<std::string>& ids)
+{
+    if (const auto& actions = GetMember(json, key); actions.isArray())
+    {
+        for (const auto& action : actions)
+        {
+            AddActionIds(action, ids);
+        }
+    }
+}
+
+void AddElementsIds(const Json::Value& json, AdaptiveCardSchemaKey key, CardElementType impliedType, std::vector<std::string>& ids)
+{
+    if (const auto& elements = GetMember(json, key); elements.isArray())
+    {
+        for (const auto& element : elements)
+        {
+            AddElementIds(element, impliedType, ids);
+        }
+    }
+}
+
+// The ids the json of a card adds to the index once it's parsed, in the order ElementIndex::AddCard adds them
+void AddCardIds(const Json::Value& json, std::vector<std::string>& ids)
+{
+    AddElementsIds(json, AdaptiveCardSchemaKey::Body, CardElementType::Unknown, ids);
+    AddActionsIds(json, AdaptiveCardSchemaKey::Actions, ids);
+    AddActionIds(GetMember(json, AdaptiveCardSchemaKey::SelectAction), ids);
+}
+
+void AddActionIds(const Json::Value& json, std::vector<std::string>& ids)
+{
+    if (!json.isObject())
+    {
+        return;
+    }
+
+    ids.push_back(GetStringMember(json, AdaptiveCardSchemaKey::Id));
+    if (ActionTypeTryFromString(GetStringMember(json, AdaptiveCardSchemaKey::Type)) == ActionType::ShowCard)
+    {
+        if (const auto& card = GetMember(json, AdaptiveCardSchemaKey::Card); card.isObject())
+        {
+            AddCardIds(card, ids);
+        }
+    }
+}
+
+// Table rows and cells are parsed as such whatever their type, and other elements as impliedType when they have none
+void AddElementIds(const Json::Value& json, CardElementType impliedType, std::vector<std::string>& ids)
+{
+    if (!json.isObject())
+    {
+        return;
+    }
+
+    ids.push_back(GetStringMember(json, AdaptiveCardSchemaKey::Id));
+
+    CardElementType type = impliedType;
+    if (impliedType != CardElementType::TableRow && impliedType != CardElementType::TableCell)
+    {
+        if (const auto typeString = GetStringMember(json, AdaptiveCardSchemaKey::Type); !typeString.empty())
+        {
+            type = CardElementTypeTryFromString(typeString).value_or(CardElementType::Unknown);
+        }
+    }
+
+    switch (type)
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    case CardElementType::CarouselPage:
+    case CardElementType::Column:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Items, CardElementType::Unknown, ids);
+        AddActionIds(GetMember(json, AdaptiveCardSchemaKey::SelectAction), ids);
+        break;
+    case CardElementType::ColumnSet:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Columns, CardElementType::Column, ids);
+        AddActionIds(GetMember(json, AdaptiveCardSchemaKey::SelectAction), ids);
+        break;
+    case CardElementType::Carousel:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Pages, CardElementType::Unknown, ids);
+        AddActionIds(GetMember(json, AdaptiveCardSchemaKey::SelectAction), ids);
+        break;
+    case CardElementType::Table:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Rows, CardElementType::TableRow, ids);
+        break;
+    case CardElementType::TableRow:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Cells, CardElementType::TableCell, ids);
+        break;
+    case CardElementType::ActionSet:
+        AddActionsIds(json, AdaptiveCardSchemaKey::Actions, ids);
+        break;
+    case CardElementType::Image:
+        AddActionIds(GetMember(json, AdaptiveCardSchemaKey::SelectAction), ids);
+        break;
+    case CardElementType::ImageSet:
+        AddElementsIds(json, AdaptiveCardSchemaKey::Images, CardElementType::Image, ids);
+        break;
+    case CardElementType::TextInput:
+        AddActionIds(GetMember(json, AdaptiveCardSchemaKey::InlineAction), ids);
+        break;
+    case CardElementType::RichTextBlock:
+        if (const auto& inlines = GetMember(json, AdaptiveCardSchemaKey::Inlines); inlines.isArray())
+        {
+            for (const auto& textRun : inlines)
+            {
+                if (textRun.isObject())
+                {
+                    AddActionIds(GetMember(textRun, AdaptiveCardSchemaKey::SelectAction), ids);
+                }
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+ElementIndex::ElementIndex(const AdaptiveCard& card)
+{
+    AddCard(card, c_noParent);
+}
+
+std::shared_ptr<BaseElement> ElementIndex::GetElement(const std::string& id) const
+{
+    if (const Entry* entry = Find(id))
+    {
+        return entry->element;
+    }
+    const DeferredCard* card = FindDeferredCard(id);
+    return card ? GetIndex(*card).GetElement(id) : nullptr;
+}
+
+std::shared_ptr<BaseCardElement> ElementIndex::GetCardElement(const std::string& id) const
+{
+    if (const Entry* entry = Find(id))
+    {
+        return !entry->isAction ? std::static_pointer_cast<BaseCardElement>(entry->element) : nullptr;
+    }
+    const DeferredCard* card = FindDeferredCard(id);
+    return card ? GetIndex(*card).GetCardElement(id) : nullptr;
+}
+
+std::shared_ptr<BaseActionElement> ElementIndex::GetAction(const std::string& id) const
+{
+    if (const Entry* entry = Find(id))
+    {
+        return entry->isAction ? std::static_pointer_cast<BaseActionElement>(entry->element) : nullptr;
+    }
+    const DeferredCard* card = FindDeferredCard(id);
+    return card ? GetIndex(*card).GetAction(id) : nullptr;
+}
+
+std::shared_ptr<BaseCardElement> ElementIndex::GetTargetElement(const ToggleVisibilityTarget& target) const
+{
+    return GetCardElement(target.GetElementId());
+}
+
+std::vector<std::shared_ptr<BaseElement>> ElementIndex::GetAncestors(const std::string& id) const
+{
+    std::vector<std::shared_ptr<BaseElement>> ancestors;
+    if (const Entry* entry = Find(id))
+    {
+        AddAncestors(entry->parent, ancestors);
+        std::reverse(ancestors.begin(), ancestors.end());
+    }
+    else if (const DeferredCard* card = FindDeferredCard(id))
+    {
+        const auto cardAncestors = GetIndex(*card).GetAncestors(id);
+        AddAncestors(card->parent, ancestors);
+        std::reverse(ancestors.begin(), ancestors.end());
+        ancestors.insert(ancestors.end(), cardAncestors.begin(), cardAncestors.end());
+    }
+    return ancestors;
+}
+
+size_t ElementIndex::GetIdCount() const
+{
+    return m_entriesById.size() + m_deferredIds.size();
+}
+
+const ElementIndex::Entry* ElementIndex::Find(const std::string& id) const
+{
+    const auto entry = m_entriesById.find(id);
+    return entry != m_entriesById.end() ? &m_entries[entry->second] : nullptr;
+}
+
+const ElementIndex::DeferredCard* ElementIndex::FindDeferredCard(const std::string& id) const
+{
+    const auto card = m_deferredIds.find(id);
+    return card != m_deferredIds.end() ? m_deferredCards[card->second].get() : nullptr;
+}
+
+const ElementIndex& ElementIndex::GetIndex(const DeferredCard& card)
+{
+    // if parsing the card throws, the next lookup tries again
+    std::call_once(card.indexed, [&card]() { card.index = std::make_shared<const ElementIndex>(*card.card->Get()); });
+    return *card.index;
+}
+
+void ElementIndex::AddAncestors(size_t parent, std::vector<std::shared_ptr<BaseElement>>& ancestors) const
+{
+    for (; parent != c_noParent; parent = m_entries[parent].parent)
+    {
+        ancestors.push_back(m_entries[parent].element);
+    }
+}
+
+void ElementIndex::AddCard(const AdaptiveCard& card, size_t parent)
+{
+    AddElements(card.GetBody(), parent);
+    AddActions(card.GetActions(), parent);
+    AddAction(card.GetSelectAction(), parent);
+}
+
+template <typename T>
+void ElementIndex::AddElements(const std::vector<std::shared_ptr<T>>& elements, size_t parent)
+{
+    for (const auto& element : elements)
+    {
+        AddElement(element, parent);
+    }
+}
+
+void ElementIndex::AddActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, size_t parent)
+{
+    for (const auto& action : actions)
+    {
+        AddAction(action, parent);
+    }
+}
+
+void ElementIndex::AddElement(const std::shared_ptr<BaseCardElement>& element, size_t parent)
+{
+    if (!element)
+    {
+        return;
+    }
+
+    const size_t entry = m_entries.size();
+    m_entries.push_back({element, false, parent});
+    if (!element->GetId().empty())
+    {
+        // fallback content isn't indexed, so the first element with an id is the only one
+        m_entriesById.emplace(element->GetId(), entry);
+    }
+
+    switch (element->GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    case CardElementType::CarouselPage:
+    {
+        const auto container = std::static_pointer_cast<Container>(element);
+        AddElements(container->GetItems(), entry);
+        AddAction(container->GetSelectAction(), entry);
+        break;
+    }
+    case CardElementType::Column:
+    {
+        const auto column = std::static_pointer_cast<Column>(element);
+        AddElements(column->GetItems(), entry);
+        AddAction(column->GetSelectAction(), entry);
+        break;
+    }
+    case CardElementType::ColumnSet:
+    {
+        const auto columnSet = std::static_pointer_cast<ColumnSet>(element);
+        AddElements(columnSet->GetColumns(), entry);
+        AddAction(columnSet->GetSelectAction(), entry);
+        break;
+    }
+    case CardElementType::Carousel:
+    {
+        const auto carousel = std::static_pointer_cast<Carousel>(element);
+        AddElements(carousel->GetPages(), entry);
+        AddAction(carousel->GetSelectAction(), entry);
+        break;
+    }
+    case CardElementType::Table:
+        AddElements(std::static_pointer_cast<Table>(element)->GetRows(), entry);
+        break;
+    case CardElementType::TableRow:
+        AddElements(std::static_pointer_cast<TableRow>(element)->GetCells(), entry);
+        break;
+    case CardElementType::ActionSet:
+        AddActions(std::static_pointer_cast<ActionSet>(element)->GetActions(), entry);
+        break;
+    case CardElementType::Image:
+        AddAction(std::static_pointer_cast<Image>(element)->GetSelectAction(), entry);
+        break;
+    case CardElementType::ImageSet:
+        AddElements(std::static_pointer_cast<ImageSet>(element)->GetImages(), entry);
+        break;
+    case CardElementType::TextInput:
+        AddAction(std::static_pointer_cast<TextInput>(element)->GetInlineAction(), entry);
+        break;
+    case CardElementType::RichTextBlock:
+        for (const auto& inlineElement : std::static_pointer_cast<RichTextBlock>(element)->GetInlines())
+        {
+            if (const auto textRun = std::dynamic_pointer_cast<TextRun>(inlineElement))
+            {
+                AddAction(textRun->GetSelectAction(), entry);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void ElementIndex::AddAction(const std::shared_ptr<BaseActionElement>& action, size_t parent)
+{
+    if (!action)
+    {
+        return;
+    }
+
+    const size_t entry = m_entries.size();
+    m_entries.push_back({action, true, parent});
+    if (!action->GetId().empty())
+    {
+        m_entriesById.emplace(action->GetId(), entry);
+    }
+
+    if (action->GetElementType() == ActionType::ShowCard)
+    {
+        const auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
+        // a deferred card drops its json once it's parsed, and from then on is indexed like any other
+        const auto deferredCard = showCardAction->GetDeferredCard();
+        if (const auto json = deferredCard ? deferredCard->GetJson() : nullptr)
+        {
+            AddDeferredCard(deferredCard, *json, entry);
+        }
+        else if (const auto& card = showCardAction->GetCard())
+        {
+            AddCard(*card, entry);
+        }
+    }
+}
+
+void ElementIndex::AddDeferredCard(const std::shared_ptr<const DeferredContent<AdaptiveCard>>& card, const Json::Value& json, size_t parent)
+{
+    const size_t deferredCard = m_deferredCards.size();
+    m_deferredCards.push_back(std::make_unique<DeferredCard>());
+    m_deferredCards.back()->card = card;
+    m_deferredCards.back()->parent = parent;
+
+    std::vector<std::string> ids;
+    AddCardIds(json, ids);
+    for (const auto& id : ids)
+    {
+        if (!id.empty() && m_entriesById.find(id) == m_entriesById.end())
+        {
+            m_deferredIds.emplace(id, deferredCard);
+        }
+    }
+}
+
+ElementIndexCache::ElementIndexCache(const ElementIndexCache&)
+{
+}
+
+ElementIndexCache& ElementIndexCache::operator=(const ElementIndexCache&)
+{
+    Reset();
+    return *this;
+}
+
+std::shared_ptr<const ElementIndex> ElementIndexCache::Get(const AdaptiveCard& card) const
+{
+    auto index = std::atomic_load(&m_index);
+    if (!index)
+    {
+        // threads that get here at once each build an index, and all but the first to finish drop theirs
+        auto builtIndex = std::make_shared<const ElementIndex>(card);
+        if (std::atomic_compare_exchange_strong(&m_index, &index, builtIndex))
+        {
+            index = std::move(builtIndex);
+        }
+    }
+    return index;
+}
+
+void ElementIndexCache::Reset()
+{
+    std::atomic_store(&m_index, std::shared_ptr<const ElementIndex>());
+}
+} // namespace AdaptiveCards
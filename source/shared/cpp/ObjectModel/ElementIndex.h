@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+#include <mutex>
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseActionElement;
+class BaseCardElement;
+class BaseElement;
+class ToggleVisibilityTarget;
+template <typename T>
+class DeferredContent;
+
+// The elements and actions of a card by id, for finding the targets of an Action.ToggleVisibility, the inputs of a
+// card and so on without walking the card each time. It covers the cards of Action.ShowCard actions, which share their
+// card's ids, but not fallback content; a card resolved with ResolveFallback has the fallback content it renders in
+// its tree instead. Ids are unique within a parsed card, apart from fallback content, so each id names one element or
+// action. The index is of the card as it was when the index was built.
+//
+// A ShowCard card whose parse is deferred (see ParseContext::SetDeferNestedContent) isn't parsed to index it: its ids
+// are read from its json, and the card is only parsed, and indexed, once one of them is looked up. That lookup throws
+// whatever error parsing the card throws.
+class ElementIndex
+{
+public:
+    explicit ElementIndex(const AdaptiveCard& card);
+
+    // The element or action with id, or nullptr when the card has none
+    std::shared_ptr<BaseElement> GetElement(const std::string& id) const;
+    // The element with id, or nullptr when the card has none (or id is an action's)
+    std::shared_ptr<BaseCardElement> GetCardElement(const std::string& id) const;
+    // The action with id, or nullptr when the card has none (or id is an element's)
+    std::shared_ptr<BaseActionElement> GetAction(const std::string& id) const;
+    // The element target shows or hides, or nullptr when the card has none with its id
+    std::shared_ptr<BaseCardElement> GetTargetElement(const ToggleVisibilityTarget& target) const;
+
+    // The elements and actions that the element or action with id is in, from the one in the card's body or actions
+    // down to its parent. Those of the card of an Action.ShowCard are in the action. Empty when the card has no element
+    // or action with id, or when it's in the card's body or actions itself.
+    std::vector<std::shared_ptr<BaseElement>> GetAncestors(const std::string& id) const;
+
+    size_t GetIdCount() const;
+
+private:
+    static constexpr size_t c_noParent = static_cast<size_t>(-1);
+
+    struct Entry
+    {
+        std::shared_ptr<BaseElement> element;
+        bool isAction;
+        // The entry of the element or action this one is in
+        size_t parent;
+    };
+
+    void AddCard(const AdaptiveCard& card, size_t parent);
+    void AddElement(const std::shared_ptr<BaseCardElement>& element, size_t parent);
+    void AddAction(const std::shared_ptr<BaseActionElement>& action, size_t parent);
+    template <typename T>
+    void AddElements(const std::vector<std::shared_ptr<T>>& elements, size_t parent);
+    void AddActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, size_t parent);
+
+    // A ShowCard card that hadn't been parsed when the index was built
+    struct DeferredCard
+    {
+        std::shared_ptr<const DeferredContent<AdaptiveCard>> card;
+        // The entry of the ShowCard action
+        size_t parent;
+        mutable std::once_flag indexed;
+        mutable std::shared_ptr<const ElementIndex> index;
+    };
+
+    void AddDeferredCard(const std::shared_ptr<const DeferredContent<AdaptiveCard>>& card, const Json::Value& json, size_t parent);
+
+    const Entry* Find(const std::string& id) const;
+    // The deferred card the element or action with id is in, or nullptr when id isn't in one
+    const DeferredCard* FindDeferredCard(const std::string& id) const;
+    // Parses and indexes card the first time it's called
+    static const ElementIndex& GetIndex(const DeferredCard& card);
+    // Adds the entry parent and those it's in to ancestors, from parent up
+    void AddAncestors(size_t parent, std::vector<std::shared_ptr<BaseElement>>& ancestors) const;
+
+    // Every element and action of the card, including those without an id, so that each one's parent is in here
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, size_t> m_entriesById;
+    std::vector<std::unique_ptr<DeferredCard>> m_deferredCards;
+    // The ids in deferred cards, to the deferred card each is in
+    std::unordered_map<std::string, size_t> m_deferredIds;
+};
+
+// Where a card keeps its ElementIndex once it's built. A copy of a card starts without an index, since the copy may be
+// changed. Get, Reset and copying may all happen on different threads at once; an index that's been handed out stays
+// as it was for as long as its caller holds on to it, even once it's been reset.
+class ElementIndexCache
+{
+public:
+    ElementIndexCache() = default;
+    ElementIndexCache(const ElementIndexCache&);
+    ElementIndexCache& operator=(const ElementIndexCache&);
+
+    // Builds the index of card the first time it's called; safe to call from several threads at once
+    std::shared_ptr<const ElementIndex> Get(const AdaptiveCard& card) const;
+    // Drops the index, so that the next Get builds it again
+    void Reset();
+
+private:
+    mutable std::shared_ptr<const ElementIndex> m_index;
+};
+} // namespace AdaptiveCards
@@ -22,6 +22,23 @@
 #include "TimeInput.h"
 #include "ToggleInput.h"
 #include "UnknownElement.h"
+#include <atomic>
+
+namespace
+{
+// Revisions are handed out process-wide so that no two registrations ever end up with the same one
+std::uint64_t NextRevision()
+{
+    static std::atomic<std::uint64_t> s_nextRevision{1};
+    return s_nextRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename TParser>
+std::shared_ptr<AdaptiveCards::BaseCardElementParser> MakeWrappedParser()
+{
+    return std::make_shared<AdaptiveCards::BaseCardElementParserWrapper>(std::make_shared<TParser>());
+}
+} // namespace
 
 namespace AdaptiveCards
 {
@@ -47,57 +64,76 @@ std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ElementParserRegistration::ElementParserRegistration()
+ElementParserRegistration::ElementParserRegistration() : m_cardElementParsers{GetBuiltInParsers()}, m_revision{0}
 {
-    m_knownElements.insert({CardElementTypeToString(CardElementType::ActionSet),
-                            CardElementTypeToString(CardElementType::Carousel),
-                            CardElementTypeToString(CardElementType::CarouselPage),
-                            CardElementTypeToString(CardElementType::ChoiceSetInput),
-                            CardElementTypeToString(CardElementType::Column),
-                            CardElementTypeToString(CardElementType::ColumnSet),
-                            CardElementTypeToString(CardElementType::Container),
-                            CardElementTypeToString(CardElementType::DateInput),
-                            CardElementTypeToString(CardElementType::FactSet),
-                            CardElementTypeToString(CardElementType::Image),
-                            CardElementTypeToString(CardElementType::ImageSet),
-                            CardElementTypeToString(CardElementType::Media),
-                            CardElementTypeToString(CardElementType::NumberInput),
-                            CardElementTypeToString(CardElementType::RichTextBlock),
-                            CardElementTypeToString(CardElementType::Table),
-                            CardElementTypeToString(CardElementType::TextBlock),
-                            CardElementTypeToString(CardElementType::TextInput),
-                            CardElementTypeToString(CardElementType::TimeInput),
-                            CardElementTypeToString(CardElementType::ToggleInput),
-                            CardElementTypeToString(CardElementType::Unknown)});
+}
 
-    m_cardElementParsers.insert(
-        {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-         {CardElementTypeToString(CardElementType::Carousel), std::make_shared<CarouselParser>()},
-         {CardElementTypeToString(CardElementType::CarouselPage), std::make_shared<CarouselPageParser>()},
-         {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-         {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-         {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-         {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-         {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-         {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-         {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-         {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-         {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-         {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-         {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-         {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
-         {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-         {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-         {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-         {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-         {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+const std::unordered_set<std::string>& ElementParserRegistration::GetKnownElements()
+{
+    static const std::unordered_set<std::string> knownElements{
+        CardElementTypeToString(CardElementType::ActionSet),
+        CardElementTypeToString(CardElementType::Carousel),
+        CardElementTypeToString(CardElementType::CarouselPage),
+        CardElementTypeToString(CardElementType::ChoiceSetInput),
+        CardElementTypeToString(CardElementType::Column),
+        CardElementTypeToString(CardElementType::ColumnSet),
+        CardElementTypeToString(CardElementType::Container),
+        CardElementTypeToString(CardElementType::DateInput),
+        CardElementTypeToString(CardElementType::FactSet),
+        CardElementTypeToString(CardElementType::Image),
+        CardElementTypeToString(CardElementType::ImageSet),
+        CardElementTypeToString(CardElementType::Media),
+        CardElementTypeToString(CardElementType::NumberInput),
+        CardElementTypeToString(CardElementType::RichTextBlock),
+        CardElementTypeToString(CardElementType::Table),
+        CardElementTypeToString(CardElementType::TextBlock),
+        CardElementTypeToString(CardElementType::TextInput),
+        CardElementTypeToString(CardElementType::TimeInput),
+        CardElementTypeToString(CardElementType::ToggleInput),
+        CardElementTypeToString(CardElementType::Unknown)};
+    return knownElements;
+}
+
+// Why do we wrap the parsers? As we parse elements, we need to push and pop state from the stack for ID collision
+// detection. We *could* do this within the implementation of parsers themselves, but that would mean having to explain
+// all of this to custom element parser implementors. Instead, we wrap every parser we hand out with a helper class that
+// performs the push/pop on behalf of the element parser. For more details, refer to the giant comment on ID collision
+// detection in ParseContext.cpp.
+//
+// GetParser is called for every element of every card, so parsers are wrapped once, when they're registered. The
+// built-in parsers hold no state, so they're wrapped once per process and shared by every registration.
+const ElementParserRegistration::ParserMap& ElementParserRegistration::GetBuiltInParsers()
+{
+    static const ParserMap builtInParsers{
+        {CardElementTypeToString(CardElementType::ActionSet), MakeWrappedParser<ActionSetParser>()},
+        {CardElementTypeToString(CardElementType::Carousel), MakeWrappedParser<CarouselParser>()},
+        {CardElementTypeToString(CardElementType::CarouselPage), MakeWrappedParser<CarouselPageParser>()},
+        {CardElementTypeToString(CardElementType::ChoiceSetInput), MakeWrappedParser<ChoiceSetInputParser>()},
+        {CardElementTypeToString(CardElementType::Column), MakeWrappedParser<ColumnParser>()},
+        {CardElementTypeToString(CardElementType::ColumnSet), MakeWrappedParser<ColumnSetParser>()},
+        {CardElementTypeToString(CardElementType::Container), MakeWrappedParser<ContainerParser>()},
+        {CardElementTypeToString(CardElementType::DateInput), MakeWrappedParser<DateInputParser>()},
+        {CardElementTypeToString(CardElementType::FactSet), MakeWrappedParser<FactSetParser>()},
+        {CardElementTypeToString(CardElementType::Image), MakeWrappedParser<ImageParser>()},
+        {CardElementTypeToString(CardElementType::ImageSet), MakeWrappedParser<ImageSetParser>()},
+        {CardElementTypeToString(CardElementType::Media), MakeWrappedParser<MediaParser>()},
+        {CardElementTypeToString(CardElementType::NumberInput), MakeWrappedParser<NumberInputParser>()},
+        {CardElementTypeToString(CardElementType::RichTextBlock), MakeWrappedParser<RichTextBlockParser>()},
+        {CardElementTypeToString(CardElementType::Table), MakeWrappedParser<TableParser>()},
+        {CardElementTypeToString(CardElementType::TextBlock), MakeWrappedParser<TextBlockParser>()},
+        {CardElementTypeToString(CardElementType::TextInput), MakeWrappedParser<TextInputParser>()},
+        {CardElementTypeToString(CardElementType::TimeInput), MakeWrappedParser<TimeInputParser>()},
+        {CardElementTypeToString(CardElementType::ToggleInput), MakeWrappedParser<ToggleInputParser>()},
+        {CardElementTypeToString(CardElementType::Unknown), MakeWrappedParser<UnknownElementParser>()}};
+    return builtInParsers;
 }
 
 void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (GetKnownElements().find(elementType) == GetKnownElements().end())
     {
-        ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+        ElementParserRegistration::m_cardElementParsers[elementType] = std::make_shared<BaseCardElementParserWrapper>(parser);
+        m_revision = NextRevision();
     }
     else
     {
@@ -108,9 +144,10 @@ void ElementParserRegistration::AddParser(std::string const& elementType, std::s
 
 void ElementParserRegistration::RemoveParser(std::string const& elementType)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (GetKnownElements().find(elementType) == GetKnownElements().end())
     {
         ElementParserRegistration::m_cardElementParsers.erase(elementType);
+        m_revision = NextRevision();
     }
     else
     {
@@ -124,17 +161,16 @@ std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std:
     auto parser = m_cardElementParsers.find(elementType);
     if (parser != ElementParserRegistration::m_cardElementParsers.end())
     {
-        // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
-        // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-        std::shared_ptr<BaseCardElementParser> wrappedParser = std::make_shared<BaseCardElementParserWrapper>(parser->second);
-        return wrappedParser;
+        return parser->second;
     }
     else
     {
         return std::shared_ptr<BaseCardElementParser>(nullptr);
     }
 }
+
+std::uint64_t ElementParserRegistration::GetRevision() const
+{
+    return m_revision;
+}
 } // namespace AdaptiveCards
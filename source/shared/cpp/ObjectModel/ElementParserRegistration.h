@@ -48,8 +48,20 @@ public:
     void RemoveParser(std::string const& elementType);
     std::shared_ptr<AdaptiveCards::BaseCardElementParser> GetParser(std::string const& elementType) const;
 
+    // Identifies the set of parsers currently registered. Every registration that only holds the built-in parsers
+    // reports 0. Adding or removing a parser moves the registration to a new revision that no other registration
+    // shares, so two registrations with the same revision always parse cards the same way.
+    std::uint64_t GetRevision() const;
+
 private:
-    std::unordered_set<std::string> m_knownElements;
-    std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+    using ParserMap =
+        std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo>;
+
+    static const std::unordered_set<std::string>& GetKnownElements();
+    static const ParserMap& GetBuiltInParsers();
+
+    // Every parser is held in the BaseCardElementParserWrapper that GetParser hands out
+    ParserMap m_cardElementParsers;
+    std::uint64_t m_revision;
 };
 } // namespace AdaptiveCards
@@ -5,13 +5,20 @@
 
 namespace AdaptiveCards
 {
+// Lowercases c if it's an ASCII letter. Unlike std::tolower, this doesn't consult a locale, and it's safe to call with
+// any char, including the negative ones of UTF-8 sequences, which it leaves untouched.
+constexpr char AsciiToLower(char c) noexcept
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
 struct CaseInsensitiveEqualTo
 {
     template <typename T>
     bool operator()(T const& lhs, T const& rhs) const noexcept
     {
         return std::equal(std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs), [](auto a, auto b) {
-            return std::toupper(a) == std::toupper(b);
+            return AsciiToLower(a) == AsciiToLower(b);
         });
     }
 };
@@ -21,8 +28,10 @@ struct CaseInsensitiveHash
     template <typename T>
     size_t operator()(T const& keyval) const noexcept
     {
-        return std::accumulate(
-            std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) { return acc + std::toupper(c); });
+        // Polynomial rather than a plain sum of the characters, so that anagrams don't all collide
+        return std::accumulate(std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) {
+            return acc * 31 + static_cast<size_t>(static_cast<unsigned char>(AsciiToLower(c)));
+        });
     }
 };
 
@@ -37,46 +46,257 @@ struct EnumHash
 
 namespace EnumHelpers
 {
-    // Manage mapping T<->std::string using two internal unordered_maps.
+    // An enum value and the string it serializes to
     template <typename T>
-    class EnumMapping
+    struct EnumEntry
     {
-    public:
-        // Initialize with a single list -> automatically generate reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-            _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
+        T value;
+        std::string_view name;
+    };
+
+    // A string that parses to value
+    template <typename T>
+    struct EnumAlias
+    {
+        std::string_view name;
+        T value;
+    };
+
+    // Strings that parse to a T on top of the ones its values serialize to. DEFINE_ADAPTIVECARD_ENUM_ALIASES
+    // specializes this for enums that have any.
+    template <typename T>
+    struct EnumAliases
+    {
+        static constexpr std::array<EnumAlias<T>, 0> values{};
+    };
+
+    constexpr bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept
+    {
+        if (lhs.size() != rhs.size())
         {
-            _GenerateStringToEnumMap();
+            return false;
         }
 
-        // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
-        // to the generated reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2) :
-            _enumToString{t1.begin(), t1.end()}, _stringToEnum(t2.begin(), t2.end())
+        for (size_t i = 0; i < lhs.size(); ++i)
         {
-            _GenerateStringToEnumMap();
+            if (AsciiToLower(lhs[i]) != AsciiToLower(rhs[i]))
+            {
+                return false;
+            }
         }
+        return true;
+    }
 
-        const std::string& toString(T t) const
+    // FNV-1a over the lowercased string, so that strings which only differ in case hash the same
+    constexpr uint64_t HashIgnoreCase(std::string_view str) noexcept
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char c : str)
         {
-            return _enumToString.at(t);
+            hash = (hash ^ static_cast<unsigned char>(AsciiToLower(c))) * 0x100000001b3ull;
         }
-        T fromString(const std::string& str) const
+        return hash;
+    }
+
+    // Derives a different slot index from hash for every displacement (murmur3's 64-bit finalizer)
+    constexpr uint64_t MixHash(uint64_t hash, uint32_t displacement) noexcept
+    {
+        hash ^= displacement * 0x9e3779b97f4a7c15ull;
+        hash = (hash ^ (hash >> 33)) * 0xff51afd7ed558ccdull;
+        hash = (hash ^ (hash >> 33)) * 0xc4ceb9fe1a85ec53ull;
+        return hash ^ (hash >> 33);
+    }
+
+    constexpr size_t NextPowerOfTwo(size_t value) noexcept
+    {
+        size_t powerOfTwo = 1;
+        while (powerOfTwo < value)
         {
-            return _stringToEnum.at(str);
+            powerOfTwo <<= 1;
+        }
+        return powerOfTwo;
+    }
+
+    // Case insensitive perfect hash from the N strings that parse to a T, built at compile time by hash and
+    // displace: every string falls into a bucket by its hash, and each bucket stores the displacement that sends all
+    // of its strings to free slots. A lookup hashes the string once and compares it against a single slot.
+    template <typename T, size_t N>
+    class StringToEnumTable
+    {
+    public:
+        // Aliases are considered before entries. If two strings are equal ignoring case, the first one wins.
+        constexpr StringToEnumTable(const EnumAlias<T>* aliases, size_t aliasCount, const EnumEntry<T>* entries)
+        {
+            EnumAlias<T> keys[N]{};
+            uint64_t hashes[N]{};
+            size_t bucketSizes[N]{};
+            for (size_t i = 0; i < N; ++i)
+            {
+                keys[i] = (i < aliasCount) ? aliases[i] : EnumAlias<T>{entries[i - aliasCount].name, entries[i - aliasCount].value};
+                hashes[i] = HashIgnoreCase(keys[i].name);
+                ++bucketSizes[hashes[i] % N];
+            }
+
+            // Group the keys by bucket, keeping them in their original order within a bucket
+            size_t bucketStarts[N]{};
+            size_t largestBucketSize = 0;
+            for (size_t bucket = 0, start = 0; bucket < N; ++bucket)
+            {
+                bucketStarts[bucket] = start;
+                start += bucketSizes[bucket];
+                largestBucketSize = std::max(largestBucketSize, bucketSizes[bucket]);
+            }
+
+            size_t keysByBucket[N]{};
+            size_t bucketEnds[N]{};
+            for (size_t bucket = 0; bucket < N; ++bucket)
+            {
+                bucketEnds[bucket] = bucketStarts[bucket];
+            }
+            for (size_t i = 0; i < N; ++i)
+            {
+                keysByBucket[bucketEnds[hashes[i] % N]++] = i;
+            }
+
+            // Equal strings hash the same, so duplicates always share a bucket with the string that wins
+            bool isDuplicate[N]{};
+            for (size_t bucket = 0; bucket < N; ++bucket)
+            {
+                for (size_t i = bucketStarts[bucket]; i < bucketEnds[bucket]; ++i)
+                {
+                    for (size_t j = bucketStarts[bucket]; j < i; ++j)
+                    {
+                        const size_t key = keysByBucket[i];
+                        const size_t earlierKey = keysByBucket[j];
+                        if (hashes[key] == hashes[earlierKey] && EqualsIgnoreCase(keys[key].name, keys[earlierKey].name))
+                        {
+                            isDuplicate[key] = true;
+                        }
+                    }
+                }
+            }
+
+            // Place the largest buckets first, while it's still easy to find room for them
+            for (size_t bucketSize = largestBucketSize; bucketSize > 0; --bucketSize)
+            {
+                for (size_t bucket = 0; bucket < N; ++bucket)
+                {
+                    if (bucketSizes[bucket] != bucketSize)
+                    {
+                        continue;
+                    }
+
+                    uint32_t displacement = 0;
+                    while (!TryPlaceBucket(displacement, &keysByBucket[bucketStarts[bucket]], bucketSize, keys, hashes, isDuplicate))
+                    {
+                        ++displacement;
+                    }
+                    m_displacements[bucket] = displacement;
+                }
+            }
+        }
+
+        constexpr std::optional<T> TryFind(std::string_view str) const noexcept
+        {
+            const uint64_t hash = HashIgnoreCase(str);
+            const EnumAlias<T>& slot = m_slots[GetSlot(hash, m_displacements[hash % N])];
+            if (!slot.name.empty() && EqualsIgnoreCase(slot.name, str))
+            {
+                return slot.value;
+            }
+            return std::nullopt;
         }
 
     private:
-        inline void _GenerateStringToEnumMap()
+        // Twice as many slots as strings keeps the search for displacements short
+        static constexpr size_t c_slotCount = NextPowerOfTwo(2 * N);
+
+        static constexpr size_t GetSlot(uint64_t hash, uint32_t displacement) noexcept
+        {
+            return static_cast<size_t>(MixHash(hash, displacement) & (c_slotCount - 1));
+        }
+
+        // Either places every key of the bucket in a free slot using displacement, or leaves the slots untouched
+        constexpr bool TryPlaceBucket(
+            uint32_t displacement,
+            const size_t* bucketKeys,
+            size_t bucketSize,
+            const EnumAlias<T> (&keys)[N],
+            const uint64_t (&hashes)[N],
+            const bool (&isDuplicate)[N])
+        {
+            size_t placedCount = 0;
+            for (; placedCount < bucketSize; ++placedCount)
+            {
+                const size_t key = bucketKeys[placedCount];
+                if (isDuplicate[key])
+                {
+                    continue;
+                }
+
+                EnumAlias<T>& slot = m_slots[GetSlot(hashes[key], displacement)];
+                if (!slot.name.empty())
+                {
+                    break;
+                }
+                slot = keys[key];
+            }
+
+            if (placedCount == bucketSize)
+            {
+                return true;
+            }
+
+            for (size_t i = 0; i < placedCount; ++i)
+            {
+                if (!isDuplicate[bucketKeys[i]])
+                {
+                    m_slots[GetSlot(hashes[bucketKeys[i]], displacement)] = EnumAlias<T>{};
+                }
+            }
+            return false;
+        }
+
+        uint32_t m_displacements[N]{};
+        EnumAlias<T> m_slots[c_slotCount]{};
+    };
+
+    template <typename T, size_t EntryCount, size_t AliasCount>
+    constexpr StringToEnumTable<T, AliasCount + EntryCount> MakeStringToEnumTable(
+        const EnumEntry<T> (&entries)[EntryCount], const EnumAlias<T> (&aliases)[AliasCount])
+    {
+        return StringToEnumTable<T, AliasCount + EntryCount>(aliases, AliasCount, entries);
+    }
+
+    template <typename T, size_t EntryCount>
+    constexpr StringToEnumTable<T, EntryCount> MakeStringToEnumTable(
+        const EnumEntry<T> (&entries)[EntryCount], const std::array<EnumAlias<T>, 0>& /*aliases*/)
+    {
+        return StringToEnumTable<T, EntryCount>(nullptr, 0, entries);
+    }
+
+    // Maps T values to the strings they serialize to. Parsing goes through the compile time StringToEnumTable
+    // instead, see DEFINE_ADAPTIVECARD_ENUM.
+    template <typename T>
+    class EnumMapping
+    {
+    public:
+        template <size_t N>
+        EnumMapping(const EnumEntry<T> (&entries)[N]) : _enumToString(N)
         {
-            for (const auto& kv : _enumToString)
+            for (const auto& entry : entries)
             {
-                _stringToEnum.emplace(kv.second, kv.first);
+                _enumToString.emplace(entry.value, entry.name);
             }
         }
 
-        const std::unordered_map<T, std::string, EnumHash> _enumToString;
-        std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+        const std::string& toString(T t) const
+        {
+            return _enumToString.at(t);
+        }
+
+    private:
+        std::unordered_map<T, std::string, EnumHash> _enumToString;
     };
 } // namespace EnumHelpers
 
@@ -87,34 +307,54 @@ namespace EnumHelpers
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum(); \
     } \
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
-    ENUMTYPE ENUMTYPE##FromString(const std::string& t);
+    ENUMTYPE ENUMTYPE##FromString(const std::string& t); \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(std::string_view t);
 
 #define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...) \
     namespace EnumHelpers \
     { \
+        constexpr EnumEntry<ENUMTYPE> c_##ENUMTYPE##Entries[] = __VA_ARGS__; \
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum() \
         { \
-            static const EnumMapping<ENUMTYPE> generatedEnum __VA_ARGS__; \
+            static const EnumMapping<ENUMTYPE> generatedEnum{c_##ENUMTYPE##Entries}; \
             return generatedEnum; \
         } \
     } \
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t) \
     { \
         return EnumHelpers::get##ENUMTYPE##Enum().toString(t); \
+    } \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(std::string_view t) \
+    { \
+        /* The table is constant initialized, unless building it exceeds the compiler's constexpr evaluation limit, */ \
+        /* in which case it's built on first use instead. */ \
+        static const auto stringToEnum = \
+            EnumHelpers::MakeStringToEnumTable(EnumHelpers::c_##ENUMTYPE##Entries, EnumHelpers::EnumAliases<ENUMTYPE>::values); \
+        return stringToEnum.TryFind(t); \
     }
 
-// Define mapping functions for ENUMTYPE. Throw an exception if caller passes in a string that doesn't map
+// Define mapping functions for ENUMTYPE. FromString throws if caller passes in a string that doesn't map, TryFromString
+// returns std::nullopt instead.
 #define DEFINE_ADAPTIVECARD_ENUM(ENUMTYPE, ...) \
     _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__); \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t) \
     { \
-        try \
+        if (const auto value = ENUMTYPE##TryFromString(t)) \
         { \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
+            return *value; \
         } \
-        catch (const std::out_of_range&) \
+        throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
+    }
+
+// Define additional strings that parse to ENUMTYPE values, but that values never serialize to (for back compat, for
+// instance). Must come before DEFINE_ADAPTIVECARD_ENUM for the same ENUMTYPE.
+#define DEFINE_ADAPTIVECARD_ENUM_ALIASES(ENUMTYPE, ...) \
+    namespace EnumHelpers \
+    { \
+        template <> \
+        struct EnumAliases<ENUMTYPE> \
         { \
-            throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
-        } \
+            static constexpr EnumAlias<ENUMTYPE> values[] = __VA_ARGS__; \
+        }; \
     }
 } // namespace AdaptiveCards
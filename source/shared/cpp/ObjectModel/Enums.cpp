@@ -271,14 +271,13 @@ namespace AdaptiveCards
             {SeparatorThickness::Default, "default"},
             {SeparatorThickness::Thick, "thick"}});
 
+    // Back compat to support "Normal" for "Default" for pre V1.0 payloads
+    DEFINE_ADAPTIVECARD_ENUM_ALIASES(ImageStyle, {
+            {"normal", ImageStyle::Default}});
+
     DEFINE_ADAPTIVECARD_ENUM(ImageStyle, {
-            {
-                {ImageStyle::Default, "default"},
-                {ImageStyle::Person, "person"}
-            },
-            {
-                {"normal", ImageStyle::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {ImageStyle::Default, "default"},
+            {ImageStyle::Person, "person"}});
 
     DEFINE_ADAPTIVECARD_ENUM(VerticalAlignment, {
         { VerticalAlignment::Top, "top" },
@@ -316,27 +315,25 @@ namespace AdaptiveCards
             {TextStyle::Default, "default"},
             {TextStyle::Heading, "heading"}});
 
+    // Back compat to support "Normal" for "Default" for pre V1.0 payloads
+    DEFINE_ADAPTIVECARD_ENUM_ALIASES(TextWeight, {
+            {"Normal", TextWeight::Default}});
+
     DEFINE_ADAPTIVECARD_ENUM(TextWeight, {
-            {
-                {TextWeight::Bolder, "Bolder"},
-                {TextWeight::Lighter, "Lighter"},
-                {TextWeight::Default, "Default"}
-            },
-            {
-                {"Normal", TextWeight::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {TextWeight::Bolder, "Bolder"},
+            {TextWeight::Lighter, "Lighter"},
+            {TextWeight::Default, "Default"}});
+
+    // Back compat to support "Normal" for "Default" for pre V1.0 payloads
+    DEFINE_ADAPTIVECARD_ENUM_ALIASES(TextSize, {
+            {"Normal", TextSize::Default}});
 
     DEFINE_ADAPTIVECARD_ENUM(TextSize, {
-            {
-                {TextSize::ExtraLarge, "ExtraLarge"},
-                {TextSize::Large, "Large"},
-                {TextSize::Medium, "Medium"},
-                {TextSize::Default, "Default"},
-                {TextSize::Small, "Small"}
-            },
-            {
-                {"Normal", TextSize::Default} // Back compat to support "Normal" for "Default" for pre V1.0 payloads
-            }});
+            {TextSize::ExtraLarge, "ExtraLarge"},
+            {TextSize::Large, "Large"},
+            {TextSize::Medium, "Medium"},
+            {TextSize::Default, "Default"},
+            {TextSize::Small, "Small"}});
 
     DEFINE_ADAPTIVECARD_ENUM(FontType, {
             {FontType::Default, "Default"},
@@ -80,7 +80,7 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::Deserialize(ParseContext
     executeAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
     executeAction->SetVerb(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Verb));
     executeAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
-        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
+        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsTryFromString));
 
     return executeAction;
 }
@@ -92,8 +92,10 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::DeserializeFromString(Pa
 
 void ExecuteAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Verb),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Data,
+         AdaptiveCardSchemaKey::Verb,
+         AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
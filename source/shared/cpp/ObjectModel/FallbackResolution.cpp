@@ -0,0 +1,443 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "FallbackResolution.h"
+#include "ActionSet.h"
+#include "Carousel.h"
+#include "CarouselPage.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include "TextInput.h"
+#include "TextRun.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+template <typename T>
+struct ElementResolution
+{
+    // The element to render in place of the one resolved, or nullptr to drop it
+    std::shared_ptr<T> element;
+    // Set when the element can't be rendered and its nearest ancestor with fallback has to fall back instead
+    bool fallBackToAncestor;
+};
+
+class FallbackResolver
+{
+public:
+    FallbackResolver(const FeatureRegistration& featureRegistration,
+                     const ElementParserRegistration& elementParserRegistration,
+                     const ActionParserRegistration& actionParserRegistration) :
+        m_featureRegistration(featureRegistration),
+        m_elementParserRegistration(elementParserRegistration), m_actionParserRegistration(actionParserRegistration)
+    {
+    }
+
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& GetWarnings()
+    {
+        return m_warnings;
+    }
+
+    std::shared_ptr<AdaptiveCard> ResolveCard(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        bool fallBackToAncestor = false;
+        auto body = ResolveElements(card->GetBody(), false, fallBackToAncestor);
+        auto actions = ResolveActions(card->GetActions());
+        auto selectAction = ResolveAction(card->GetSelectAction());
+        if (!body && !actions && selectAction == card->GetSelectAction())
+        {
+            return card;
+        }
+
+        auto resolved = std::make_shared<AdaptiveCard>(*card);
+        if (body)
+        {
+            resolved->GetBody() = std::move(*body);
+        }
+        if (actions)
+        {
+            resolved->GetActions() = std::move(*actions);
+        }
+        resolved->SetSelectAction(selectAction);
+        return resolved;
+    }
+
+private:
+    // Whether the host can render element, leaving aside its children. The columns of a column set, rows of a table and
+    // so on are rendered by the renderer of their collection, so only their requirements count.
+    template <typename T>
+    bool CanRender(const BaseCardElement& element) const
+    {
+        if constexpr (std::is_same_v<T, BaseCardElement>)
+        {
+            if (element.GetElementType() == CardElementType::Unknown ||
+                !m_elementParserRegistration.GetParser(element.GetElementTypeString()))
+            {
+                return false;
+            }
+        }
+        return element.MeetsRequirements(m_featureRegistration);
+    }
+
+    bool CanRender(const BaseActionElement& action) const
+    {
+        return action.GetElementType() != ActionType::UnknownAction &&
+               m_actionParserRegistration.GetParser(action.GetElementTypeString()) &&
+               action.MeetsRequirements(m_featureRegistration);
+    }
+
+    void AddWarning(WarningStatusCode statusCode, const std::string& message)
+    {
+        m_warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(statusCode, message));
+    }
+
+    // Resolves an element of a collection of Ts, walking its fallback chain until it finds one the host can render
+    template <typename T>
+    ElementResolution<T> ResolveElement(const std::shared_ptr<T>& element, bool ancestorHasFallback)
+    {
+        std::shared_ptr<BaseCardElement> candidate = element;
+        while (true)
+        {
+            if (CanRender<T>(*candidate))
+            {
+                bool childFellBack = false;
+                auto resolved = ResolveChildren(candidate, ancestorHasFallback || candidate->GetFallbackType() != FallbackType::None, childFellBack);
+                if (!childFellBack)
+                {
+                    if (auto typed = std::dynamic_pointer_cast<T>(resolved))
+                    {
+                        return {typed, false};
+                    }
+
+                    // fallback content of a type that the collection can't hold
+                    AddWarning(WarningStatusCode::UnknownElementType, "Dropping element '" + resolved->GetElementTypeString() + "' for fallback");
+                    return {nullptr, false};
+                }
+            }
+
+            const auto fallbackContent = candidate->GetFallbackType() == FallbackType::Content ?
+                std::dynamic_pointer_cast<BaseCardElement>(candidate->GetFallbackContent()) :
+                nullptr;
+            if (fallbackContent)
+            {
+                AddWarning(WarningStatusCode::UnknownElementType,
+                           "Performing fallback for '" + candidate->GetElementTypeString() + "' (fallback element type: '" +
+                               fallbackContent->GetElementTypeString() + "')");
+                candidate = fallbackContent;
+            }
+            else if (candidate->GetFallbackType() == FallbackType::Drop)
+            {
+                AddWarning(WarningStatusCode::UnknownElementType, "Dropping element '" + candidate->GetElementTypeString() + "' for fallback");
+                return {nullptr, false};
+            }
+            else if (ancestorHasFallback)
+            {
+                return {nullptr, true};
+            }
+            else
+            {
+                AddWarning(WarningStatusCode::UnknownElementType, "Unsupported card element type: " + candidate->GetElementTypeString());
+                return {nullptr, false};
+            }
+        }
+    }
+
+    // Returns the resolved elements, or std::nullopt when they're all rendered as they are. Stops once an element
+    // falls back to its ancestors, setting fallBackToAncestor.
+    template <typename T>
+    std::optional<std::vector<std::shared_ptr<T>>> ResolveElements(const std::vector<std::shared_ptr<T>>& elements,
+                                                                  bool ancestorHasFallback,
+                                                                  bool& fallBackToAncestor)
+    {
+        std::optional<std::vector<std::shared_ptr<T>>> resolvedElements;
+        for (size_t i = 0; i < elements.size(); ++i)
+        {
+            if (!elements[i])
+            {
+                continue;
+            }
+
+            auto resolution = ResolveElement(elements[i], ancestorHasFallback);
+            if (resolution.fallBackToAncestor)
+            {
+                fallBackToAncestor = true;
+                return std::nullopt;
+            }
+
+            if (resolution.element != elements[i] && !resolvedElements)
+            {
+                resolvedElements.emplace(elements.begin(), elements.begin() + i);
+            }
+            if (resolvedElements && resolution.element)
+            {
+                resolvedElements->push_back(std::move(resolution.element));
+            }
+        }
+        return resolvedElements;
+    }
+
+    // Resolves an action and the card it shows, returning nullptr when it's dropped. Actions don't fall back to the
+    // element they're in.
+    std::shared_ptr<BaseActionElement> ResolveAction(const std::shared_ptr<BaseActionElement>& action)
+    {
+        auto candidate = action;
+        while (candidate)
+        {
+            if (CanRender(*candidate))
+            {
+                if (candidate->GetElementType() != ActionType::ShowCard)
+                {
+                    return candidate;
+                }
+
+                const auto showCardAction = std::static_pointer_cast<ShowCardAction>(candidate);
+                const auto& card = showCardAction->GetCard();
+                const auto resolvedCard = card ? ResolveCard(card) : card;
+                if (resolvedCard == card)
+                {
+                    return candidate;
+                }
+
+                auto resolved = std::make_shared<ShowCardAction>(*showCardAction);
+                resolved->SetCard(resolvedCard);
+                return resolved;
+            }
+
+            const auto fallbackContent = candidate->GetFallbackType() == FallbackType::Content ?
+                std::dynamic_pointer_cast<BaseActionElement>(candidate->GetFallbackContent()) :
+                nullptr;
+            if (fallbackContent)
+            {
+                AddWarning(WarningStatusCode::UnknownActionElementType,
+                           "Performing fallback for '" + candidate->GetElementTypeString() + "' (fallback element type: '" +
+                               fallbackContent->GetElementTypeString() + "')");
+            }
+            else if (candidate->GetFallbackType() == FallbackType::Drop)
+            {
+                AddWarning(WarningStatusCode::UnknownActionElementType, "Dropping element '" + candidate->GetElementTypeString() + "' for fallback");
+            }
+            else
+            {
+                AddWarning(WarningStatusCode::UnknownActionElementType, "Unsupported action element type: " + candidate->GetElementTypeString());
+            }
+            candidate = fallbackContent;
+        }
+        return nullptr;
+    }
+
+    // Returns the resolved actions, or std::nullopt when they're all rendered as they are
+    std::optional<std::vector<std::shared_ptr<BaseActionElement>>> ResolveActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions)
+    {
+        std::optional<std::vector<std::shared_ptr<BaseActionElement>>> resolvedActions;
+        for (size_t i = 0; i < actions.size(); ++i)
+        {
+            auto resolved = ResolveAction(actions[i]);
+            if (resolved != actions[i] && !resolvedActions)
+            {
+                resolvedActions.emplace(actions.begin(), actions.begin() + i);
+            }
+            if (resolvedActions && resolved)
+            {
+                resolvedActions->push_back(std::move(resolved));
+            }
+        }
+        return resolvedActions;
+    }
+
+    // Resolves the items and select action of a Container, Column, TableCell or CarouselPage
+    template <typename T>
+    std::shared_ptr<BaseCardElement> ResolveItems(const std::shared_ptr<BaseCardElement>& element, bool ancestorHasFallback, bool& fallBackToAncestor)
+    {
+        const auto collection = std::static_pointer_cast<T>(element);
+        auto items = ResolveElements(collection->GetItems(), ancestorHasFallback, fallBackToAncestor);
+        if (fallBackToAncestor)
+        {
+            return nullptr;
+        }
+
+        auto selectAction = ResolveAction(collection->GetSelectAction());
+        if (!items && selectAction == collection->GetSelectAction())
+        {
+            return element;
+        }
+
+        auto resolved = std::make_shared<T>(*collection);
+        if (items)
+        {
+            resolved->GetItems() = std::move(*items);
+        }
+        resolved->SetSelectAction(selectAction);
+        return resolved;
+    }
+
+    // Resolves the elements of a ColumnSet, Carousel, Table, TableRow or ImageSet, which getElements returns, along with
+    // the select action of those that have one
+    template <typename T, typename GetElements>
+    std::shared_ptr<BaseCardElement> ResolveTypedElements(const std::shared_ptr<BaseCardElement>& element,
+                                                          GetElements getElements,
+                                                          bool ancestorHasFallback,
+                                                          bool& fallBackToAncestor)
+    {
+        const auto collection = std::static_pointer_cast<T>(element);
+        auto elements = ResolveElements(getElements(*collection), ancestorHasFallback, fallBackToAncestor);
+        if (fallBackToAncestor)
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<BaseActionElement> selectAction;
+        if constexpr (std::is_base_of_v<StyledCollectionElement, T>)
+        {
+            selectAction = ResolveAction(collection->GetSelectAction());
+            if (!elements && selectAction == collection->GetSelectAction())
+            {
+                return element;
+            }
+        }
+        else if (!elements)
+        {
+            return element;
+        }
+
+        auto resolved = std::make_shared<T>(*collection);
+        if (elements)
+        {
+            getElements(*resolved) = std::move(*elements);
+        }
+        if constexpr (std::is_base_of_v<StyledCollectionElement, T>)
+        {
+            resolved->SetSelectAction(selectAction);
+        }
+        return resolved;
+    }
+
+    // Returns element with its children resolved, which is element itself when they're all rendered as they are, or
+    // nullptr with fallBackToAncestor set when one of them falls back to its ancestors
+    std::shared_ptr<BaseCardElement> ResolveChildren(const std::shared_ptr<BaseCardElement>& element, bool ancestorHasFallback, bool& fallBackToAncestor)
+    {
+        switch (element->GetElementType())
+        {
+        case CardElementType::Container:
+            return ResolveItems<Container>(element, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::Column:
+            return ResolveItems<Column>(element, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::TableCell:
+            return ResolveItems<TableCell>(element, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::CarouselPage:
+            return ResolveItems<CarouselPage>(element, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::ColumnSet:
+            return ResolveTypedElements<ColumnSet>(
+                element, [](ColumnSet& columnSet) -> auto& { return columnSet.GetColumns(); }, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::Carousel:
+            return ResolveTypedElements<Carousel>(
+                element, [](Carousel& carousel) -> auto& { return carousel.GetPages(); }, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::Table:
+            return ResolveTypedElements<Table>(
+                element, [](Table& table) -> auto& { return table.GetRows(); }, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::TableRow:
+            return ResolveTypedElements<TableRow>(
+                element, [](TableRow& tableRow) -> auto& { return tableRow.GetCells(); }, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::ImageSet:
+            return ResolveTypedElements<ImageSet>(
+                element, [](ImageSet& imageSet) -> auto& { return imageSet.GetImages(); }, ancestorHasFallback, fallBackToAncestor);
+        case CardElementType::ActionSet:
+        {
+            const auto actionSet = std::static_pointer_cast<ActionSet>(element);
+            auto actions = ResolveActions(actionSet->GetActions());
+            if (!actions)
+            {
+                return element;
+            }
+
+            auto resolved = std::make_shared<ActionSet>(*actionSet);
+            resolved->GetActions() = std::move(*actions);
+            return resolved;
+        }
+        case CardElementType::Image:
+        {
+            const auto image = std::static_pointer_cast<Image>(element);
+            auto selectAction = ResolveAction(image->GetSelectAction());
+            if (selectAction == image->GetSelectAction())
+            {
+                return element;
+            }
+
+            auto resolved = std::make_shared<Image>(*image);
+            resolved->SetSelectAction(selectAction);
+            return resolved;
+        }
+        case CardElementType::TextInput:
+        {
+            const auto textInput = std::static_pointer_cast<TextInput>(element);
+            auto inlineAction = ResolveAction(textInput->GetInlineAction());
+            if (inlineAction == textInput->GetInlineAction())
+            {
+                return element;
+            }
+
+            auto resolved = std::make_shared<TextInput>(*textInput);
+            resolved->SetInlineAction(inlineAction);
+            return resolved;
+        }
+        case CardElementType::RichTextBlock:
+        {
+            const auto richTextBlock = std::static_pointer_cast<RichTextBlock>(element);
+            std::shared_ptr<RichTextBlock> resolved;
+            auto& inlines = richTextBlock->GetInlines();
+            for (size_t i = 0; i < inlines.size(); ++i)
+            {
+                const auto textRun = std::dynamic_pointer_cast<TextRun>(inlines[i]);
+                if (!textRun)
+                {
+                    continue;
+                }
+
+                auto selectAction = ResolveAction(textRun->GetSelectAction());
+                if (selectAction != textRun->GetSelectAction())
+                {
+                    if (!resolved)
+                    {
+                        resolved = std::make_shared<RichTextBlock>(*richTextBlock);
+                    }
+
+                    auto resolvedTextRun = std::make_shared<TextRun>(*textRun);
+                    resolvedTextRun->SetSelectAction(selectAction);
+                    resolved->GetInlines()[i] = std::move(resolvedTextRun);
+                }
+            }
+            return resolved ? resolved : element;
+        }
+        default:
+            return element;
+        }
+    }
+
+    const FeatureRegistration& m_featureRegistration;
+    const ElementParserRegistration& m_elementParserRegistration;
+    const ActionParserRegistration& m_actionParserRegistration;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+};
+} // namespace
+
+namespace AdaptiveCards
+{
+std::shared_ptr<ParseResult> ResolveFallback(const std::shared_ptr<AdaptiveCard>& card,
+                                             const FeatureRegistration& featureRegistration,
+                                             const ElementParserRegistration& elementParserRegistration,
+                                             const ActionParserRegistration& actionParserRegistration)
+{
+    FallbackResolver resolver(featureRegistration, elementParserRegistration, actionParserRegistration);
+    auto resolvedCard = resolver.ResolveCard(card);
+    return std::make_shared<ParseResult>(resolvedCard, std::move(resolver.GetWarnings()));
+}
+} // namespace AdaptiveCards
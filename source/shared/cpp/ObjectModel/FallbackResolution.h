@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ActionParserRegistration.h"
+#include "ElementParserRegistration.h"
+#include "FeatureRegistration.h"
+#include "ParseResult.h"
+
+namespace AdaptiveCards
+{
+// Performs the fallback of card for a host once, ahead of rendering, instead of on every render. An element or action
+// the host can't render (its type has no parser in the registrations, or the host doesn't meet its requirements) is
+// replaced with the first of its fallback content chain that the host can render, or dropped. One that has no fallback
+// falls back to its nearest ancestor that does, the way renderers handle it, and is otherwise dropped. The cards of
+// Action.ShowCard actions are resolved as cards of their own.
+//
+// Returns a card with only elements and actions the host can render, along with a warning for each fallback taken.
+// Elements are copied only where something inside them changed, so the rest is shared with card, which is left as it
+// is. The result depends only on card and the registrations, so a host can keep it for as long as those don't change.
+std::shared_ptr<ParseResult> ResolveFallback(const std::shared_ptr<AdaptiveCard>& card,
+                                             const FeatureRegistration& featureRegistration,
+                                             const ElementParserRegistration& elementParserRegistration,
+                                             const ActionParserRegistration& actionParserRegistration);
+} // namespace AdaptiveCards
@@ -4,32 +4,33 @@
 #include "FeatureRegistration.h"
 
 #include "AdaptiveCardParseException.h"
-#include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
 FeatureRegistration::FeatureRegistration() :
-    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, c_sharedModelVersion}}
+    m_supportedFeatures{{AdaptiveCards::c_adaptiveCardsFeature, {c_sharedModelVersion, SemanticVersion(c_sharedModelVersion)}}}
 {
 }
 
 void FeatureRegistration::AddFeature(std::string const& featureName, const std::string& featureVersion)
 {
     // first, validate the version string. we only support "*" or a semantic version string (e.g. "1.0", or "1.2.3.4")
+    std::optional<SemanticVersion> semanticVersion;
     if (featureVersion != "*")
     {
         // the below will throw if the version is invalid
-        const SemanticVersion version(featureVersion);
+        semanticVersion = SemanticVersion(featureVersion);
     }
 
-    if (m_supportedFeatures.find(featureName) == m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature == m_supportedFeatures.end())
     {
-        m_supportedFeatures[featureName] = featureVersion;
+        m_supportedFeatures.emplace(featureName, Feature{featureVersion, semanticVersion});
     }
     else
     {
         // only allow a duplicate add attempt if the version is the same.
-        if (m_supportedFeatures[featureName] != featureVersion)
+        if (feature->second.version != featureVersion)
         {
             throw AdaptiveCardParseException(
                 ErrorStatusCode::InvalidPropertyValue, "Attempting to add a feature with a differing version");
@@ -50,19 +51,39 @@ void FeatureRegistration::RemoveFeature(const std::string& featureName)
 
 SemanticVersion FeatureRegistration::GetAdaptiveCardsVersion() const
 {
-    SemanticVersion adaptiveCardsVersion{GetFeatureVersion(AdaptiveCards::c_adaptiveCardsFeature)};
-    return adaptiveCardsVersion;
+    const auto feature = m_supportedFeatures.find(AdaptiveCards::c_adaptiveCardsFeature);
+    if (feature == m_supportedFeatures.end() || !feature->second.semanticVersion.has_value())
+    {
+        // the feature was removed (differently cased) or re-added as "*", neither of which names a version
+        const std::string version = feature == m_supportedFeatures.end() ? "" : feature->second.version;
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+    }
+    return feature->second.semanticVersion.value();
 }
 
 std::string FeatureRegistration::GetFeatureVersion(const std::string& featureName) const
 {
-    if (m_supportedFeatures.find(featureName) != m_supportedFeatures.end())
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature != m_supportedFeatures.end())
     {
-        return m_supportedFeatures.at(featureName);
+        return feature->second.version;
     }
     else
     {
         return "";
     }
 }
+
+bool FeatureRegistration::ProvidesFeature(const std::string& featureName, const SemanticVersion& minimumVersion) const
+{
+    const auto feature = m_supportedFeatures.find(featureName);
+    if (feature == m_supportedFeatures.end())
+    {
+        // host doesn't provide this feature
+        return false;
+    }
+
+    const auto& providedVersion = feature->second.semanticVersion;
+    return !providedVersion.has_value() || (providedVersion.value() >= minimumVersion);
+}
 } // namespace AdaptiveCards
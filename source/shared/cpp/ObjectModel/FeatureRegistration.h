@@ -4,21 +4,19 @@
 
 #include "pch.h"
 #include "ParseUtil.h"
+#include "SemanticVersion.h"
 
 namespace AdaptiveCards
 {
 constexpr const char* const c_adaptiveCardsFeature = "adaptiveCards";
 
-namespace ParseUtil
-{
-    std::string ToLowercase(const std::string& value);
-}
-
+// Kept for the bindings that expose them; they fold case the same way, and without allocating, as the CaseInsensitiveHash
+// and CaseInsensitiveEqualTo they forward to
 struct CaseInsensitiveKeyHash
 {
     size_t operator()(const std::string& keyVal) const
     {
-        return std::hash<std::string>{}(ParseUtil::ToLowercase(keyVal));
+        return CaseInsensitiveHash{}(keyVal);
     }
 };
 
@@ -26,11 +24,10 @@ struct CaseInsensitiveKeyEquals
 {
     bool operator()(const std::string& leftVal, const std::string& rightVal) const
     {
-        return (ParseUtil::ToLowercase(leftVal) == ParseUtil::ToLowercase(rightVal));
+        return CaseInsensitiveEqualTo{}(leftVal, rightVal);
     }
 };
 
-class SemanticVersion;
 class FeatureRegistration
 {
 public:
@@ -41,7 +38,17 @@ public:
     SemanticVersion GetAdaptiveCardsVersion() const;
     std::string GetFeatureVersion(const std::string& featureName) const;
 
+    // Whether the host provides featureName at minimumVersion or later
+    bool ProvidesFeature(const std::string& featureName, const SemanticVersion& minimumVersion) const;
+
 private:
-    std::unordered_map<std::string, std::string, CaseInsensitiveKeyHash, CaseInsensitiveKeyEquals> m_supportedFeatures;
+    struct Feature
+    {
+        std::string version;
+        std::optional<SemanticVersion> semanticVersion; // std::nullopt for "*", which provides any version
+    };
+
+    // Versions are parsed once when they're added, as every element's requirements are checked against them
+    std::unordered_map<std::string, Feature, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_supportedFeatures;
 };
 } // namespace AdaptiveCards
@@ -170,12 +170,12 @@ ColorsConfig ColorsConfig::Deserialize(const Json::Value& json, const ColorsConf
 
 void TextStyleConfigDeserializeHelper(TextStyleConfig& result, const Json::Value& json, const TextStyleConfig& defaultValue)
 {
-    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorFromString);
+    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorTryFromString);
     result.fontType =
-        ParseUtil::GetEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, defaultValue.fontType, FontTypeFromString);
+        ParseUtil::GetEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, defaultValue.fontType, FontTypeTryFromString);
     result.isSubtle = ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsSubtle, defaultValue.isSubtle);
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 }
 
 TextStyleConfig TextStyleConfig::Deserialize(const Json::Value& json, const TextStyleConfig& defaultValue)
@@ -229,7 +229,7 @@ ImageSetConfig ImageSetConfig::Deserialize(const Json::Value& json, const ImageS
 {
     ImageSetConfig result;
     result.imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::ImageSize, defaultValue.imageSize, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::ImageSize, defaultValue.imageSize, ImageSizeTryFromString);
 
     result.maxImageHeight = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxImageHeight, defaultValue.maxImageHeight);
 
@@ -257,9 +257,9 @@ ShowCardActionConfig ShowCardActionConfig::Deserialize(const Json::Value& json,
 {
     ShowCardActionConfig result;
     result.actionMode =
-        ParseUtil::GetEnumValue<ActionMode>(json, AdaptiveCardSchemaKey::ActionMode, defaultValue.actionMode, ActionModeFromString);
+        ParseUtil::GetEnumValue<ActionMode>(json, AdaptiveCardSchemaKey::ActionMode, defaultValue.actionMode, ActionModeTryFromString);
     result.inlineTopMargin = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::InlineTopMargin, defaultValue.inlineTopMargin);
-    result.style = ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, defaultValue.style, ContainerStyleFromString);
+    result.style = ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, defaultValue.style, ContainerStyleTryFromString);
 
     return result;
 }
@@ -269,10 +269,10 @@ ActionsConfig ActionsConfig::Deserialize(const Json::Value& json, const ActionsC
     ActionsConfig result;
 
     result.actionsOrientation = ParseUtil::GetEnumValue<ActionsOrientation>(
-        json, AdaptiveCardSchemaKey::ActionsOrientation, defaultValue.actionsOrientation, ActionsOrientationFromString);
+        json, AdaptiveCardSchemaKey::ActionsOrientation, defaultValue.actionsOrientation, ActionsOrientationTryFromString);
 
     result.actionAlignment = ParseUtil::GetEnumValue<ActionAlignment>(
-        json, AdaptiveCardSchemaKey::ActionAlignment, defaultValue.actionAlignment, ActionAlignmentFromString);
+        json, AdaptiveCardSchemaKey::ActionAlignment, defaultValue.actionAlignment, ActionAlignmentTryFromString);
 
     result.buttonSpacing = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::ButtonSpacing, defaultValue.buttonSpacing);
 
@@ -281,10 +281,10 @@ ActionsConfig ActionsConfig::Deserialize(const Json::Value& json, const ActionsC
     result.showCard = ParseUtil::ExtractJsonValueAndMergeWithDefault<ShowCardActionConfig>(
         json, AdaptiveCardSchemaKey::ShowCard, defaultValue.showCard, ShowCardActionConfig::Deserialize);
 
-    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingFromString);
+    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingTryFromString);
 
     result.iconPlacement = ParseUtil::GetEnumValue<IconPlacement>(
-        json, AdaptiveCardSchemaKey::IconPlacement, defaultValue.iconPlacement, IconPlacementFromString);
+        json, AdaptiveCardSchemaKey::IconPlacement, defaultValue.iconPlacement, IconPlacementTryFromString);
 
     result.iconSize = ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::IconSize, defaultValue.iconSize);
 
@@ -295,15 +295,15 @@ InputLabelConfig InputLabelConfig::Deserialize(const Json::Value& json, const In
 {
     InputLabelConfig result;
 
-    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorFromString);
+    result.color = ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, defaultValue.color, ForegroundColorTryFromString);
 
     result.isSubtle = ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsSubtle, defaultValue.isSubtle);
 
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
 
     result.suffix = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Suffix, defaultValue.suffix);
 
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 
     return result;
 }
@@ -313,7 +313,7 @@ LabelConfig LabelConfig::Deserialize(const Json::Value& json, const LabelConfig&
     LabelConfig result;
 
     result.inputSpacing =
-        ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::InputSpacing, defaultValue.inputSpacing, SpacingFromString);
+        ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::InputSpacing, defaultValue.inputSpacing, SpacingTryFromString);
 
     result.requiredInputs = ParseUtil::ExtractJsonValueAndMergeWithDefault<InputLabelConfig>(
         json, AdaptiveCardSchemaKey::RequiredInputs, defaultValue.requiredInputs, InputLabelConfig::Deserialize);
@@ -328,11 +328,11 @@ ErrorMessageConfig ErrorMessageConfig::Deserialize(const Json::Value& json, cons
 {
     ErrorMessageConfig result;
 
-    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeFromString);
+    result.size = ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.size, TextSizeTryFromString);
 
-    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingFromString);
+    result.spacing = ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, defaultValue.spacing, SpacingTryFromString);
 
-    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightFromString);
+    result.weight = ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::Weight, defaultValue.weight, TextWeightTryFromString);
 
     return result;
 }
@@ -442,7 +442,7 @@ ImageConfig ImageConfig::Deserialize(const Json::Value& json, const ImageConfig&
     ImageConfig result;
 
     result.imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.imageSize, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, defaultValue.imageSize, ImageSizeTryFromString);
 
     return result;
 }
@@ -482,6 +482,11 @@ TableConfig TableConfig::Deserialize(const Json::Value& json, const TableConfig&
 }
 
 FontTypeDefinition HostConfig::GetFontType(FontType type) const
+{
+    return GetFontTypeDefinition(type);
+}
+
+const FontTypeDefinition& HostConfig::GetFontTypeDefinition(FontType type) const
 {
     switch (type)
     {
@@ -592,7 +597,7 @@ unsigned int FontWeightsConfig::GetDefaultFontWeight(TextWeight weight)
 std::string HostConfig::GetFontFamily(FontType fontType) const
 {
     // desired font family
-    auto fontFamilyValue = GetFontType(fontType).fontFamily;
+    auto fontFamilyValue = GetFontTypeDefinition(fontType).fontFamily;
 
     if (fontFamilyValue.empty())
     {
@@ -618,7 +623,7 @@ std::string HostConfig::GetFontFamily(FontType fontType) const
 unsigned int HostConfig::GetFontSize(FontType fontType, TextSize size) const
 {
     // desired font size
-    auto result = GetFontType(fontType).fontSizes.GetFontSize(size);
+    auto result = GetFontTypeDefinition(fontType).fontSizes.GetFontSize(size);
 
     // std::numeric_limits<unsigned int>::max() used to check if value was defined
     if (result == std::numeric_limits<unsigned int>::max())
@@ -642,7 +647,7 @@ unsigned int HostConfig::GetFontSize(FontType fontType, TextSize size) const
 unsigned int HostConfig::GetFontWeight(FontType fontType, TextWeight weight) const
 {
     // desired font weight
-    auto result = GetFontType(fontType).fontWeights.GetFontWeight(weight);
+    auto result = GetFontTypeDefinition(fontType).fontWeights.GetFontWeight(weight);
 
     // std::numeric_limits<unsigned int>::max() used to check if value was defined
     if (result == std::numeric_limits<unsigned int>::max())
@@ -689,7 +694,7 @@ std::string HostConfig::GetBackgroundColor(ContainerStyle style) const
 }
 
 template <typename T>
-std::string GetColorFromColorConfig(T colorConfig, bool isSubtle)
+std::string GetColorFromColorConfig(const T& colorConfig, bool isSubtle)
 {
     return (isSubtle) ? (colorConfig.subtleColor) : (colorConfig.defaultColor);
 }
@@ -718,13 +723,13 @@ const ColorConfig& HostConfig::GetContainerColorConfig(const ColorsConfig& color
 
 std::string HostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
 {
-    auto colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color);
+    const auto& colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color);
     return GetColorFromColorConfig(colorConfig, isSubtle);
 }
 
 std::string HostConfig::GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
 {
-    auto colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color).highlightColors;
+    const auto& colorConfig = GetContainerColorConfig(GetContainerStyle(style).foregroundColors, color).highlightColors;
     return GetColorFromColorConfig(colorConfig, isSubtle);
 }
 
@@ -455,6 +455,9 @@ public:
     void SetTable(const TableConfig value);
 
 private:
+    friend class ResolvedHostConfig;
+
+    const FontTypeDefinition& GetFontTypeDefinition(FontType fontType) const;
     const ContainerStyleDefinition& GetContainerStyle(ContainerStyle style) const;
     const ColorConfig& GetContainerColorConfig(const ColorsConfig& colors, ForegroundColor color) const;
 
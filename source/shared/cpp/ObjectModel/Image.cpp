@@ -187,10 +187,10 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
     image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
     image->SetBackgroundColor(ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context.warnings));
-    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString));
+    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleTryFromString));
     image->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText));
     image->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     const auto& widthDimension =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Width), &context.warnings);
@@ -205,7 +205,7 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
     }
     else
     {
-        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeFromString));
+        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeTryFromString));
     }
 
     // Parse optional selectAction
@@ -215,16 +215,18 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
 void Image::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::BackgroundColor,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Url,
+         AdaptiveCardSchemaKey::Width});
+    m_knownProperties = &knownProperties;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
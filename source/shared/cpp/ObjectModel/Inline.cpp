@@ -53,5 +53,6 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(KnownPropertiesSet{}, {AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
@@ -33,7 +33,7 @@ public:
     void SetAdditionalProperties(const Json::Value& additionalProperties);
 
 protected:
-    std::unordered_set<std::string> m_knownProperties;
+    const KnownPropertiesSet* m_knownProperties = nullptr;
     Json::Value m_additionalProperties;
 
 private:
@@ -3,11 +3,16 @@
 #pragma once
 
 #include "pch.h"
+#include <atomic>
 
 namespace AdaptiveCards
 {
 // Used to uniquely identify a single BaseElement-derived object through the course of deserializing. For more
 // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+//
+// Ids are handed out from a single process-wide atomic counter, so they stay unique when several cards are parsed
+// concurrently. The most recently handed out id is tracked per thread: an element picks up its id via Current() while
+// the Next() call made on its behalf by the parser wrapper is still on the same thread's stack.
 class InternalId
 {
 public:
@@ -40,7 +45,8 @@ public:
     }
 
 private:
-    static unsigned int s_currentInternalId;
+    static std::atomic<unsigned int> s_nextInternalId;
+    static thread_local unsigned int s_currentInternalId;
     InternalId(const unsigned int id);
     unsigned int m_internalId;
 };
@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonTokenizer.h"
+
+namespace
+{
+// Matches the default nesting limit of Json::CharReaderBuilder
+constexpr unsigned int c_maxNestingDepth = 1000;
+
+bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool IsDelimiter(char c)
+{
+    return IsWhitespace(c) || c == ',' || c == ':' || c == '[' || c == ']' || c == '{' || c == '}' || c == '"' || c == '/';
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+JsonTokenizer::JsonTokenizer(const char* begin, const char* end) : m_current(begin), m_end(end)
+{
+}
+
+const char* JsonTokenizer::GetPosition() const
+{
+    return m_current;
+}
+
+bool JsonTokenizer::TryConsume(char expected)
+{
+    if (!SkipWhitespace() || m_current == m_end || *m_current != expected)
+    {
+        return false;
+    }
+
+    ++m_current;
+    return true;
+}
+
+bool JsonTokenizer::ReadString(std::string_view& contents)
+{
+    if (!TryConsume('"'))
+    {
+        return false;
+    }
+
+    const char* contentsBegin = m_current;
+    if (!SkipStringBody())
+    {
+        return false;
+    }
+
+    // m_current is just past the closing quote
+    contents = std::string_view(contentsBegin, static_cast<size_t>(m_current - contentsBegin - 1));
+    return true;
+}
+
+bool JsonTokenizer::SkipValue()
+{
+    // Containers are tracked with an explicit stack rather than recursion, so deeply nested input can't exhaust the
+    // call stack. Each entry is the closing character of a container we're inside of.
+    std::vector<char> openContainers;
+
+    do
+    {
+        if (!SkipWhitespace() || m_current == m_end)
+        {
+            return false;
+        }
+
+        const char c = *m_current;
+        if (c == '{' || c == '[')
+        {
+            if (openContainers.size() == c_maxNestingDepth)
+            {
+                return false;
+            }
+
+            ++m_current;
+            const char closing = (c == '{') ? '}' : ']';
+            if (TryConsume(closing))
+            {
+                // empty container, which counts as a complete value
+            }
+            else
+            {
+                openContainers.push_back(closing);
+                if (closing == '}')
+                {
+                    std::string_view name;
+                    if (!ReadString(name) || !TryConsume(':'))
+                    {
+                        return false;
+                    }
+                }
+                // go on to read the container's first value
+                continue;
+            }
+        }
+        else if (c == '"')
+        {
+            ++m_current;
+            if (!SkipStringBody())
+            {
+                return false;
+            }
+        }
+        else if (!SkipLiteral())
+        {
+            return false;
+        }
+
+        // A value just ended. Close every container it completes, then move on to the next member or item.
+        while (!openContainers.empty())
+        {
+            if (TryConsume(openContainers.back()))
+            {
+                openContainers.pop_back();
+            }
+            else if (TryConsume(','))
+            {
+                if (openContainers.back() == '}')
+                {
+                    std::string_view name;
+                    if (!ReadString(name) || !TryConsume(':'))
+                    {
+                        return false;
+                    }
+                }
+                break;
+            }
+            else
+            {
+                return false;
+            }
+        }
+    } while (!openContainers.empty());
+
+    return true;
+}
+
+bool JsonTokenizer::SkipWhitespace()
+{
+    while (m_current != m_end)
+    {
+        if (IsWhitespace(*m_current))
+        {
+            ++m_current;
+        }
+        else if (*m_current == '/' && (m_end - m_current) >= 2 && m_current[1] == '/')
+        {
+            // a line comment runs to the end of the line (or of the text)
+            m_current = std::find(m_current + 2, m_end, '\n');
+        }
+        else if (*m_current == '/' && (m_end - m_current) >= 2 && m_current[1] == '*')
+        {
+            constexpr std::string_view commentEnd{"*/"};
+            const char* end = std::search(m_current + 2, m_end, commentEnd.begin(), commentEnd.end());
+            if (end == m_end)
+            {
+                return false;
+            }
+            m_current = end + commentEnd.size();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+bool JsonTokenizer::SkipStringBody()
+{
+    while (m_current != m_end)
+    {
+        const char c = *m_current++;
+        if (c == '"')
+        {
+            return true;
+        }
+
+        if (c == '\\')
+        {
+            if (m_current == m_end)
+            {
+                return false;
+            }
+            ++m_current;
+        }
+    }
+
+    return false;
+}
+
+bool JsonTokenizer::SkipLiteral()
+{
+    // numbers, true, false and null all run up to the next delimiter
+    const char* literalBegin = m_current;
+    while (m_current != m_end && !IsDelimiter(*m_current))
+    {
+        ++m_current;
+    }
+
+    return m_current != literalBegin;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Walks json text token by token without building a Json::Value, so callers can find where values start and end
+// and only materialize the ones they need. Like jsoncpp's reader, it treats comments as whitespace.
+//
+// The tokenizer only checks structure (matching brackets, terminated strings, separators); the values it steps over
+// are validated once they're actually parsed. Every method returns false when the text isn't well formed, after
+// which the tokenizer's position is unspecified.
+class JsonTokenizer
+{
+public:
+    JsonTokenizer(const char* begin, const char* end);
+
+    const char* GetPosition() const;
+
+    // Skips whitespace and comments, then returns whether the next character is expected, consuming it if so
+    bool TryConsume(char expected);
+
+    // Reads a string and points contents at its raw text between the quotes. Escape sequences are left as they are.
+    bool ReadString(std::string_view& contents);
+
+    // Steps over one value of any type, including everything nested inside it
+    bool SkipValue();
+
+    // Skips whitespace and comments, returning false if an unterminated comment is found
+    bool SkipWhitespace();
+
+private:
+    bool SkipStringBody();
+    bool SkipLiteral();
+
+    const char* m_current;
+    const char* const m_end;
+};
+} // namespace AdaptiveCards
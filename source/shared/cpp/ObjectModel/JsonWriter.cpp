@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "JsonWriter.h"
+
+#include <charconv>
+
+namespace
+{
+// Decodes the UTF-8 sequence at current and leaves current on its last byte, exactly as jsoncpp's writer does
+// (including what it accepts as a sequence and what it replaces with U+FFFD)
+unsigned int Utf8ToCodepoint(const char*& current, const char* end)
+{
+    constexpr unsigned int replacementCharacter = 0xFFFD;
+    const unsigned int firstByte = static_cast<unsigned char>(*current);
+
+    if (firstByte < 0x80)
+    {
+        return firstByte;
+    }
+
+    if (firstByte < 0xE0)
+    {
+        if (end - current < 2)
+        {
+            return replacementCharacter;
+        }
+
+        const unsigned int codepoint = ((firstByte & 0x1F) << 6) | (static_cast<unsigned int>(current[1]) & 0x3F);
+        current += 1;
+        return codepoint < 0x80 ? replacementCharacter : codepoint;
+    }
+
+    if (firstByte < 0xF0)
+    {
+        if (end - current < 3)
+        {
+            return replacementCharacter;
+        }
+
+        const unsigned int codepoint = ((firstByte & 0x0F) << 12) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 6) |
+            (static_cast<unsigned int>(current[2]) & 0x3F);
+        current += 2;
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+        {
+            return replacementCharacter;
+        }
+        return codepoint < 0x800 ? replacementCharacter : codepoint;
+    }
+
+    if (firstByte < 0xF8)
+    {
+        if (end - current < 4)
+        {
+            return replacementCharacter;
+        }
+
+        const unsigned int codepoint = ((firstByte & 0x07) << 24) | ((static_cast<unsigned int>(current[1]) & 0x3F) << 12) |
+            ((static_cast<unsigned int>(current[2]) & 0x3F) << 6) | (static_cast<unsigned int>(current[3]) & 0x3F);
+        current += 3;
+        return codepoint < 0x10000 ? replacementCharacter : codepoint;
+    }
+
+    return replacementCharacter;
+}
+
+void AppendUnicodeEscape(std::string& output, unsigned int codeUnit)
+{
+    constexpr char hexDigits[] = "0123456789abcdef";
+    const char escape[] = {'\\',
+                           'u',
+                           hexDigits[(codeUnit >> 12) & 0xF],
+                           hexDigits[(codeUnit >> 8) & 0xF],
+                           hexDigits[(codeUnit >> 4) & 0xF],
+                           hexDigits[codeUnit & 0xF]};
+    output.append(escape, sizeof(escape));
+}
+
+template <typename T>
+void AppendInteger(std::string& output, T value)
+{
+    char digits[24];
+    const auto result = std::to_chars(std::begin(digits), std::end(digits), value);
+    output.append(digits, result.ptr);
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+JsonWriter::JsonWriter(std::string& output) : m_output(output), m_stream(nullptr), m_afterName(false)
+{
+}
+
+JsonWriter::JsonWriter(std::ostream& output) : m_output(m_buffer), m_stream(&output), m_afterName(false)
+{
+}
+
+JsonWriter::JsonWriter(Sink sink) : m_output(m_buffer), m_stream(nullptr), m_sink(std::move(sink)), m_afterName(false)
+{
+}
+
+JsonWriter::~JsonWriter()
+{
+    Flush();
+}
+
+void JsonWriter::WriteValue(const Json::Value& value)
+{
+    switch (value.type())
+    {
+    case Json::nullValue:
+        BeginItem();
+        m_output += "null";
+        break;
+    case Json::intValue:
+        BeginItem();
+        AppendInteger(m_output, value.asLargestInt());
+        break;
+    case Json::uintValue:
+        BeginItem();
+        AppendInteger(m_output, value.asLargestUInt());
+        break;
+    case Json::realValue:
+        BeginItem();
+        m_output += Json::valueToString(value.asDouble());
+        break;
+    case Json::stringValue:
+    {
+        BeginItem();
+        const char* begin;
+        const char* end;
+        if (value.getString(&begin, &end))
+        {
+            WriteString(begin, end);
+        }
+        break;
+    }
+    case Json::booleanValue:
+        BeginItem();
+        m_output += value.asBool() ? "true" : "false";
+        break;
+    case Json::arrayValue:
+        BeginArray();
+        for (const auto& item : value)
+        {
+            WriteValue(item);
+        }
+        EndArray();
+        break;
+    case Json::objectValue:
+        BeginObject();
+        for (auto member = value.begin(); member != value.end(); ++member)
+        {
+            const char* nameEnd;
+            const char* name = member.memberName(&nameEnd);
+            WriteName(std::string_view(name, nameEnd - name));
+            WriteValue(*member);
+        }
+        EndObject();
+        break;
+    }
+    FlushIfFull();
+}
+
+void JsonWriter::BeginObject()
+{
+    BeginItem();
+    m_output += '{';
+    m_hasItems.push_back(false);
+}
+
+void JsonWriter::WriteName(std::string_view name)
+{
+    BeginItem();
+    WriteString(name.data(), name.data() + name.size());
+    m_output += ':';
+    m_afterName = true;
+}
+
+void JsonWriter::EndObject()
+{
+    m_hasItems.pop_back();
+    m_output += '}';
+}
+
+void JsonWriter::BeginArray()
+{
+    BeginItem();
+    m_output += '[';
+    m_hasItems.push_back(false);
+}
+
+void JsonWriter::EndArray()
+{
+    m_hasItems.pop_back();
+    m_output += ']';
+}
+
+void JsonWriter::WriteRaw(std::string_view text)
+{
+    m_output += text;
+    FlushIfFull();
+}
+
+void JsonWriter::Flush()
+{
+    if (m_buffer.empty())
+    {
+        return;
+    }
+
+    if (m_stream)
+    {
+        m_stream->write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    }
+    else if (m_sink)
+    {
+        m_sink(m_buffer);
+    }
+    m_buffer.clear();
+}
+
+// Separates this item from the one before it, unless it's the value of a member whose name was just written
+void JsonWriter::BeginItem()
+{
+    if (m_afterName)
+    {
+        m_afterName = false;
+        return;
+    }
+
+    if (!m_hasItems.empty())
+    {
+        if (m_hasItems.back())
+        {
+            m_output += ',';
+        }
+        m_hasItems.back() = true;
+    }
+}
+
+void JsonWriter::WriteString(const char* begin, const char* end)
+{
+    m_output += '"';
+
+    // The test jsoncpp uses to decide whether a string needs escaping. It holds for every non-empty string where char
+    // is signed, but where char is unsigned a string with no ASCII character in it is written as it is.
+    const auto requiresQuoting = [](char c) {
+        return c == '\\' || c == '"' || c < ' ' || static_cast<unsigned char>(c) < 0x80;
+    };
+    if (std::none_of(begin, end, requiresQuoting))
+    {
+        m_output.append(begin, end);
+        m_output += '"';
+        return;
+    }
+
+    const char* unescaped = begin;
+    for (const char* current = begin; current != end; ++current)
+    {
+        const unsigned char c = static_cast<unsigned char>(*current);
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        m_output.append(unescaped, current);
+        switch (c)
+        {
+        case '"':
+            m_output += "\\\"";
+            break;
+        case '\\':
+            m_output += "\\\\";
+            break;
+        case '\b':
+            m_output += "\\b";
+            break;
+        case '\f':
+            m_output += "\\f";
+            break;
+        case '\n':
+            m_output += "\\n";
+            break;
+        case '\r':
+            m_output += "\\r";
+            break;
+        case '\t':
+            m_output += "\\t";
+            break;
+        default:
+        {
+            unsigned int codepoint = Utf8ToCodepoint(current, end);
+            if (codepoint < 0x10000)
+            {
+                AppendUnicodeEscape(m_output, codepoint);
+            }
+            else
+            {
+                codepoint -= 0x10000;
+                AppendUnicodeEscape(m_output, (codepoint >> 10) + 0xD800);
+                AppendUnicodeEscape(m_output, (codepoint & 0x3FF) + 0xDC00);
+            }
+            break;
+        }
+        }
+        unescaped = current + 1;
+    }
+    m_output.append(unescaped, end);
+
+    m_output += '"';
+}
+
+void JsonWriter::FlushIfFull()
+{
+    if (m_buffer.size() >= FlushThreshold)
+    {
+        Flush();
+    }
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// Writes json straight into a std::string, a std::ostream or a caller-supplied sink, in exactly the compact form
+// ParseUtil::JsonToString produces (member names sorted, no whitespace, jsoncpp's escaping and number formatting)
+// but without a stream writer or an intermediate copy of the text.
+//
+// Objects and arrays can also be written a member at a time with Begin/End and WriteName, so that a document can be
+// written from parts that are never put together into one Json::Value. Members must then be written in the order
+// jsoncpp sorts member names in (bytewise, see Json::Value's object map), or the text won't match JsonToString.
+class JsonWriter
+{
+public:
+    // Receives the text in order, in pieces of up to a few KB
+    using Sink = std::function<void(std::string_view)>;
+
+    // Appends to output
+    explicit JsonWriter(std::string& output);
+    explicit JsonWriter(std::ostream& output);
+    explicit JsonWriter(Sink sink);
+    ~JsonWriter();
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    void WriteValue(const Json::Value& value);
+
+    void BeginObject();
+    void WriteName(std::string_view name);
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    // Text written as is, e.g. the newline JsonToString ends with
+    void WriteRaw(std::string_view text);
+
+    // Hands everything written so far to the stream or sink. Called on destruction.
+    void Flush();
+
+private:
+    static constexpr size_t FlushThreshold = 4096;
+
+    void BeginItem();
+    void WriteString(const char* begin, const char* end);
+    void FlushIfFull();
+
+    // The caller's string, or m_buffer when writing to a stream or sink
+    std::string& m_output;
+    std::string m_buffer;
+    std::ostream* m_stream;
+    Sink m_sink;
+
+    // For each object or array being written, whether it has an item yet (so the next one needs a comma)
+    std::vector<bool> m_hasItems;
+    bool m_afterName;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <string_view>
+
+namespace AdaptiveCards
+{
+// The set of json property names an element type understands. Anything not in here gets stashed in the element's
+// additional properties by HandleUnknownProperties.
+//
+// Each element type builds its table exactly once, the first time an instance is constructed, by extending the table
+// installed by its base class. Every instance then just points at that shared, immutable table, so constructing
+// elements doesn't allocate on this path. Entries are views onto the strings owned by the static AdaptiveCardSchemaKey
+// mapping, so lookups with a view of a json key don't allocate either.
+using KnownPropertiesSet = std::unordered_set<std::string_view>;
+
+inline void AddKnownProperties(KnownPropertiesSet& knownProperties, std::initializer_list<AdaptiveCardSchemaKey> keys)
+{
+    for (const auto key : keys)
+    {
+        knownProperties.emplace(AdaptiveCardSchemaKeyToString(key));
+    }
+}
+
+inline KnownPropertiesSet ExtendKnownProperties(const KnownPropertiesSet& base, std::initializer_list<AdaptiveCardSchemaKey> keys)
+{
+    KnownPropertiesSet knownProperties{base};
+    AddKnownProperties(knownProperties, keys);
+    return knownProperties;
+}
+} // namespace AdaptiveCards
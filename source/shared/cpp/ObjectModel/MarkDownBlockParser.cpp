@@ -7,14 +7,14 @@
 using namespace AdaptiveCards;
 
 // Parses according to each key words
-void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
+void MarkDownBlockParser::ParseBlock(MarkDownStream& stream)
 {
     switch (stream.peek())
     {
         // parses link
     case '[':
     {
-        LinkParser linkParser;
+        LinkParser linkParser(m_tokens);
         // do syntax check of link
         linkParser.Match(stream);
         // append link result to the rest
@@ -46,7 +46,7 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     case '+':
     case '*':
     {
-        ListParser listParser;
+        ListParser listParser(m_tokens);
         // do syntax check of list
         listParser.Match(stream);
         // append list result to the rest
@@ -65,7 +65,7 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     case '8':
     case '9':
     {
-        OrderedListParser orderedListParser;
+        OrderedListParser orderedListParser(m_tokens);
         // do syntax check of list
         orderedListParser.Match(stream);
         // append list result to the rest
@@ -78,9 +78,9 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     }
 }
 
-void MarkDownBlockParser::ParseTextAndEmphasis(std::stringstream& stream)
+void MarkDownBlockParser::ParseTextAndEmphasis(MarkDownStream& stream)
 {
-    EmphasisParser emphasisParser;
+    EmphasisParser emphasisParser(m_tokens);
     // do syntax check of normal text + emphasis
     emphasisParser.Match(stream);
     // append result to the rest
@@ -92,11 +92,12 @@ void MarkDownBlockParser::ParseTextAndEmphasis(std::stringstream& stream)
 // capture until it can't capture anymore.
 // it moves two states, emphasis state and text state,
 // at each transition of state, one token is captured
-void EmphasisParser::Match(std::stringstream& stream)
+void EmphasisParser::Match(MarkDownStream& stream)
 {
     while (m_current_state != EmphasisState::Captured)
     {
-        m_current_state = m_stateMachine.at(m_current_state)(*this, stream, m_current_token);
+        m_current_state = (m_current_state == EmphasisState::Text) ? MatchText(*this, stream, m_current_token) :
+                                                                     MatchEmphasis(*this, stream, m_current_token);
     }
 }
 
@@ -106,7 +107,7 @@ bool EmphasisParser::IsEmphasisToken(int currentChar)
 }
 
 /// captures text until it see emphasis character. When it does, switch to Emphasis state
-EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, MarkDownStream& stream, std::string& token)
 {
     const int currentChar = stream.peek();
     const bool isEmphasisToken = IsEmphasisToken(currentChar);
@@ -153,7 +154,7 @@ EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser,
 }
 
 /// captures text until it see non-emphasis character. When it does, switch to text state
-EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, MarkDownStream& stream, std::string& token)
 {
     // key word is encountered, flush what is being processed, and have those keyword
     // handled by ParseBlock()
@@ -229,9 +230,7 @@ void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken(std::string& cu
         return;
     }
 
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(currentToken);
-
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AddNewTokenToParsedResult(currentToken);
 
     currentToken.clear();
 }
@@ -297,17 +296,10 @@ bool EmphasisParser::TryCapturingRightEmphasisToken(const int ch, std::string& c
 {
     if (IsRightEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen = nullptr;
-        // right emphasis can be also left emphasis
-        if (IsLeftEmphasisDelimiter(ch))
-        {
-            // since it is both left and right emphasis, create one accordingly
-            codeGen = std::make_shared<MarkDownLeftAndRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
-        else
-        {
-            codeGen = std::make_shared<MarkDownRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
+        // right emphasis can be also left emphasis; if it is both left and right emphasis, create one accordingly
+        const MarkDownTokenType type =
+            IsLeftEmphasisDelimiter(ch) ? MarkDownTokenType::LeftAndRightEmphasis : MarkDownTokenType::RightEmphasis;
+        const size_t codeGen = m_tokens.AddEmphasisToken(type, currentToken, m_delimiterCnts, m_currentDelimiterType);
 
         m_parsedResult.AppendToLookUpTable(codeGen);
 
@@ -325,8 +317,8 @@ bool EmphasisParser::TryCapturingLeftEmphasisToken(const int ch, std::string& cu
     // left emphasis detected, save emphasis for later reference
     if (IsLeftEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen =
-            std::make_shared<MarkDownLeftEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
+        const size_t codeGen =
+            m_tokens.AddEmphasisToken(MarkDownTokenType::LeftEmphasis, currentToken, m_delimiterCnts, m_currentDelimiterType);
 
         m_parsedResult.AppendToLookUpTable(codeGen);
 
@@ -366,7 +358,7 @@ void EmphasisParser::CaptureEmphasisToken(const int ch, std::string& currentToke
     }
 }
 
-void LinkParser::Match(std::stringstream& stream)
+void LinkParser::Match(MarkDownStream& stream)
 {
     // link syntax check, match keyword at each stage
     bool capturedLink = (MatchAtLinkInit(stream) && MatchAtLinkTextRun(stream) && MatchAtLinkTextEnd(stream));
@@ -378,7 +370,7 @@ void LinkParser::Match(std::stringstream& stream)
 }
 
 // link is in form of [txt](url), this method matches '['
-bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkInit(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '[')
     {
@@ -394,7 +386,7 @@ bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches txt
-bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextRun(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == ']')
     {
@@ -432,7 +424,7 @@ bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches ']'
-bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextEnd(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '(')
     {
@@ -448,7 +440,7 @@ bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches '('
-bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationStart(MarkDownStream& lookahead)
 {
     // handles [xx](
     if (lookahead.peek() < 0)
@@ -493,7 +485,7 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
     lookahead.clear();
 
     // reset stream
-    lookahead.seekg(initialPosition, std::ios::beg);
+    lookahead.seekg(initialPosition);
 
     // Link destination end token is not detected if the position of linkDestinationEndToken is not moved
     // or control key is detected
@@ -506,7 +498,7 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
     return true;
 }
 // link is in form of [txt](url), this method matches ')'
-bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationRun(MarkDownStream& lookahead)
 {
     // TODO this check is not needed; remove it in next iteration
     // validation is done in MatchAtLinkDestinationStart
@@ -556,11 +548,10 @@ bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
 // <a href=\destination\>text</a>
 void LinkParser::CaptureLinkToken()
 {
-    std::ostringstream html;
-    html << "<a href=\"";
+    std::string html = "<a href=\"";
     // process link destination
-    html << m_parsedResult.GenerateHtmlString();
-    html << "\">";
+    m_parsedResult.GenerateHtmlString(html);
+    html += "\">";
 
     // when syntax check is complete, we have seen
     // '[', ']', '(', these keywords are not
@@ -574,23 +565,19 @@ void LinkParser::CaptureLinkToken()
     // translate what is captured in text of link
     // emphasis are processed here
     m_linkTextParsedResult.Translate();
-    html << m_linkTextParsedResult.GenerateHtmlString();
-    html << "</a>";
-
-    std::string html_string = html.str();
-
-    // Generate a MarkDownStringHtmlGenerator object
-    const std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(html_string);
+    m_linkTextParsedResult.GenerateHtmlString(html);
+    html += "</a>";
 
+    // Generate a text token of the link
     m_parsedResult.Clear();
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AddNewTokenToParsedResult(html);
     m_parsedResult.SetIsCaptured(true);
 }
 
 // list marker have form of ^-\s+ or \r-\s+
 // this method matches -\s
-bool ListParser::MatchNewListItem(std::stringstream& stream)
+bool ListParser::MatchNewListItem(MarkDownStream& stream)
 {
     const int ch = stream.peek();
     if (IsHyphen(ch) || IsPlus(ch) || IsAsterisk(ch))
@@ -612,7 +599,7 @@ bool ListParser::MatchNewListItem(std::stringstream& stream)
 // before calling this method
 // this method will return true, after it mataches new line char
 // at least once.
-bool ListParser::MatchNewBlock(std::stringstream& stream)
+bool ListParser::MatchNewBlock(MarkDownStream& stream)
 {
     if (IsNewLine(stream.peek()))
     {
@@ -629,7 +616,7 @@ bool ListParser::MatchNewBlock(std::stringstream& stream)
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
 // this method matches \d+\.
-bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string& number_string)
+bool ListParser::MatchNewOrderedListItem(MarkDownStream& stream, std::string& number_string)
 {
     do
     {
@@ -651,7 +638,7 @@ bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string&
 // parse blocks that wasn't captured
 // if what we encounter is one of following items, start of new list, list item, or new block element,
 // we do not include in the current block, we return, and have it handled by the caller
-void ListParser::ParseSubBlocks(std::stringstream& stream)
+void ListParser::ParseSubBlocks(MarkDownStream& stream)
 {
     while (!stream.eof())
     {
@@ -683,7 +670,7 @@ void ListParser::ParseSubBlocks(std::stringstream& stream)
     }
 }
 
-bool ListParser::CompleteListParsing(std::stringstream& stream)
+bool ListParser::CompleteListParsing(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     if (stream.peek() == ' ')
@@ -706,7 +693,7 @@ bool ListParser::CompleteListParsing(std::stringstream& stream)
 }
 
 // list marker has a form of ^-\s+ or [\r, \n]-\s+, and this method checks the syntax
-void ListParser::Match(std::stringstream& stream)
+void ListParser::Match(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     const int ch = stream.peek();
@@ -738,16 +725,12 @@ void ListParser::Match(std::stringstream& stream)
 
 void ListParser::CaptureListToken()
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string const htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
+    std::string html = "<li>";
+    m_parsedResult.GenerateHtmlString(html);
+    html += "</li>";
 
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownListHtmlGenerator> const codeGen = std::make_shared<MarkDownListHtmlGenerator>(html_string);
+    const size_t codeGen = m_tokens.AddToken(MarkDownTokenType::UnorderedList, html);
 
     m_parsedResult.Clear();
     m_parsedResult.FoundHtmlTags();
@@ -755,7 +738,7 @@ void ListParser::CaptureListToken()
 }
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
-void OrderedListParser::Match(std::stringstream& stream)
+void OrderedListParser::Match(MarkDownStream& stream)
 {
     // used to capture digit char
     std::string number_string = "";
@@ -792,17 +775,12 @@ void OrderedListParser::Match(std::stringstream& stream)
 
 void OrderedListParser::CaptureOrderedListToken(std::string& number_string)
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    const std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
+    std::string html = "<li>";
+    m_parsedResult.GenerateHtmlString(html);
+    html += "</li>";
 
-    std::string html_string = html.str();
-    const std::shared_ptr<MarkDownOrderedListHtmlGenerator> codeGen =
-        std::make_shared<MarkDownOrderedListHtmlGenerator>(html_string, number_string);
+    const size_t codeGen = m_tokens.AddOrderedListToken(html, number_string);
 
     m_parsedResult.Clear();
     m_parsedResult.FoundHtmlTags();
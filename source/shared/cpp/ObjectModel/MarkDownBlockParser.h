@@ -8,15 +8,134 @@
 
 namespace AdaptiveCards
 {
+// Reads markdown text in place. It has the subset of the std::istream interface that the parsers use, with the same
+// eof and fail semantics, so that the parsers behave the same as they do over a MarkDownStream of the text.
+class MarkDownStream
+{
+public:
+    MarkDownStream(std::string_view text) : m_text(text){};
+
+    int peek()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return EOF;
+        }
+
+        if (m_position == m_text.size())
+        {
+            m_eof = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_position]);
+    }
+
+    int get()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return EOF;
+        }
+
+        if (m_position == m_text.size())
+        {
+            m_eof = true;
+            m_fail = true;
+            return EOF;
+        }
+        return static_cast<unsigned char>(m_text[m_position++]);
+    }
+
+    // ch is left as is if there was nothing to get
+    void get(char& ch)
+    {
+        const int got = get();
+        if (got != EOF)
+        {
+            ch = static_cast<char>(got);
+        }
+    }
+
+    void unget()
+    {
+        m_eof = false;
+        if (!good())
+        {
+            m_fail = true;
+        }
+        else if (m_position == 0)
+        {
+            m_bad = true;
+        }
+        else
+        {
+            --m_position;
+        }
+    }
+
+    // only ever called with the char that was just read, so this is the same as unget()
+    void putback(char)
+    {
+        unget();
+    }
+
+    std::streamoff tellg()
+    {
+        if (!good())
+        {
+            m_fail = true;
+            return -1;
+        }
+        return static_cast<std::streamoff>(m_position);
+    }
+
+    void seekg(std::streamoff position)
+    {
+        m_eof = false;
+        if (!good() || position < 0 || static_cast<size_t>(position) > m_text.size())
+        {
+            m_fail = true;
+            return;
+        }
+        m_position = static_cast<size_t>(position);
+    }
+
+    void clear()
+    {
+        m_eof = false;
+        m_fail = false;
+        m_bad = false;
+    }
+
+    bool eof() const
+    {
+        return m_eof;
+    }
+
+private:
+    bool good() const
+    {
+        return !m_eof && !m_fail && !m_bad;
+    }
+
+    std::string_view m_text;
+    size_t m_position = 0;
+    bool m_eof = false;
+    bool m_fail = false;
+    bool m_bad = false;
+};
+
 class MarkDownBlockParser
 {
 public:
-    MarkDownBlockParser(){};
+    MarkDownBlockParser(MarkDownTokenArena& tokens) : m_tokens(tokens), m_parsedResult(tokens){};
     // Matches each MarkDown's Syntax Form
     // For each match, stream moves to the next char
-    virtual void Match(std::stringstream&) = 0;
+    virtual void Match(MarkDownStream&) = 0;
     // Parses Block
-    void ParseBlock(std::stringstream&);
+    void ParseBlock(MarkDownStream&);
     // Returns Parse result
     MarkDownParsedResult& GetParsedResult()
     {
@@ -51,7 +170,10 @@ protected:
         return (ch > 0) && isdigit(ch);
     }
 
-    void ParseTextAndEmphasis(std::stringstream& stream);
+    void ParseTextAndEmphasis(MarkDownStream& stream);
+
+    // Holds the tokens of every parser of the same markdown
+    MarkDownTokenArena& m_tokens;
 
     // Holds parsed results
     MarkDownParsedResult m_parsedResult;
@@ -60,7 +182,7 @@ protected:
 class EmphasisParser : public MarkDownBlockParser
 {
 public:
-    EmphasisParser() = default;
+    EmphasisParser(MarkDownTokenArena& tokens) : MarkDownBlockParser(tokens){};
     EmphasisParser(const EmphasisParser&) = delete;
     EmphasisParser(EmphasisParser&&) = delete;
     EmphasisParser& operator=(const EmphasisParser&) = delete;
@@ -74,7 +196,7 @@ public:
         Captured  // Emphasis parsing is complete
     };
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
     // Captures remaining charaters in given token and causes the emphasis parsing to terminate
     void Flush(const int ch, std::string& currentToken);
@@ -107,13 +229,11 @@ public:
         return (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore;
     };
 
-    typedef EmphasisState (*MatchWithChar)(EmphasisParser&, std::stringstream&, std::string&);
-
     // Callback function that handles the Text State
-    static EmphasisState MatchText(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchText(EmphasisParser&, MarkDownStream&, std::string&);
 
     // Callback function that handles the Emphasis State
-    static EmphasisState MatchEmphasis(EmphasisParser&, std::stringstream&, std::string&);
+    static EmphasisState MatchEmphasis(EmphasisParser&, MarkDownStream&, std::string&);
 
     static bool IsEmphasisToken(int token);
 
@@ -125,10 +245,6 @@ protected:
     DelimiterType m_currentDelimiterType = DelimiterType::Init;
     EmphasisState m_current_state = EmphasisState::Text;
 
-    // vector of callback functions that handles state transistions
-    const std::unordered_map<EmphasisState, MatchWithChar> m_stateMachine = {
-        {EmphasisState::Text, MatchText}, {EmphasisState::Emphasis, MatchEmphasis}};
-
     // holds currently collected token
     std::string m_current_token;
 };
@@ -136,28 +252,28 @@ protected:
 class LinkParser : public MarkDownBlockParser
 {
 public:
-    LinkParser() = default;
-    LinkParser(const LinkParser&) = default;
-    LinkParser(LinkParser&&) = default;
-    LinkParser& operator=(const LinkParser&) = default;
-    LinkParser& operator=(LinkParser&&) = default;
+    LinkParser(MarkDownTokenArena& tokens) : MarkDownBlockParser(tokens), m_linkTextParsedResult(tokens){};
+    LinkParser(const LinkParser&) = delete;
+    LinkParser(LinkParser&&) = delete;
+    LinkParser& operator=(const LinkParser&) = delete;
+    LinkParser& operator=(LinkParser&&) = delete;
     virtual ~LinkParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureLinkToken();
 
     // Matches Initial syntax of link
-    bool MatchAtLinkInit(std::stringstream&);
+    bool MatchAtLinkInit(MarkDownStream&);
     // Matches LinkText Run syntax of link
-    bool MatchAtLinkTextRun(std::stringstream&);
+    bool MatchAtLinkTextRun(MarkDownStream&);
     // Matches LinkText End syntax of link
-    bool MatchAtLinkTextEnd(std::stringstream&);
+    bool MatchAtLinkTextEnd(MarkDownStream&);
     // Matches LinkDestination Start syntax of link
-    bool MatchAtLinkDestinationStart(std::stringstream&);
+    bool MatchAtLinkDestinationStart(MarkDownStream&);
     // Matches LinkDestination Run syntax of link
-    bool MatchAtLinkDestinationRun(std::stringstream&);
+    bool MatchAtLinkDestinationRun(MarkDownStream&);
 
     int m_leftParenthesisCounts = 0;
     std::streamoff m_positionOfLinkDestinationEndToken = 0;
@@ -169,17 +285,17 @@ private:
 class ListParser : public MarkDownBlockParser
 {
 public:
-    ListParser() = default;
-    ListParser(const ListParser&) = default;
-    ListParser(ListParser&&) = default;
-    ListParser& operator=(const ListParser&) = default;
-    ListParser& operator=(ListParser&&) = default;
+    ListParser(MarkDownTokenArena& tokens) : MarkDownBlockParser(tokens){};
+    ListParser(const ListParser&) = delete;
+    ListParser(ListParser&&) = delete;
+    ListParser& operator=(const ListParser&) = delete;
+    ListParser& operator=(ListParser&&) = delete;
     virtual ~ListParser() = default;
 
-    void Match(std::stringstream&) override;
-    bool MatchNewListItem(std::stringstream&);
-    bool MatchNewBlock(std::stringstream&);
-    bool MatchNewOrderedListItem(std::stringstream&, std::string&);
+    void Match(MarkDownStream&) override;
+    bool MatchNewListItem(MarkDownStream&);
+    bool MatchNewBlock(MarkDownStream&);
+    bool MatchNewOrderedListItem(MarkDownStream&, std::string&);
     static constexpr bool IsHyphen(const int ch)
     {
         return ch == '-';
@@ -202,8 +318,8 @@ public:
     };
 
 protected:
-    void ParseSubBlocks(std::stringstream&);
-    bool CompleteListParsing(std::stringstream& stream);
+    void ParseSubBlocks(MarkDownStream&);
+    bool CompleteListParsing(MarkDownStream& stream);
 
 private:
     void CaptureListToken();
@@ -212,14 +328,14 @@ private:
 class OrderedListParser : public ListParser
 {
 public:
-    OrderedListParser() = default;
-    OrderedListParser(const OrderedListParser&) = default;
-    OrderedListParser(OrderedListParser&&) = default;
-    OrderedListParser& operator=(const OrderedListParser&) = default;
-    OrderedListParser& operator=(OrderedListParser&&) = default;
+    OrderedListParser(MarkDownTokenArena& tokens) : ListParser(tokens){};
+    OrderedListParser(const OrderedListParser&) = delete;
+    OrderedListParser(OrderedListParser&&) = delete;
+    OrderedListParser& operator=(const OrderedListParser&) = delete;
+    OrderedListParser& operator=(OrderedListParser&&) = delete;
     ~OrderedListParser() = default;
 
-    void Match(std::stringstream&) override;
+    void Match(MarkDownStream&) override;
 
 private:
     void CaptureOrderedListToken(std::string&);
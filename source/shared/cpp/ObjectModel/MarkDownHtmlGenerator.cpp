@@ -5,28 +5,57 @@
 
 using namespace AdaptiveCards;
 
-std::string MarkDownStringHtmlGenerator::GenerateHtmlString()
+namespace
 {
-    if (m_isHead)
+constexpr std::string_view GetTagHtml(char tag)
+{
+    switch (tag)
     {
-        m_token = "<p>" + m_token;
+    case 'i':
+        return "<em>";
+    case 'b':
+        return "<strong>";
+    case 'I':
+        return "</em>";
+    default:
+        return "</strong>";
     }
+}
+} // namespace
 
-    if (m_isTail)
+MarkDownToken::MarkDownBlockType MarkDownToken::GetBlockType() const
+{
+    switch (m_type)
     {
-        return m_token + "</p>";
+    case MarkDownTokenType::UnorderedList:
+        return UnorderedList;
+    case MarkDownTokenType::OrderedList:
+        return OrderedList;
+    default:
+        return ContainerBlock;
     }
+}
 
-    return m_token;
+bool MarkDownToken::IsRightEmphasis() const
+{
+    return (m_type == MarkDownTokenType::RightEmphasis || m_type == MarkDownTokenType::LeftAndRightEmphasis) &&
+           m_directionType == Right;
+}
+
+bool MarkDownToken::IsLeftEmphasis() const
+{
+    return m_type == MarkDownTokenType::LeftEmphasis ||
+           ((m_type == MarkDownTokenType::RightEmphasis || m_type == MarkDownTokenType::LeftAndRightEmphasis) &&
+            m_directionType == Left);
 }
 
 //     left and right emphasis tokens are match if
 //     1. they are same types
 //     2. neither of the emphasis tokens are both left and right emphasis tokens, and
 //        if either or both of them are, then their sum is not multiple of 3
-bool MarkDownEmphasisHtmlGenerator::IsMatch(const MarkDownEmphasisHtmlGenerator& emphasisToken)
+bool MarkDownToken::IsMatch(const MarkDownToken& emphasisToken) const
 {
-    if (this->type == emphasisToken.type)
+    if (this->m_delimiterType == emphasisToken.m_delimiterType)
     {
         // rule #9 & #10, sum of delimiter count can't be multiple of 3
         return !(
@@ -36,13 +65,13 @@ bool MarkDownEmphasisHtmlGenerator::IsMatch(const MarkDownEmphasisHtmlGenerator&
     return false;
 }
 
-bool MarkDownEmphasisHtmlGenerator::IsSameType(const MarkDownEmphasisHtmlGenerator& token)
+bool MarkDownToken::IsSameType(const MarkDownToken& token) const
 {
-    return this->type == token.type;
+    return this->m_delimiterType == token.m_delimiterType;
 }
 
 // adjust number of emphasis counts after maching is done
-int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken)
+int MarkDownToken::AdjustEmphasisCounts(int leftOver, MarkDownToken& rightToken)
 {
     int delimiterCount = 0;
     if (leftOver >= 0)
@@ -61,7 +90,7 @@ int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEm
 }
 
 // generate bold and emphasis html tags
-bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator& token)
+bool MarkDownToken::GenerateTags(MarkDownToken& token)
 {
     int delimiterCount = 0, leftOver = 0;
     leftOver = this->m_numberOfUnusedDelimiters - token.m_numberOfUnusedDelimiters;
@@ -84,131 +113,148 @@ bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator&
     return hasHtmlTags;
 }
 
-void MarkDownEmphasisHtmlGenerator::PushItalicTag()
+// left emphasis opens tags and right emphasis closes them; left and right emphasis does what its current
+// direction says
+void MarkDownToken::PushItalicTag()
 {
-    m_tags.push_back("<em>");
+    const bool isOpening = (m_type == MarkDownTokenType::LeftAndRightEmphasis) ? (m_directionType == Left) :
+                                                                                 (m_type != MarkDownTokenType::RightEmphasis);
+    m_tags.push_back(isOpening ? ItalicTag : ClosingItalicTag);
 }
 
-void MarkDownEmphasisHtmlGenerator::PushBoldTag()
+void MarkDownToken::PushBoldTag()
 {
-    m_tags.push_back("<strong>");
+    const bool isOpening = (m_type == MarkDownTokenType::LeftAndRightEmphasis) ? (m_directionType == Left) :
+                                                                                 (m_type != MarkDownTokenType::RightEmphasis);
+    m_tags.push_back(isOpening ? BoldTag : ClosingBoldTag);
 }
 
-std::string MarkDownLeftEmphasisHtmlGenerator::GenerateHtmlString()
+void MarkDownTokenArena::Reserve(size_t textLength)
 {
-    if (m_isHead)
-    {
-        html << "<p>";
-    }
-
-    if (m_numberOfUnusedDelimiters)
-    {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    // append tags; since left delims, append it in the reverse order
-    for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
-    {
-        html << *itr;
-    }
-
-    if (m_isTail)
-    {
-        return html.str() + "</p>";
-    }
-
-    return html.str();
+    m_text.reserve(textLength);
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushItalicTag()
+size_t MarkDownTokenArena::AddToken(MarkDownTokenType type, std::string_view text)
 {
-    m_tags.push_back("</em>");
+    m_tokens.emplace_back(type, m_text.size(), text.size());
+    m_text.append(text);
+    return m_tokens.size() - 1;
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushBoldTag()
+size_t MarkDownTokenArena::AddEmphasisToken(MarkDownTokenType type, std::string_view text, int sizeOfEmphasisDelimiterRun, DelimiterType delimiterType)
 {
-    m_tags.push_back("</strong>");
+    const size_t index = AddToken(type, text);
+    m_tokens[index].m_numberOfUnusedDelimiters = sizeOfEmphasisDelimiterRun;
+    m_tokens[index].m_delimiterType = delimiterType;
+    return index;
 }
 
-std::string MarkDownRightEmphasisHtmlGenerator::GenerateHtmlString()
+size_t MarkDownTokenArena::AddOrderedListToken(std::string_view text, std::string_view numberString)
 {
-    if (m_isHead)
-    {
-        html << "<p>";
-    }
-
-    // append tags;
-    for (auto itr = m_tags.begin(); itr != m_tags.end(); ++itr)
-    {
-        html << *itr;
-    }
-
-    // if there are unused emphasis, append them
-    if (m_numberOfUnusedDelimiters)
-    {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    if (m_isTail)
-    {
-        return html.str() + "</p>";
-    }
-
-    return html.str();
-}
-
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushItalicTag()
-{
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<em>");
-    }
-    else
-    {
-        m_tags.push_back("</em>");
-    }
-}
-
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushBoldTag()
-{
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<strong>");
-    }
-    else
-    {
-        m_tags.push_back("</strong>");
-    }
+    const size_t index = AddToken(MarkDownTokenType::OrderedList, text);
+    m_tokens[index].m_numberLength = numberString.size();
+    m_text.append(numberString);
+    return index;
 }
 
-std::string MarkDownListHtmlGenerator::GenerateHtmlString()
+std::string_view MarkDownTokenArena::GetText(const MarkDownToken& token) const
 {
-    if (m_isHead)
-    {
-        m_token = "<ul>" + m_token;
-    }
-
-    if (m_isTail)
-    {
-        return m_token + "</ul>";
-    }
-
-    return m_token;
+    return std::string_view{m_text}.substr(token.m_textOffset, token.m_textLength);
 }
 
-std::string MarkDownOrderedListHtmlGenerator::GenerateHtmlString()
+void MarkDownTokenArena::GenerateHtmlString(size_t index, std::string& html) const
 {
-    if (m_isHead)
-    {
-        m_token = "<ol start=\"" + m_numberString + "\">" + m_token;
-    }
+    const MarkDownToken& token = m_tokens[index];
+    const std::string_view text = GetText(token);
 
-    if (m_isTail)
+    switch (token.m_type)
     {
-        return m_token + "</ol>";
+    case MarkDownTokenType::UnorderedList:
+        if (token.m_isHead)
+        {
+            html += "<ul>";
+        }
+        html += text;
+        if (token.m_isTail)
+        {
+            html += "</ul>";
+        }
+        break;
+
+    case MarkDownTokenType::OrderedList:
+        if (token.m_isHead)
+        {
+            html += "<ol start=\"";
+            html += std::string_view{m_text}.substr(token.m_textOffset + token.m_textLength, token.m_numberLength);
+            html += "\">";
+        }
+        html += text;
+        if (token.m_isTail)
+        {
+            html += "</ol>";
+        }
+        break;
+
+    case MarkDownTokenType::LeftEmphasis:
+        if (token.m_isHead)
+        {
+            html += "<p>";
+        }
+
+        if (token.m_numberOfUnusedDelimiters)
+        {
+            const size_t startIdx = text.size() - token.m_numberOfUnusedDelimiters;
+            html += text.substr(startIdx);
+        }
+
+        // append tags; since left delims, append it in the reverse order
+        for (auto itr = token.m_tags.rbegin(); itr != token.m_tags.rend(); ++itr)
+        {
+            html += GetTagHtml(*itr);
+        }
+
+        if (token.m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
+
+    case MarkDownTokenType::RightEmphasis:
+    case MarkDownTokenType::LeftAndRightEmphasis:
+        if (token.m_isHead)
+        {
+            html += "<p>";
+        }
+
+        // append tags;
+        for (const char tag : token.m_tags)
+        {
+            html += GetTagHtml(tag);
+        }
+
+        // if there are unused emphasis, append them
+        if (token.m_numberOfUnusedDelimiters)
+        {
+            const size_t startIdx = text.size() - token.m_numberOfUnusedDelimiters;
+            html += text.substr(startIdx);
+        }
+
+        if (token.m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
+
+    default:
+        if (token.m_isHead)
+        {
+            html += "<p>";
+        }
+        html += text;
+        if (token.m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
     }
-
-    return m_token;
 }
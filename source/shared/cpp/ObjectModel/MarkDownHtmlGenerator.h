@@ -2,9 +2,8 @@
 // Licensed under the MIT License.
 #pragma once
 #include <string>
-#include <iomanip>
+#include <string_view>
 #include <vector>
-#include <list>
 #include "BaseCardElement.h"
 
 namespace AdaptiveCards
@@ -20,26 +19,36 @@ enum class DelimiterType
     Asterisk
 };
 
-// this class knows how to generate html string of their types
-// - MarkDownStringHtmlGenerator
+// the kinds of tokens markdown is parsed into; each knows how to generate html string of itself
+// - Text
 //   it is the most basic form,
 //   it simply retains and return text as string
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
+// - NewLine
+//   it contains new line chars
+// - LeftEmphasis, RightEmphasis and LeftAndRightEmphasis
+//   they know how to handle bold and italic html
+//   tags and apply those to its text when asked to generate html string;
+//   left and right emphasis can have both directions, and its final direction is determined at the later stage
+// - UnorderedList and OrderedList
+//   they function similarly as Text, but their GetBlockType() returns
 //   MarkDownBlockType, this is used in generating html block tags
-//   list uses block tag of <ul> all others use <p>
-class MarkDownHtmlGenerator
+//   list uses block tag of <ul> or <ol> all others use <p>
+enum class MarkDownTokenType
 {
-public:
-    MarkDownHtmlGenerator(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator(MarkDownHtmlGenerator&&) = delete;
-    MarkDownHtmlGenerator& operator=(const MarkDownHtmlGenerator&) = delete;
-    MarkDownHtmlGenerator& operator=(MarkDownHtmlGenerator&&) = delete;
-    virtual ~MarkDownHtmlGenerator() = default;
+    Text,
+    NewLine,
+    LeftEmphasis,
+    RightEmphasis,
+    LeftAndRightEmphasis,
+    UnorderedList,
+    OrderedList
+};
 
+// a parsed markdown token. tokens are values that live in a MarkDownTokenArena, and their text lives in the arena's
+// text buffer, so parsing doesn't allocate per token.
+class MarkDownToken
+{
+public:
     enum MarkDownBlockType
     {
         ContainerBlock,
@@ -47,8 +56,11 @@ public:
         OrderedList
     };
 
-    MarkDownHtmlGenerator() : m_token(""){};
-    MarkDownHtmlGenerator(std::string& token) : m_token(token){};
+    MarkDownToken(MarkDownTokenType type, size_t textOffset, size_t textLength) :
+        m_type(type), m_textOffset(textOffset), m_textLength(textLength)
+    {
+    }
+
     void MakeItHead()
     {
         m_isHead = true;
@@ -57,95 +69,21 @@ public:
     {
         m_isTail = true;
     }
-    virtual bool IsNewLine()
-    {
-        return false;
-    }
-    virtual std::string GenerateHtmlString() = 0;
-    virtual MarkDownBlockType GetBlockType() const
-    {
-        return ContainerBlock;
-    };
-
-protected:
-    std::string m_token;
-    std::ostringstream html;
-    bool m_isHead = false;
-    bool m_isTail = false;
-};
-
-// - MarkDownStringHtmlGenerator
-//   it is the most basic form,
-//   it simply retains and return text as string
-class MarkDownStringHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownStringHtmlGenerator() = delete;
-    MarkDownStringHtmlGenerator(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator(MarkDownStringHtmlGenerator&&) = delete;
-    MarkDownStringHtmlGenerator& operator=(const MarkDownStringHtmlGenerator&) = delete;
-    MarkDownStringHtmlGenerator& operator=(MarkDownStringHtmlGenerator&&) = delete;
-    ~MarkDownStringHtmlGenerator() = default;
-
-    MarkDownStringHtmlGenerator(std::string& token) : MarkDownHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-};
-
-// - MarkDownNewLineHtmlGenerator
-//   it contains new line chars
-class MarkDownNewLineHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownNewLineHtmlGenerator() = delete;
-    MarkDownNewLineHtmlGenerator(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator(MarkDownNewLineHtmlGenerator&&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(const MarkDownNewLineHtmlGenerator&) = delete;
-    MarkDownNewLineHtmlGenerator& operator=(MarkDownNewLineHtmlGenerator&&) = delete;
-    ~MarkDownNewLineHtmlGenerator() = default;
-
-    MarkDownNewLineHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    bool IsNewLine() override
+    bool IsNewLine() const
     {
-        return true;
+        return m_type == MarkDownTokenType::NewLine;
     }
-};
-
-// - MarkDownEmphasisHtmlGenerator
-//   it knows how to handle bold and italic html
-//   tags and apply those to its text when asked to generate html string
-class MarkDownEmphasisHtmlGenerator : public MarkDownHtmlGenerator
-{
-public:
-    MarkDownEmphasisHtmlGenerator() = delete;
-    MarkDownEmphasisHtmlGenerator(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator(MarkDownEmphasisHtmlGenerator&&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(const MarkDownEmphasisHtmlGenerator&) = delete;
-    MarkDownEmphasisHtmlGenerator& operator=(MarkDownEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownEmphasisHtmlGenerator() = default;
-
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
+    MarkDownBlockType GetBlockType() const;
 
-    MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type), m_tags(tags){};
-
-    virtual bool IsRightEmphasis() const
-    {
-        return false;
-    }
-    virtual bool IsLeftEmphasis() const
-    {
-        return false;
-    }
-    virtual bool IsLeftAndRightEmphasis() const
+    // emphasis tokens
+    bool IsRightEmphasis() const;
+    bool IsLeftEmphasis() const;
+    bool IsLeftAndRightEmphasis() const
     {
-        return false;
+        return m_type == MarkDownTokenType::LeftAndRightEmphasis;
     }
-    virtual void PushItalicTag();
-    virtual void PushBoldTag();
-
-    bool IsMatch(const MarkDownEmphasisHtmlGenerator& token);
-    bool IsSameType(const MarkDownEmphasisHtmlGenerator& token);
+    bool IsMatch(const MarkDownToken& token) const;
+    bool IsSameType(const MarkDownToken& token) const;
     bool IsDone() const
     {
         return m_numberOfUnusedDelimiters == 0;
@@ -154,157 +92,78 @@ public:
     {
         return m_numberOfUnusedDelimiters;
     };
-    bool GenerateTags(MarkDownEmphasisHtmlGenerator& token);
+    bool GenerateTags(MarkDownToken& token);
     void ChangeDirectionToLeft()
     {
         m_directionType = Left;
     };
 
-protected:
+private:
+    friend class MarkDownTokenArena;
+
     enum
     {
         Left = 0,
         Right = 1,
     };
 
-    int AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken);
-    int m_numberOfUnusedDelimiters;
+    // tags are kept as one char each, and are only spelled out when html is generated
+    static constexpr char ItalicTag = 'i';
+    static constexpr char BoldTag = 'b';
+    static constexpr char ClosingItalicTag = 'I';
+    static constexpr char ClosingBoldTag = 'B';
+
+    void PushItalicTag();
+    void PushBoldTag();
+    int AdjustEmphasisCounts(int leftOver, MarkDownToken& rightToken);
+
+    MarkDownTokenType m_type;
+    size_t m_textOffset;
+    size_t m_textLength;
+    // the number of an ordered list; it follows the text in the arena
+    size_t m_numberLength = 0;
+    int m_numberOfUnusedDelimiters = 0;
     int m_directionType = Right;
-    DelimiterType type;
-    std::vector<std::string> m_tags;
-};
-
-// - MarkDownLeftEmphasisHtmlGenerator
-//   it knows how to generates opening italic and bold html tags
-class MarkDownLeftEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-{
-public:
-    MarkDownLeftEmphasisHtmlGenerator() = delete;
-    MarkDownLeftEmphasisHtmlGenerator(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(const MarkDownLeftEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftEmphasisHtmlGenerator& operator=(MarkDownLeftEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftEmphasisHtmlGenerator() = default;
-
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-    MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type, tags){};
-
-    bool IsLeftEmphasis() const override
-    {
-        return true;
-    }
-    std::string GenerateHtmlString() override;
+    DelimiterType m_delimiterType = DelimiterType::Init;
+    std::string m_tags;
+    bool m_isHead = false;
+    bool m_isTail = false;
 };
 
-// - MarkDownRightEmphasisHtmlGenerator
-//   it knows how to generates closing italic and bold html tags
-class MarkDownRightEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
+// owns the tokens of one markdown string and their text
+class MarkDownTokenArena
 {
 public:
-    MarkDownRightEmphasisHtmlGenerator() = delete;
-    MarkDownRightEmphasisHtmlGenerator(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(const MarkDownRightEmphasisHtmlGenerator&) = delete;
-    MarkDownRightEmphasisHtmlGenerator& operator=(MarkDownRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownRightEmphasisHtmlGenerator() = default;
-
-    MarkDownRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-    void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator>& token);
-
-    bool IsRightEmphasis() const override
-    {
-        return m_directionType == Right;
-    }
-
-    bool IsLeftEmphasis() const override
-    {
-        return m_directionType == Left;
-    }
+    MarkDownTokenArena() = default;
+    MarkDownTokenArena(const MarkDownTokenArena&) = delete;
+    MarkDownTokenArena(MarkDownTokenArena&&) = delete;
+    MarkDownTokenArena& operator=(const MarkDownTokenArena&) = delete;
+    MarkDownTokenArena& operator=(MarkDownTokenArena&&) = delete;
+    ~MarkDownTokenArena() = default;
 
-    std::string GenerateHtmlString() override;
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
+    void Reserve(size_t textLength);
 
-// - MarkDownLeftAndRightEmphasisHtmlGenerator
-//   it can have both directions, and its final direction is determined at the later stage
-class MarkDownLeftAndRightEmphasisHtmlGenerator : public MarkDownRightEmphasisHtmlGenerator
-{
-public:
-    MarkDownLeftAndRightEmphasisHtmlGenerator() = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = delete;
-    MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = delete;
-    ~MarkDownLeftAndRightEmphasisHtmlGenerator() = default;
+    // each of these return the index of the new token
+    size_t AddToken(MarkDownTokenType type, std::string_view text);
+    size_t AddEmphasisToken(MarkDownTokenType type, std::string_view text, int sizeOfEmphasisDelimiterRun, DelimiterType delimiterType);
+    size_t AddOrderedListToken(std::string_view text, std::string_view numberString);
 
-    MarkDownLeftAndRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-        MarkDownRightEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-    bool IsRightEmphasis() const override
+    MarkDownToken& operator[](size_t index)
     {
-        return m_directionType == Right;
+        return m_tokens[index];
     }
-    bool IsLeftEmphasis() const override
+    const MarkDownToken& operator[](size_t index) const
     {
-        return m_directionType == Left;
+        return m_tokens[index];
     }
-    bool IsLeftAndRightEmphasis() const override
-    {
-        return true;
-    };
-    void PushItalicTag() override;
-    void PushBoldTag() override;
-};
-
-// - MarkDownListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   UnorderedList type, this is used in generating html block tags <ul>
-class MarkDownListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownListHtmlGenerator() = delete;
-    MarkDownListHtmlGenerator(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator(MarkDownListHtmlGenerator&&) = delete;
-    MarkDownListHtmlGenerator& operator=(const MarkDownListHtmlGenerator&) = delete;
-    MarkDownListHtmlGenerator& operator=(MarkDownListHtmlGenerator&&) = delete;
-    ~MarkDownListHtmlGenerator() = default;
-
-    MarkDownListHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
-    {
-        return UnorderedList;
-    };
-};
-
-// - MarkDownUnorderedListHtmlGenerator
-//   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-//   OrderedList type, this is used in generating html block tags <ol>
-class MarkDownOrderedListHtmlGenerator : public MarkDownStringHtmlGenerator
-{
-public:
-    MarkDownOrderedListHtmlGenerator() = delete;
-    MarkDownOrderedListHtmlGenerator(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator(MarkDownOrderedListHtmlGenerator&&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(const MarkDownOrderedListHtmlGenerator&) = delete;
-    MarkDownOrderedListHtmlGenerator& operator=(MarkDownOrderedListHtmlGenerator&&) = delete;
-    ~MarkDownOrderedListHtmlGenerator() = default;
 
-    MarkDownOrderedListHtmlGenerator(std::string& token, std::string& number_string) :
-        MarkDownStringHtmlGenerator(token), m_numberString(number_string){};
-    std::string GenerateHtmlString() override;
-    MarkDownBlockType GetBlockType() const override
-    {
-        return OrderedList;
-    };
+    // appends the html of the token at index to html
+    void GenerateHtmlString(size_t index, std::string& html) const;
 
 private:
-    std::string m_numberString;
-};
+    std::string_view GetText(const MarkDownToken& token) const;
 
+    std::vector<MarkDownToken> m_tokens;
+    std::string m_text;
+};
 } // namespace AdaptiveCards
@@ -13,25 +13,30 @@ void MarkDownParsedResult::Translate()
 // appends html block tags at head and tail of the list
 void MarkDownParsedResult::AddBlockTags()
 {
+    if (m_codeGenTokens.empty())
+    {
+        return;
+    }
+
     // Parsing is done, let code gen token know who is the head of the list
-    m_codeGenTokens.front()->MakeItHead();
+    m_tokens[m_codeGenTokens.front()].MakeItHead();
 
     // Parsing is done, let code gen token know who is the tail of the list
-    m_codeGenTokens.back()->MakeItTail();
+    m_tokens[m_codeGenTokens.back()].MakeItTail();
 }
 
-void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
+void MarkDownParsedResult::MarkTags(MarkDownToken& x)
 {
-    if (m_codeGenTokens.back()->GetBlockType() != x.GetBlockType())
+    if (m_tokens[m_codeGenTokens.back()].GetBlockType() != x.GetBlockType())
     {
-        if (m_codeGenTokens.back()->IsNewLine())
+        if (m_tokens[m_codeGenTokens.back()].IsNewLine())
         {
             m_codeGenTokens.pop_back();
         }
 
         if (!m_codeGenTokens.empty())
         {
-            m_codeGenTokens.back()->MakeItTail();
+            m_tokens[m_codeGenTokens.back()].MakeItTail();
         }
         x.MakeItHead();
     }
@@ -42,33 +47,35 @@ void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult& x)
     if (!m_codeGenTokens.empty() && !x.m_codeGenTokens.empty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x.m_codeGenTokens.front()));
+        MarkTags(m_tokens[x.m_codeGenTokens.front()]);
     }
-    m_codeGenTokens.splice(m_codeGenTokens.end(), x.m_codeGenTokens);
-    m_emphasisLookUpTable.splice(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable);
+    m_codeGenTokens.insert(m_codeGenTokens.end(), x.m_codeGenTokens.begin(), x.m_codeGenTokens.end());
+    m_emphasisLookUpTable.insert(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable.begin(), x.m_emphasisLookUpTable.end());
+    x.m_codeGenTokens.clear();
+    x.m_emphasisLookUpTable.clear();
     m_isHTMLTagsAdded = m_isHTMLTagsAdded || x.HasHtmlTags();
     SetIsCaptured(x.GetIsCaptured());
 }
 
-// append MarkDownHtmlGenerator object to callee's prased result
-void MarkDownParsedResult::AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>& x)
+// append token to callee's prased result
+void MarkDownParsedResult::AppendToTokens(size_t x)
 {
     if (!m_codeGenTokens.empty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x));
+        MarkTags(m_tokens[x]);
     }
     m_codeGenTokens.push_back(x);
 }
 
-void MarkDownParsedResult::AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>& x)
+void MarkDownParsedResult::AppendToLookUpTable(size_t x)
 {
     m_emphasisLookUpTable.push_back(x);
 }
 
 void MarkDownParsedResult::PopFront()
 {
-    m_codeGenTokens.pop_front();
+    m_codeGenTokens.erase(m_codeGenTokens.begin());
 }
 
 void MarkDownParsedResult::PopBack()
@@ -82,40 +89,39 @@ void MarkDownParsedResult::Clear()
     m_emphasisLookUpTable.clear();
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string of ch
+// create and add new text token that has string of ch
 void MarkDownParsedResult::AddNewTokenToParsedResult(int ch)
 {
-    std::string string_token = std::string(1, static_cast<char>(ch));
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    const char string_token = static_cast<char>(ch);
+    AppendToTokens(m_tokens.AddToken(MarkDownTokenType::Text, std::string_view{&string_token, 1}));
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string word
-void MarkDownParsedResult::AddNewTokenToParsedResult(std::string& word)
+// create and add new text token that has string word
+void MarkDownParsedResult::AddNewTokenToParsedResult(std::string_view word)
 {
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(word);
-    AppendToTokens(htmlToken);
+    AppendToTokens(m_tokens.AddToken(MarkDownTokenType::Text, word));
 }
 
-// create and add new MarkDownSpaceHtmlGenerator object that has string of ch
+// create and add new new line token that has string of ch
 void MarkDownParsedResult::AddNewLineTokenToParsedResult(char ch)
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownHtmlGenerator> htmlToken = std::make_shared<MarkDownNewLineHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    AppendToTokens(m_tokens.AddToken(MarkDownTokenType::NewLine, std::string_view{&ch, 1}));
 }
 
 std::string MarkDownParsedResult::GenerateHtmlString()
 {
-    // process tags
-    std::ostringstream html;
+    std::string html;
+    GenerateHtmlString(html);
+    return html;
+}
 
-    for (auto itr = m_codeGenTokens.begin(); itr != m_codeGenTokens.end(); ++itr)
+// appends html of the tokens to html
+void MarkDownParsedResult::GenerateHtmlString(std::string& html)
+{
+    for (const size_t token : m_codeGenTokens)
     {
-        html << (*itr)->GenerateHtmlString();
+        m_tokens.GenerateHtmlString(token, html);
     }
-
-    return html.str();
 }
 
 // Following the rules speicified in CommonMark (http://spec.commonmark.org/0.27/)
@@ -132,22 +138,23 @@ std::string MarkDownParsedResult::GenerateHtmlString()
 // add comments -> what it does: generating  n supported features + 1 tokens --> capture them in token class
 void MarkDownParsedResult::MatchLeftAndRightEmphasises()
 {
-    std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> leftEmphasisToExplore;
-    auto currentEmphasis = m_emphasisLookUpTable.begin();
+    // leftEmphasisToExplore holds indices of tokens, and currentEmphasis is a position in m_emphasisLookUpTable
+    std::vector<size_t> leftEmphasisToExplore;
+    size_t currentEmphasis = 0;
 
-    while (!(currentEmphasis == m_emphasisLookUpTable.end()))
+    while (currentEmphasis != m_emphasisLookUpTable.size())
     {
+        MarkDownToken& currentToken = m_tokens[m_emphasisLookUpTable[currentEmphasis]];
         // keep exploring left until right token is found
-        if ((*currentEmphasis)->IsLeftEmphasis() ||
-            ((*currentEmphasis)->IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
+        if (currentToken.IsLeftEmphasis() || (currentToken.IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
         {
-            if ((*currentEmphasis)->IsLeftAndRightEmphasis() && (*currentEmphasis)->IsRightEmphasis())
+            if (currentToken.IsLeftAndRightEmphasis() && currentToken.IsRightEmphasis())
             {
                 // Reverse Direction Type; right empahsis to left emphasis
-                (*currentEmphasis)->ChangeDirectionToLeft();
+                currentToken.ChangeDirectionToLeft();
             }
 
-            leftEmphasisToExplore.push_back(currentEmphasis);
+            leftEmphasisToExplore.push_back(m_emphasisLookUpTable[currentEmphasis]);
             ++currentEmphasis;
         }
         else if (!leftEmphasisToExplore.empty())
@@ -172,9 +179,9 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
             //        as left emphasis
             //        else
             //        use current left emphasis to search, and pop current right emphasis
-            if (!(*currentLeftEmphasis)->IsMatch(*(*currentEmphasis)))
+            if (!m_tokens[currentLeftEmphasis].IsMatch(currentToken))
             {
-                std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> store;
+                std::vector<size_t> store;
                 bool isFound = false;
                 // search first if matching left emphasis can be found with the right delim
                 // if match found, set the new left emphasis token as current token, and
@@ -184,7 +191,7 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                 while (!leftEmphasisToExplore.empty() && !isFound)
                 {
                     auto leftToken = leftEmphasisToExplore.back();
-                    if ((*leftToken)->IsMatch(*(*currentEmphasis)))
+                    if (m_tokens[leftToken].IsMatch(currentToken))
                     {
                         currentLeftEmphasis = leftToken;
                         isFound = true;
@@ -213,11 +220,11 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                     }
 
                     // check for the reason why we had to backtrack
-                    if ((*leftEmphasisToExplore.back())->IsSameType(*(*currentEmphasis)))
+                    if (m_tokens[leftEmphasisToExplore.back()].IsSameType(currentToken))
                     {
                         // right emphasis becomes left emphasis
                         /// create new left empahsis html generator from right
-                        (*currentEmphasis)->ChangeDirectionToLeft();
+                        currentToken.ChangeDirectionToLeft();
                     }
                     else
                     {
@@ -229,16 +236,16 @@ void MarkDownParsedResult::MatchLeftAndRightEmphasises()
                 }
             }
             // check which one has leftover delims
-            m_isHTMLTagsAdded = (*currentLeftEmphasis)->GenerateTags(*(*currentEmphasis)) || m_isHTMLTagsAdded;
+            m_isHTMLTagsAdded = m_tokens[currentLeftEmphasis].GenerateTags(currentToken) || m_isHTMLTagsAdded;
 
             // all right delims used, move to next
-            if ((*currentEmphasis)->IsDone())
+            if (currentToken.IsDone())
             {
                 ++currentEmphasis;
             }
 
             // all left or right delims used, pop
-            if ((*currentLeftEmphasis)->IsDone())
+            if (m_tokens[currentLeftEmphasis].IsDone())
             {
                 leftEmphasisToExplore.pop_back();
             }
@@ -4,7 +4,6 @@
 
 #include "BaseCardElement.h"
 #include "MarkDownHtmlGenerator.h"
-#include <list>
 
 namespace AdaptiveCards
 {
@@ -12,7 +11,7 @@ namespace AdaptiveCards
 class MarkDownParsedResult
 {
 public:
-    MarkDownParsedResult() : m_isHTMLTagsAdded(false), m_isCaptured(false){};
+    MarkDownParsedResult(MarkDownTokenArena& tokens) : m_tokens(tokens), m_isHTMLTagsAdded(false), m_isCaptured(false){};
 
     // Translate Intermediate Parsing Result to a form that can be written to html string
     void Translate();
@@ -20,22 +19,23 @@ public:
 
     // Write to html string
     std::string GenerateHtmlString();
+    void GenerateHtmlString(std::string& html);
 
     // Append contents of the given parsing result object
     void AppendParseResult(MarkDownParsedResult&);
 
-    // Append html code gen object to parse result
-    void AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>&);
+    // Append the token at the given index of the arena to parse result
+    void AppendToTokens(size_t);
 
-    // Append emphasis html code gen object to parse result
-    void AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>&);
+    // Append the emphasis token at the given index of the arena to parse result
+    void AppendToLookUpTable(size_t);
 
     // Take a char and convert it html code gen and append it to the result. used to store MarkDown keywords such as
     // '[', ']', '(', ')'
     void AddNewTokenToParsedResult(int ch);
 
     // Take string and convert it html code gen and append it to the result
-    void AddNewTokenToParsedResult(std::string& word);
+    void AddNewTokenToParsedResult(std::string_view word);
 
     // Take a new line char and convert it html code gen and append it to the result It is used to store MarkDown
     // keywords such as '\r', '\n'
@@ -55,9 +55,11 @@ public:
     }
 
 private:
-    void MarkTags(MarkDownHtmlGenerator&);
-    std::list<std::shared_ptr<MarkDownHtmlGenerator>> m_codeGenTokens;
-    std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>> m_emphasisLookUpTable;
+    void MarkTags(MarkDownToken&);
+    MarkDownTokenArena& m_tokens;
+    // indices of the tokens in m_tokens
+    std::vector<size_t> m_codeGenTokens;
+    std::vector<size_t> m_emphasisLookUpTable;
     bool m_isHTMLTagsAdded;
     bool m_isCaptured;
 
@@ -8,7 +8,8 @@
 
 using namespace AdaptiveCards;
 
-MarkDownParser::MarkDownParser(const std::string& txt) : m_text(txt), m_hasHTMLTag(false), m_isEscaped(false)
+MarkDownParser::MarkDownParser(const std::string& txt) :
+    m_text(txt), m_parsedResult(m_tokens), m_hasHTMLTag(false), m_isEscaped(false)
 {
 }
 
@@ -51,8 +52,11 @@ std::string MarkDownParser::GetRawText() const
 // MarkDown is consisted of Blocks, this methods parses blocks
 void MarkDownParser::ParseBlock()
 {
-    std::stringstream stream(EscapeText());
-    EmphasisParser parser;
+    const std::string escaped = EscapeText();
+    m_tokens.Reserve(escaped.size());
+
+    MarkDownStream stream(escaped);
+    EmphasisParser parser(m_tokens);
     while (!stream.eof())
     {
         parser.ParseBlock(stream);
@@ -63,6 +67,7 @@ void MarkDownParser::ParseBlock()
 std::string MarkDownParser::EscapeText()
 {
     std::string escaped;
+    escaped.reserve(m_text.length());
     unsigned int nonEscapedCounts = 0;
 
     for (std::string::size_type i = 0; i < m_text.length(); i++)
@@ -27,6 +27,7 @@ private:
     void ParseBlock();
     std::string EscapeText();
     std::string m_text;
+    MarkDownTokenArena m_tokens;
     MarkDownParsedResult m_parsedResult;
     bool m_hasHTMLTag;
     bool m_isEscaped;
@@ -101,9 +101,11 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(ParseC
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min});
+    m_knownProperties = &knownProperties;
 }
@@ -37,7 +37,7 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::Deserialize(ParseContext
 
     openUrlAction->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
     openUrlAction->SetRole(
-        ParseUtil::GetEnumValue<ActionRole>(json, AdaptiveCardSchemaKey::ActionRole, ActionRole::Link, ActionRoleFromString));
+        ParseUtil::GetEnumValue<ActionRole>(json, AdaptiveCardSchemaKey::ActionRole, ActionRole::Link, ActionRoleTryFromString));
 
     return openUrlAction;
 }
@@ -49,5 +49,6 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
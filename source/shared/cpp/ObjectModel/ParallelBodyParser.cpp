@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParallelBodyParser.h"
+#include "ParseUtil.h"
+
+#include <future>
+
+namespace AdaptiveCards
+{
+namespace
+{
+    // A run of consecutive top-level elements, and the result of parsing them
+    struct BodyRun
+    {
+        size_t begin;
+        size_t end;
+        ParseContext context;
+        std::vector<std::shared_ptr<BaseCardElement>> elements;
+        std::exception_ptr error;
+    };
+
+    void ParseElements(
+        ParseContext& context, const Json::Value& bodyJson, size_t begin, size_t end, std::vector<std::shared_ptr<BaseCardElement>>& elements)
+    {
+        const size_t itemCount = bodyJson.size();
+        for (size_t i = begin; i < end; ++i)
+        {
+            ParseUtil::AddElementCollectionItem<BaseCardElement>(
+                true, context, bodyJson[static_cast<Json::ArrayIndex>(i)], i, itemCount, "", elements);
+        }
+    }
+
+    void ParseRun(const Json::Value& bodyJson, BodyRun& run)
+    {
+        try
+        {
+            ParseElements(run.context, bodyJson, run.begin, run.end, run.elements);
+        }
+        catch (...)
+        {
+            run.error = std::current_exception();
+        }
+    }
+} // namespace
+
+std::vector<std::shared_ptr<BaseCardElement>> ParallelBodyParser::Parse(ParseContext& context, const Json::Value& bodyJson)
+{
+    const size_t itemCount = bodyJson.size();
+    const size_t runCount = std::min<size_t>(context.GetMaxParseThreads(), itemCount);
+
+    std::vector<std::shared_ptr<BaseCardElement>> elements;
+    elements.reserve(itemCount);
+    if (runCount < 2)
+    {
+        ParseElements(context, bodyJson, 0, itemCount, elements);
+        return elements;
+    }
+
+    std::vector<BodyRun> runs;
+    runs.reserve(runCount);
+    for (size_t i = 0; i < runCount; ++i)
+    {
+        runs.push_back({i * itemCount / runCount, (i + 1) * itemCount / runCount, context.CreateSubtreeContext(), {}, {}});
+    }
+
+    // The first run is parsed on this thread. If a thread can't be started, its run is parsed here too.
+    std::vector<std::future<void>> pending;
+    pending.reserve(runCount - 1);
+    for (size_t i = 1; i < runCount; ++i)
+    {
+        try
+        {
+            pending.push_back(std::async(std::launch::async, ParseRun, std::cref(bodyJson), std::ref(runs[i])));
+        }
+        catch (const std::system_error&)
+        {
+            ParseRun(bodyJson, runs[i]);
+        }
+    }
+    ParseRun(bodyJson, runs[0]);
+    for (auto& run : pending)
+    {
+        run.wait();
+    }
+
+    for (auto& run : runs)
+    {
+        context.ReplayIdOperations(run.context);
+        context.warnings.insert(context.warnings.end(), run.context.warnings.begin(), run.context.warnings.end());
+        if (run.error)
+        {
+            std::rethrow_exception(run.error);
+        }
+
+        elements.insert(elements.end(), run.elements.begin(), run.elements.end());
+
+        if (!context.HasSameScope(run.context))
+        {
+            context.AdoptScope(run.context);
+            ParseElements(context, bodyJson, run.end, itemCount, elements);
+            break;
+        }
+    }
+
+    return elements;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseCardElement.h"
+#include "ParseContext.h"
+
+namespace AdaptiveCards
+{
+// Parses the top-level elements of a card's body on up to ParseContext::GetMaxParseThreads() threads.
+//
+// The elements are split into runs of consecutive elements, and each run is parsed on a subtree context of its own
+// (see ParseContext::CreateSubtreeContext). Once they're all done, the runs are merged in order: the ID stack
+// operations of each run are replayed on the card's context, which detects ID collisions exactly as a sequential parse
+// would, then its warnings and elements are appended, and then its error, if it had one, is rethrown. So the result,
+// the warnings and their order, and the first error are all those of a sequential parse.
+//
+// Parsing an element can leave state behind for the elements after it (an Action.ShowCard pushes its card's style
+// and never pops it, for instance). Those elements were parsed without it, so if a run ends with state its context
+// didn't start with, the card's context takes that state on and parses the rest of the body sequentially.
+class ParallelBodyParser
+{
+public:
+    static std::vector<std::shared_ptr<BaseCardElement>> Parse(ParseContext& context, const Json::Value& bodyJson);
+};
+} // namespace AdaptiveCards
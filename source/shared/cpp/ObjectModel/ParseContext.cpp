@@ -6,6 +6,8 @@
 #include "BaseElement.h"
 #include "StyledCollectionElement.h"
 
+#include <set>
+
 namespace AdaptiveCards
 {
 ParseContext::ParseContext() :
@@ -152,12 +154,24 @@ void ParseContext::PushElement(const std::string& idJsonProperty, const Adaptive
             ErrorStatusCode::InvalidPropertyValue, "Attemping to push an element on to the stack with an invalid ID");
     }
 
+    if (m_recordIdOperations)
+    {
+        m_idOperations.emplace_back(std::in_place, idJsonProperty, internalId, isFallback);
+        return;
+    }
+
     m_idStack.push_back({idJsonProperty, internalId, isFallback});
 }
 
 // Pop the last id off our stack and perform validation (see comment above)
 void ParseContext::PopElement()
 {
+    if (m_recordIdOperations)
+    {
+        m_idOperations.emplace_back(std::nullopt);
+        return;
+    }
+
     // about to pop an element off the stack. perform collision list maintenance and detection.
     const auto& idsToPop = m_idStack.back();
     const std::string& elementId{std::get<TupleIndex::Id>(idsToPop)};
@@ -361,4 +375,124 @@ const std::string& ParseContext::GetLanguage() const
 {
     return m_language;
 }
+
+std::optional<size_t> ParseContext::GetMaxWarningCount() const
+{
+    return m_maxWarningCount;
+}
+
+void ParseContext::SetMaxWarningCount(size_t value)
+{
+    m_maxWarningCount = value;
+}
+
+void ParseContext::ConsolidateWarnings()
+{
+    std::set<std::pair<WarningStatusCode, std::string_view>> seenWarnings;
+    const auto duplicatesBegin = std::remove_if(warnings.begin(), warnings.end(), [&seenWarnings](const auto& warning) {
+        return warning && !seenWarnings.emplace(warning->GetStatusCode(), warning->GetReason()).second;
+    });
+    warnings.erase(duplicatesBegin, warnings.end());
+
+    if (m_maxWarningCount.has_value() && warnings.size() > m_maxWarningCount.value())
+    {
+        warnings.resize(m_maxWarningCount.value());
+    }
+}
+
+bool ParseContext::GetUseCardArena() const
+{
+    return m_useCardArena;
+}
+
+void ParseContext::SetUseCardArena(bool value)
+{
+    m_useCardArena = value;
+}
+
+void ParseContext::ReleaseCardArena()
+{
+    m_cardArena.reset();
+}
+
+unsigned int ParseContext::GetMaxParseThreads() const
+{
+    return m_maxParseThreads;
+}
+
+void ParseContext::SetMaxParseThreads(unsigned int value)
+{
+    m_maxParseThreads = std::max(value, 1u);
+}
+
+bool ParseContext::GetDeferNestedContent() const
+{
+    return m_deferNestedContent;
+}
+
+void ParseContext::SetDeferNestedContent(bool value)
+{
+    m_deferNestedContent = value;
+}
+
+ParseContext ParseContext::CreateSettingsCopy() const
+{
+    ParseContext copy(elementParserRegistration, actionParserRegistration);
+    copy.m_language = m_language;
+    copy.m_maxWarningCount = m_maxWarningCount;
+    copy.m_useCardArena = m_useCardArena;
+    copy.m_maxParseThreads = m_maxParseThreads;
+    copy.m_deferNestedContent = m_deferNestedContent;
+    return copy;
+}
+
+ParseContext ParseContext::CreateSubtreeContext() const
+{
+    ParseContext subtree(elementParserRegistration, actionParserRegistration);
+    subtree.m_parentalContainerStyles = m_parentalContainerStyles;
+    subtree.m_parentalPadding = m_parentalPadding;
+    subtree.m_parentalBleedDirection = m_parentalBleedDirection;
+    subtree.m_prohibitedElementTypes = m_prohibitedElementTypes;
+    subtree.m_canFallbackToAncestor = m_canFallbackToAncestor;
+    subtree.m_language = m_language;
+    subtree.m_useCardArena = m_useCardArena;
+    subtree.m_deferNestedContent = m_deferNestedContent;
+    subtree.m_sourceJson = m_sourceJson;
+    subtree.m_recordIdOperations = true;
+    return subtree;
+}
+
+void ParseContext::ReplayIdOperations(const ParseContext& subtree)
+{
+    for (const auto& operation : subtree.m_idOperations)
+    {
+        if (operation.has_value())
+        {
+            const auto& [id, internalId, isFallback] = operation.value();
+            PushElement(id, internalId, isFallback);
+        }
+        else
+        {
+            PopElement();
+        }
+    }
+}
+
+bool ParseContext::HasSameScope(const ParseContext& subtree) const
+{
+    return m_parentalContainerStyles == subtree.m_parentalContainerStyles && m_parentalPadding == subtree.m_parentalPadding &&
+           m_parentalBleedDirection == subtree.m_parentalBleedDirection &&
+           m_prohibitedElementTypes == subtree.m_prohibitedElementTypes &&
+           m_canFallbackToAncestor == subtree.m_canFallbackToAncestor && m_language == subtree.m_language;
+}
+
+void ParseContext::AdoptScope(const ParseContext& subtree)
+{
+    m_parentalContainerStyles = subtree.m_parentalContainerStyles;
+    m_parentalPadding = subtree.m_parentalPadding;
+    m_parentalBleedDirection = subtree.m_parentalBleedDirection;
+    m_prohibitedElementTypes = subtree.m_prohibitedElementTypes;
+    m_canFallbackToAncestor = subtree.m_canFallbackToAncestor;
+    m_language = subtree.m_language;
+}
 } // namespace AdaptiveCards
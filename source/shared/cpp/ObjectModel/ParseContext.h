@@ -8,10 +8,15 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "CardArena.h"
 
 namespace AdaptiveCards
 {
 class StyledCollectionElement;
+class ParallelBodyParser;
+class AdaptiveCard;
+template <typename T>
+class DeferredContent;
 class ParseContext
 {
 public:
@@ -20,7 +25,57 @@ public:
 
     std::shared_ptr<ElementParserRegistration> elementParserRegistration;
     std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+    // The warnings of a parse, including those of the cards of nested Action.ShowCard actions
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
+    // The most warnings a parse result keeps; unlimited unless set
+    std::optional<size_t> GetMaxWarningCount() const;
+    void SetMaxWarningCount(size_t value);
+
+    // Drops warnings that repeat an earlier one with the same status code and reason, then keeps at most
+    // GetMaxWarningCount() of them. Called once a parse is done, before warnings are handed to its ParseResult.
+    void ConsolidateWarnings();
+
+    // When set, the nodes of each card parsed with this context (its elements, actions, choices, facts and so on) are
+    // allocated from a CardArena of that card's own, instead of one by one from the heap. The arena is freed in one go
+    // once the last node of the card is released. Off by default.
+    bool GetUseCardArena() const;
+    void SetUseCardArena(bool value);
+
+    // Creates a node of the card being parsed, from the card's arena if GetUseCardArena() is set
+    template <typename T, typename... Args>
+    std::shared_ptr<T> MakeShared(Args&&... args)
+    {
+        if (!m_useCardArena)
+        {
+            return std::make_shared<T>(std::forward<Args>(args)...);
+        }
+
+        if (!m_cardArena)
+        {
+            m_cardArena = std::make_shared<CardArena>();
+        }
+        return std::allocate_shared<T>(CardArenaAllocator<T>(m_cardArena), std::forward<Args>(args)...);
+    }
+
+    // Lets go of the arena of the card just parsed, so that the next card gets an arena of its own. Called once a
+    // parse is done.
+    void ReleaseCardArena();
+
+    // The most threads the top-level elements of a card's body are parsed on. 1, the default, parses them one after
+    // the other on the calling thread. Parsing on several threads gives the same card, warnings and errors, but the
+    // element and action parsers registered with this context must be safe to call concurrently.
+    unsigned int GetMaxParseThreads() const;
+    void SetMaxParseThreads(unsigned int value);
+
+    // When set, the card of each Action.ShowCard and the fallback content of each element and action are kept as json
+    // and only parsed the first time ShowCardAction::GetCard or BaseElement::GetFallbackContent asks for them (see
+    // DeferredContent). Their ids are still checked for collisions with the rest of the card as it's parsed, but any
+    // other error in them is thrown by the call that parses them, and their warnings are dropped. Only takes effect
+    // while just the built-in parsers are registered. Off by default.
+    bool GetDeferNestedContent() const;
+    void SetDeferNestedContent(bool value);
+
     // Push/PopElement are used during parsing to track the tree structure of a card.
     void PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback = false);
     void PopElement();
@@ -52,7 +107,27 @@ public:
     void RemoveProhibitedElementType(const std::vector<std::string>& list);
     void ShouldParse(const std::string& type);
 
+    // A context for parsing cards of their own with the same settings as this one: its parser registrations, language,
+    // GetMaxWarningCount(), GetUseCardArena(), GetMaxParseThreads() and GetDeferNestedContent(). None of the state of
+    // a parse in progress (warnings, ids seen so far, styles, prohibited types and so on) is copied.
+    ParseContext CreateSettingsCopy() const;
+
 private:
+    friend class ParallelBodyParser;
+    friend class AdaptiveCard;
+    template <typename T>
+    friend class DeferredContent;
+
+    // The context that some of the top-level body elements of a parallel parse are parsed with. It starts from this
+    // context's settings and state, and records its Push/PopElement calls instead of detecting ID collisions.
+    ParseContext CreateSubtreeContext() const;
+    // Replays the Push/PopElement calls subtree recorded, detecting ID collisions as if they'd been made on this context
+    void ReplayIdOperations(const ParseContext& subtree);
+    // Whether subtree ended up with the same state for later elements (styles, bleed, padding, prohibited types,
+    // fallback and language) as this context, and taking that state on when it didn't
+    bool HasSameScope(const ParseContext& subtree) const;
+    void AdoptScope(const ParseContext& subtree);
+
     const AdaptiveCards::InternalId GetNearestFallbackId(const AdaptiveCards::InternalId& skipId) const;
     // This enum is just a helper to keep track of the position of contents within the std::tuple used in
     // m_idStack below. We don't use enum class here because we don't want typed values for use in std::get
@@ -86,5 +161,16 @@ private:
 
     bool m_canFallbackToAncestor;
     std::string m_language;
+    std::optional<size_t> m_maxWarningCount;
+    bool m_useCardArena{false};
+    std::shared_ptr<CardArena> m_cardArena;
+    unsigned int m_maxParseThreads{1};
+    bool m_deferNestedContent{false};
+    // The json being parsed, when it's owned by the parse, for deferred content to point into instead of copying from
+    std::shared_ptr<const Json::Value> m_sourceJson;
+
+    // Set on subtree contexts, which record each PushElement as the pushed entry and each PopElement as std::nullopt
+    bool m_recordIdOperations{false};
+    std::vector<std::optional<std::tuple<std::string, AdaptiveCards::InternalId, bool>>> m_idOperations;
 };
 } // namespace AdaptiveCards
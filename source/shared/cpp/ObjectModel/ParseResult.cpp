@@ -8,7 +8,7 @@
 using namespace AdaptiveCards;
 
 ParseResult::ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings) :
-    m_adaptiveCard(adaptiveCard), m_warnings(warnings)
+    m_adaptiveCard(adaptiveCard), m_warnings(std::move(warnings))
 {
 }
 
@@ -17,7 +17,7 @@ std::shared_ptr<AdaptiveCard> ParseResult::GetAdaptiveCard() const
     return m_adaptiveCard;
 }
 
-std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ParseResult::GetWarnings() const
+const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& ParseResult::GetWarnings() const
 {
     return m_warnings;
 }
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseResultCache.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+namespace
+{
+// Rough size of a parsed card relative to the json it came from, measured over the samples in this repo (about 3.2x)
+constexpr size_t c_objectModelBytesPerJsonByte = 3;
+
+void CombineHash(size_t& hash, size_t value)
+{
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+CachedParseResult::CachedParseResult(
+    std::shared_ptr<const AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings) :
+    m_adaptiveCard(std::move(adaptiveCard)),
+    m_warnings(std::move(warnings))
+{
+}
+
+std::shared_ptr<const AdaptiveCard> CachedParseResult::GetAdaptiveCard() const
+{
+    return m_adaptiveCard;
+}
+
+const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& CachedParseResult::GetWarnings() const
+{
+    return m_warnings;
+}
+
+ParseResultCache::ParseResultCache(size_t memoryBudget) : m_memoryBudget(memoryBudget), m_memoryUsage(0)
+{
+}
+
+std::shared_ptr<CachedParseResult> ParseResultCache::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion)
+{
+    // Only the registrations of this context are ever used, and only for reading
+    static const ParseContext defaultContext;
+    return DeserializeFromString(jsonString, rendererVersion, defaultContext);
+}
+
+std::shared_ptr<CachedParseResult> ParseResultCache::DeserializeFromString(
+    const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context)
+{
+    const std::string& language = context.GetLanguage();
+    const std::uint64_t elementParserRevision = context.elementParserRegistration->GetRevision();
+    const std::uint64_t actionParserRevision = context.actionParserRegistration->GetRevision();
+
+    size_t hash = std::hash<std::string>{}(jsonString);
+    CombineHash(hash, std::hash<std::string>{}(rendererVersion));
+    CombineHash(hash, std::hash<std::string>{}(language));
+    CombineHash(hash, std::hash<std::uint64_t>{}(elementParserRevision));
+    CombineHash(hash, std::hash<std::uint64_t>{}(actionParserRevision));
+
+    if (auto cachedResult = Find(hash, jsonString, rendererVersion, language, elementParserRevision, actionParserRevision))
+    {
+        return cachedResult;
+    }
+
+    // Parse without holding the lock. If another thread parses the same card at the same time, both results are
+    // equivalent and whichever is inserted last wins.
+    ParseContext parseContext{context.elementParserRegistration, context.actionParserRegistration};
+    parseContext.SetLanguage(language);
+    const auto parseResult = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, parseContext);
+    auto result = std::make_shared<CachedParseResult>(parseResult->GetAdaptiveCard(), parseResult->GetWarnings());
+
+    const size_t cost = sizeof(CacheEntry) + jsonString.size() * (1 + c_objectModelBytesPerJsonByte) +
+        rendererVersion.size() + language.size();
+    if (cost <= m_memoryBudget)
+    {
+        Insert({hash, jsonString, rendererVersion, language, elementParserRevision, actionParserRevision, cost, result});
+    }
+
+    return result;
+}
+
+void ParseResultCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entriesByHash.clear();
+    m_entries.clear();
+    m_memoryUsage = 0;
+}
+
+size_t ParseResultCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t ParseResultCache::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_memoryUsage;
+}
+
+size_t ParseResultCache::GetMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+std::shared_ptr<CachedParseResult> ParseResultCache::Find(
+    size_t hash,
+    const std::string& jsonString,
+    const std::string& rendererVersion,
+    const std::string& language,
+    std::uint64_t elementParserRevision,
+    std::uint64_t actionParserRevision)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto entry = FindEntry(hash, jsonString, rendererVersion, language, elementParserRevision, actionParserRevision);
+    if (entry == m_entries.end())
+    {
+        return nullptr;
+    }
+
+    // mark as most recently used
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    return entry->result;
+}
+
+void ParseResultCache::Insert(CacheEntry&& entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // replace the equivalent entry inserted by a concurrent parse, if any
+    const auto existing = FindEntry(
+        entry.hash, entry.jsonString, entry.rendererVersion, entry.language, entry.elementParserRevision, entry.actionParserRevision);
+    if (existing != m_entries.end())
+    {
+        RemoveEntry(existing);
+    }
+
+    m_memoryUsage += entry.cost;
+    m_entries.push_front(std::move(entry));
+    m_entriesByHash.emplace(m_entries.front().hash, m_entries.begin());
+
+    while (m_memoryUsage > m_memoryBudget)
+    {
+        RemoveEntry(std::prev(m_entries.end()));
+    }
+}
+
+std::list<ParseResultCache::CacheEntry>::iterator ParseResultCache::FindEntry(
+    size_t hash,
+    const std::string& jsonString,
+    const std::string& rendererVersion,
+    const std::string& language,
+    std::uint64_t elementParserRevision,
+    std::uint64_t actionParserRevision)
+{
+    const auto candidates = m_entriesByHash.equal_range(hash);
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+    {
+        const auto entry = candidate->second;
+        if (entry->elementParserRevision == elementParserRevision && entry->actionParserRevision == actionParserRevision &&
+            entry->rendererVersion == rendererVersion && entry->language == language && entry->jsonString == jsonString)
+        {
+            return entry;
+        }
+    }
+
+    return m_entries.end();
+}
+
+void ParseResultCache::RemoveEntry(std::list<CacheEntry>::iterator entry)
+{
+    const auto candidates = m_entriesByHash.equal_range(entry->hash);
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+    {
+        if (candidate->second == entry)
+        {
+            m_entriesByHash.erase(candidate);
+            break;
+        }
+    }
+
+    m_memoryUsage -= entry->cost;
+    m_entries.erase(entry);
+}
+} // namespace AdaptiveCards
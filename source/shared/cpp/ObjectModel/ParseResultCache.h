@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "AdaptiveCardParseWarning.h"
+#include <list>
+#include <mutex>
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class ParseContext;
+
+// The result of parsing a card through ParseResultCache. The card is shared with every other caller that parsed the
+// same json under the same settings, so it's only handed out read-only.
+class CachedParseResult
+{
+public:
+    CachedParseResult(std::shared_ptr<const AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings);
+
+    std::shared_ptr<const AdaptiveCard> GetAdaptiveCard() const;
+    const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& GetWarnings() const;
+
+private:
+    std::shared_ptr<const AdaptiveCard> m_adaptiveCard;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+};
+
+// An opt-in cache for hosts that render the same card json many times. It parses a given json string once and
+// hands the resulting card out to everyone who asks for that json again.
+//
+// A parse result depends on more than the json text, so entries are keyed on everything that can change the
+// outcome: the json text, the renderer version, the language a card falls back to when it doesn't specify one, and
+// the revisions of the element and action parser registrations (see ElementParserRegistration::GetRevision).
+// Registering or removing a custom parser therefore never returns a card that was parsed with the old parsers.
+// Custom parsers are expected to produce the same element for the same json every time.
+//
+// The least recently used entries are evicted once the estimated memory held by the cache exceeds its budget. The
+// cache can be shared between threads.
+class ParseResultCache
+{
+public:
+    static constexpr size_t DefaultMemoryBudget = 16 * 1024 * 1024;
+
+    explicit ParseResultCache(size_t memoryBudget = DefaultMemoryBudget);
+
+    ParseResultCache(const ParseResultCache&) = delete;
+    ParseResultCache& operator=(const ParseResultCache&) = delete;
+
+    // Equivalent to AdaptiveCard::DeserializeFromString(jsonString, rendererVersion), but reuses the result of an
+    // earlier call with the same arguments when it's still cached
+    std::shared_ptr<CachedParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
+
+    // Parses with context's parser registrations and language. Every parse gets a fresh ParseContext of its own, so
+    // context itself is never modified and warnings are only reported through the result.
+    std::shared_ptr<CachedParseResult> DeserializeFromString(
+        const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context);
+
+    void Clear();
+
+    size_t GetEntryCount() const;
+    size_t GetMemoryUsage() const;
+    size_t GetMemoryBudget() const;
+
+private:
+    struct CacheEntry
+    {
+        size_t hash;
+        std::string jsonString;
+        std::string rendererVersion;
+        std::string language;
+        std::uint64_t elementParserRevision;
+        std::uint64_t actionParserRevision;
+        size_t cost;
+        std::shared_ptr<CachedParseResult> result;
+    };
+
+    std::shared_ptr<CachedParseResult> Find(
+        size_t hash,
+        const std::string& jsonString,
+        const std::string& rendererVersion,
+        const std::string& language,
+        std::uint64_t elementParserRevision,
+        std::uint64_t actionParserRevision);
+    void Insert(CacheEntry&& entry);
+
+    // These expect m_mutex to be held
+    std::list<CacheEntry>::iterator FindEntry(
+        size_t hash,
+        const std::string& jsonString,
+        const std::string& rendererVersion,
+        const std::string& language,
+        std::uint64_t elementParserRevision,
+        std::uint64_t actionParserRevision);
+    void RemoveEntry(std::list<CacheEntry>::iterator entry);
+
+    const size_t m_memoryBudget;
+    size_t m_memoryUsage;
+
+    // Entries in order of use, most recently used first. m_entriesByHash indexes them by the hash of their key.
+    std::list<CacheEntry> m_entries;
+    std::unordered_multimap<size_t, std::list<CacheEntry>::iterator> m_entriesByHash;
+
+    mutable std::mutex m_mutex;
+};
+} // namespace AdaptiveCards
@@ -5,33 +5,23 @@
 #include "AdaptiveCardParseException.h"
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
+#include "JsonWriter.h"
 #include "TextBlock.h"
 #include "Container.h"
 #include "ShowCardAction.h"
 
-namespace
-{
-Json::StreamWriterBuilder CreateJsonStreamWriter()
-{
-    Json::StreamWriterBuilder builder;
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-
-    return builder;
-}
-} // namespace
-
 namespace AdaptiveCards
 {
+// Produces the same text as a Json::StreamWriter with no indentation and no comments, followed by a newline
 std::string ParseUtil::JsonToString(const Json::Value& json)
 {
-    const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-
-    std::ostringstream outStream;
-    writer->write(json, &outStream);
-    outStream << std::endl;
-    return outStream.str();
+    std::string output;
+    {
+        JsonWriter writer(output);
+        writer.WriteValue(json);
+        writer.WriteRaw("\n");
+    }
+    return output;
 }
 
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -56,7 +46,7 @@ std::string ParseUtil::GetTypeAsString(const Json::Value& json)
         throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return json[typeKey].asString();
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -87,7 +77,7 @@ std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaK
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -126,7 +116,7 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -147,7 +137,7 @@ std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchema
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -189,7 +179,7 @@ bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool
 std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -208,7 +198,7 @@ std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, Adaptive
 unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         if (isRequired)
@@ -251,7 +241,7 @@ int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int de
 std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -270,7 +260,7 @@ std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCa
 std::optional<unsigned int> ParseUtil::GetOptionalUnsignedInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -289,7 +279,7 @@ std::optional<unsigned int> ParseUtil::GetOptionalUnsignedInt(const Json::Value&
 std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const auto& propertyValue = ExtractJsonValue(json, key);
     if (propertyValue.empty())
     {
         return std::nullopt;
@@ -336,14 +326,13 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
             ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(json[expectedKey]);
 }
 
-Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    const auto& elementArray = ExtractJsonValue(json, key);
 
     if (!elementArray.isNull() && !elementArray.isArray())
     {
@@ -364,7 +353,7 @@ Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey k
 
 std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+    const auto& jsonArray = ParseUtil::GetArray(json, key, isRequired);
     std::vector<std::string> strings;
 
     strings.reserve(jsonArray.size());
@@ -377,10 +366,10 @@ std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, Adap
     return strings;
 }
 
-Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
+Json::Value ParseUtil::GetJsonValueFromString(std::string_view jsonString)
 {
-    const thread_local Json::CharReaderBuilder readerBuilder;
-    std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
+    // A reader resets itself at the start of every parse, so each thread keeps one for all the json it parses
+    thread_local const std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
 
     Json::Value jsonValue;
     std::string errors;
@@ -394,23 +383,27 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     return jsonValue;
 }
 
-Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (isRequired && propertyValue.empty())
+    const Json::Value* propertyValue = json.find(propertyName.data(), propertyName.data() + propertyName.size());
+    if (propertyValue == nullptr)
+    {
+        propertyValue = &Json::Value::nullSingleton();
+    }
+
+    if (isRequired && propertyValue->empty())
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + propertyName + ".");
     }
-    return propertyValue;
+    return *propertyValue;
 }
 
 std::string ParseUtil::ToLowercase(std::string const& value)
 {
-    std::string new_value;
-    new_value.resize(value.size());
-    std::transform(value.begin(), value.end(), new_value.begin(), [](char c) { return std::tolower(c, std::locale()); });
+    std::string new_value{value};
+    std::transform(new_value.begin(), new_value.end(), new_value.begin(), AsciiToLower);
     return new_value;
 }
 
@@ -446,7 +439,7 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
 std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -471,7 +464,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
 std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const auto& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
     if (!selectAction.empty())
     {
@@ -513,7 +506,7 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
 
 std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    auto label = ParseUtil::ExtractJsonValue(json, key);
+    const auto& label = ParseUtil::ExtractJsonValue(json, key);
 
     if (!label.empty())
     {
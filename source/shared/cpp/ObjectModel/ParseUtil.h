@@ -52,14 +52,19 @@ namespace ParseUtil
 
     std::optional<double> GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key);
 
-    Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns a reference to the array mapped to key inside json (or to a null value if it's absent) without copying it
+    const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
-    Json::Value GetJsonValueFromString(const std::string& jsonString);
+    Json::Value GetJsonValueFromString(std::string_view jsonString);
 
-    Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns a reference to the value mapped to key inside jsonRoot (or to a null value if it's absent) without copying
+    // it. The reference is only valid for as long as jsonRoot is.
+    const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
+    // enumConverter maps a std::string_view to a std::optional<T> (see XxxTryFromString in EnumMagic.h). Strings that
+    // don't map to a value are treated as if the property was absent.
     template <typename T, typename Fn>
     std::optional<T> GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter);
 
@@ -92,6 +97,18 @@ namespace ParseUtil
         bool isRequired = false,
         const std::string& impliedType = std::string());
 
+    // Parses the item at currentIndex of an element collection holding elemSize items, appending it to elements.
+    // GetElementCollection calls this for every item in the collection's json array.
+    template <typename T>
+    void AddElementCollectionItem(
+        bool isTopToBottomContainer,
+        ParseContext& context,
+        const Json::Value& elementJson,
+        size_t currentIndex,
+        size_t elemSize,
+        const std::string& impliedType,
+        std::vector<std::shared_ptr<T>>& elements);
+
     template <typename T>
     std::vector<std::shared_ptr<T>> GetElementCollectionOfSingleType(
         ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, DeserializeFn<T>& deserializer, bool isRequired = false);
@@ -126,29 +143,22 @@ namespace ParseUtil
 template <typename T, typename Fn>
 std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter)
 {
-    std::string propertyValueStr = "";
-    try
+    const auto& propertyValue = ExtractJsonValue(json, key);
+    if (propertyValue.empty())
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto const& propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            return std::nullopt;
-        }
-
-        if (!propertyValue.isString())
-        {
-            throw AdaptiveCardParseException(
-                ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
-        }
-
-        propertyValueStr = propertyValue.asString();
-        return enumConverter(propertyValueStr);
+        return std::nullopt;
     }
-    catch (const std::out_of_range&)
+
+    if (!propertyValue.isString())
     {
-        return std::nullopt;
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
     }
+
+    // look the value up in place rather than copying it out into a std::string
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    propertyValue.getString(&begin, &end);
+    return enumConverter(std::string_view(begin, static_cast<size_t>(end - begin)));
 }
 
 template <typename T, typename Fn>
@@ -207,7 +217,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -241,7 +251,7 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     T result = defaultValue;
     try
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const auto& jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
         if (!jsonObject.empty())
         {
             result = deserializer(jsonObject, defaultValue);
@@ -271,7 +281,7 @@ template <typename T>
 std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -282,75 +292,92 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     const size_t elemSize = elementArray.size();
     elements.reserve(elemSize);
 
-    const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
-
     size_t currentIndex = 0;
-    for (auto& curJsonValue : elementArray)
+    for (const auto& elementJson : elementArray)
     {
-        ContainerBleedDirection currentBleedState = previousBleedState;
+        AddElementCollectionItem<T>(isTopToBottomContainer, context, elementJson, currentIndex, elemSize, impliedType, elements);
+        currentIndex++;
+    }
 
-        if (currentIndex != 0)
-        {
-            // In a top to bottom container (Container, Column) only the first item can bleed up, in a left
-            // to right container (ColumnSet) only the first item can bleed left. If we're not the first item,
-            // turn off the relevant bit.
-            currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedUp : ~ContainerBleedDirection::BleedLeft;
-        }
+    return elements;
+}
 
-        if (currentIndex != (elemSize - 1))
-        {
-            // In a top to bottom container (Container, Column) only the last item can bleed down, in a left
-            // to right container (ColumnSet) only the last item can bleed right. If we're not the last item,
-            // turn off the relevant bit.
-            currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedDown : ~ContainerBleedDirection::BleedRight;
-        }
+template <typename T>
+void ParseUtil::AddElementCollectionItem(
+    bool isTopToBottomContainer,
+    ParseContext& context,
+    const Json::Value& elementJson,
+    size_t currentIndex,
+    size_t elemSize,
+    const std::string& impliedType,
+    std::vector<std::shared_ptr<T>>& elements)
+{
+    ContainerBleedDirection currentBleedState = context.GetBleedDirection();
 
-        context.PushBleedDirection(currentBleedState);
+    if (currentIndex != 0)
+    {
+        // In a top to bottom container (Container, Column) only the first item can bleed up, in a left
+        // to right container (ColumnSet) only the first item can bleed left. If we're not the first item,
+        // turn off the relevant bit.
+        currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedUp : ~ContainerBleedDirection::BleedLeft;
+    }
 
-        // If all items in this collection have the same implied type (i.e. Columns), verify
-        // that if set it is set correctly and set it if it isn't
-        if (!impliedType.empty())
-        {
-            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
-            if (typeString.compare(impliedType) != 0)
-            {
-                throw AdaptiveCardParseException(
-                    ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
-            }
-
-            curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
-        }
+    if (currentIndex != (elemSize - 1))
+    {
+        // In a top to bottom container (Container, Column) only the last item can bleed down, in a left
+        // to right container (ColumnSet) only the last item can bleed right. If we're not the last item,
+        // turn off the relevant bit.
+        currentBleedState &= isTopToBottomContainer ? ~ContainerBleedDirection::BleedDown : ~ContainerBleedDirection::BleedRight;
+    }
 
-        std::shared_ptr<BaseElement> curElement;
+    context.PushBleedDirection(currentBleedState);
 
-        try
+    // If all items in this collection have the same implied type (i.e. Columns), verify
+    // that if set it is set correctly and set it if it isn't. Items are parsed in place, so only an item that's
+    // missing its type gets copied in order to fill it in.
+    const Json::Value* curJsonValue = &elementJson;
+    Json::Value typedJsonValue;
+    if (!impliedType.empty())
+    {
+        const std::string typeString = ParseUtil::GetString(elementJson, AdaptiveCardSchemaKey::Type, false);
+        if (typeString.empty())
         {
-            ParseJsonObject<T>(context, curJsonValue, curElement);
-
-            elements.push_back(std::static_pointer_cast<T>(curElement));
+            typedJsonValue = elementJson;
+            typedJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+            curJsonValue = &typedJsonValue;
         }
-        catch (const AdaptiveCardParseException& e)
+        else if (typeString.compare(impliedType) != 0)
         {
-            // If exception is thrown because of prohibited type, we log the exception
-            // as warning, and continue parsing
-            if (e.GetStatusCode() == ErrorStatusCode::ProhibitedType)
-            {
-                context.warnings.emplace_back(
-                    std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::ProhibitedTypeDetected, e.GetReason()));
-            }
-            else
-            {
-                // re-throw the exception to preserve the existing pattern for now
-                throw e;
-            }
+            throw AdaptiveCardParseException(
+                ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
         }
+    }
 
-        // restores the parent's bleed state
-        context.PopBleedDirection();
+    std::shared_ptr<BaseElement> curElement;
 
-        currentIndex++;
+    try
+    {
+        ParseJsonObject<T>(context, *curJsonValue, curElement);
+
+        elements.push_back(std::static_pointer_cast<T>(curElement));
+    }
+    catch (const AdaptiveCardParseException& e)
+    {
+        // If exception is thrown because of prohibited type, we log the exception
+        // as warning, and continue parsing
+        if (e.GetStatusCode() == ErrorStatusCode::ProhibitedType)
+        {
+            context.warnings.emplace_back(
+                std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::ProhibitedTypeDetected, e.GetReason()));
+        }
+        else
+        {
+            // re-throw the exception to preserve the existing pattern for now
+            throw e;
+        }
     }
 
-    return elements;
+    // restores the parent's bleed state
+    context.PopBleedDirection();
 }
 } // namespace AdaptiveCards
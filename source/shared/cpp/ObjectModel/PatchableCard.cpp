@@ -0,0 +1,887 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "PatchableCard.h"
+#include "ActionSet.h"
+#include "Carousel.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "ParseUtil.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableRow.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+using JsonPointer = std::vector<std::string>;
+
+// Splits an RFC 6901 pointer into its unescaped reference tokens
+JsonPointer ParseJsonPointer(const std::string& pointer)
+{
+    JsonPointer tokens;
+    if (pointer.empty())
+    {
+        return tokens;
+    }
+
+    if (pointer[0] != '/')
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid JSON pointer: " + pointer);
+    }
+
+    std::string token;
+    for (size_t i = 1; i <= pointer.size(); ++i)
+    {
+        if (i == pointer.size() || pointer[i] == '/')
+        {
+            tokens.push_back(std::move(token));
+            token.clear();
+        }
+        else if (pointer[i] == '~')
+        {
+            if (i + 1 < pointer.size() && (pointer[i + 1] == '0' || pointer[i + 1] == '1'))
+            {
+                token += pointer[++i] == '0' ? '~' : '/';
+            }
+            else
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid JSON pointer: " + pointer);
+            }
+        }
+        else
+        {
+            token += pointer[i];
+        }
+    }
+    return tokens;
+}
+
+// The index token names in an array of size elements: digits without leading zeros, below size (or up to it when
+// allowEnd is set, which is also what "-" stands for)
+std::optional<Json::ArrayIndex> GetArrayIndex(const std::string& token, Json::ArrayIndex size, bool allowEnd)
+{
+    if (allowEnd && token == "-")
+    {
+        return size;
+    }
+
+    if (token.empty() || token.size() > 9 || (token.size() > 1 && token[0] == '0') ||
+        !std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        return std::nullopt;
+    }
+
+    const auto index = static_cast<Json::ArrayIndex>(std::stoul(token));
+    if (index < size || (allowEnd && index == size))
+    {
+        return index;
+    }
+    return std::nullopt;
+}
+
+std::string JoinJsonPointer(const JsonPointer& tokens, size_t count)
+{
+    std::string pointer;
+    for (size_t i = 0; i < count; ++i)
+    {
+        pointer += '/';
+        for (const char c : tokens[i])
+        {
+            pointer += c == '~' ? "~0" : c == '/' ? "~1" : std::string(1, c);
+        }
+    }
+    return pointer;
+}
+
+// The value the first count tokens of pointer address, or nullptr if there's none
+const Json::Value* FindValue(const Json::Value& json, const JsonPointer& pointer, size_t count)
+{
+    const Json::Value* current = &json;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (current->isObject())
+        {
+            current = current->find(pointer[i].data(), pointer[i].data() + pointer[i].size());
+        }
+        else if (current->isArray())
+        {
+            const auto index = GetArrayIndex(pointer[i], current->size(), false);
+            current = index ? &(*current)[*index] : nullptr;
+        }
+        else
+        {
+            current = nullptr;
+        }
+
+        if (!current)
+        {
+            return nullptr;
+        }
+    }
+    return current;
+}
+
+Json::Value& GetValue(Json::Value& json, const JsonPointer& pointer, size_t count)
+{
+    const Json::Value* value = FindValue(json, pointer, count);
+    if (!value)
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::InvalidPropertyValue, "JSON pointer doesn't address a value: " + JoinJsonPointer(pointer, count));
+    }
+    return const_cast<Json::Value&>(*value);
+}
+
+void AddValue(Json::Value& json, const JsonPointer& path, Json::Value value)
+{
+    if (path.empty())
+    {
+        json = std::move(value);
+        return;
+    }
+
+    Json::Value& parent = GetValue(json, path, path.size() - 1);
+    const std::string& name = path.back();
+    if (parent.isObject())
+    {
+        parent[name] = std::move(value);
+    }
+    else if (parent.isArray())
+    {
+        const auto index = GetArrayIndex(name, parent.size(), true);
+        if (!index)
+        {
+            throw AdaptiveCardParseException(
+                ErrorStatusCode::InvalidPropertyValue, "Array index out of range: " + JoinJsonPointer(path, path.size()));
+        }
+
+        // Json::Value has no insert, so shift the items after index along by one
+        parent.append(Json::Value());
+        for (Json::ArrayIndex i = parent.size() - 1; i > *index; --i)
+        {
+            parent[i].swap(parent[i - 1]);
+        }
+        parent[*index] = std::move(value);
+    }
+    else
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::InvalidPropertyValue, "Can't add a member to: " + JoinJsonPointer(path, path.size() - 1));
+    }
+}
+
+Json::Value RemoveValue(Json::Value& json, const JsonPointer& path)
+{
+    if (path.empty())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Can't remove the whole card");
+    }
+
+    Json::Value& parent = GetValue(json, path, path.size() - 1);
+    GetValue(json, path, path.size());
+
+    Json::Value removed;
+    if (parent.isObject())
+    {
+        parent.removeMember(path.back().data(), path.back().data() + path.back().size(), &removed);
+    }
+    else
+    {
+        parent.removeIndex(*GetArrayIndex(path.back(), parent.size(), false), &removed);
+    }
+    return removed;
+}
+
+const Json::Value& GetMember(const Json::Value& operation, const char* name)
+{
+    const Json::Value* member = operation.find(name, name + strlen(name));
+    if (!member)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, std::string("JSON Patch operation is missing ") + name);
+    }
+    return *member;
+}
+
+JsonPointer GetPointerMember(const Json::Value& operation, const char* name)
+{
+    const Json::Value& pointer = GetMember(operation, name);
+    if (!pointer.isString())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, std::string("JSON Patch ") + name + " must be a string");
+    }
+    return ParseJsonPointer(pointer.asString());
+}
+
+struct PatchOperation
+{
+    std::string op;
+    JsonPointer path;
+    JsonPointer from;
+    const Json::Value* value;
+};
+
+// Checks that patch is a well-formed JSON Patch and splits up its operations, without applying any of them
+std::vector<PatchOperation> ParseJsonPatch(const Json::Value& patch)
+{
+    if (!patch.isArray())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "A JSON Patch must be an array of operations");
+    }
+
+    std::vector<PatchOperation> operations;
+    for (const auto& operation : patch)
+    {
+        if (!operation.isObject())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "A JSON Patch operation must be an object");
+        }
+
+        const Json::Value& op = GetMember(operation, "op");
+        PatchOperation parsed{op.isString() ? op.asString() : std::string(), GetPointerMember(operation, "path"), {}, nullptr};
+        if (parsed.op == "add" || parsed.op == "replace" || parsed.op == "test")
+        {
+            parsed.value = &GetMember(operation, "value");
+        }
+        else if (parsed.op == "move" || parsed.op == "copy")
+        {
+            parsed.from = GetPointerMember(operation, "from");
+        }
+        else if (parsed.op != "remove")
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Unknown JSON Patch operation: " + parsed.op);
+        }
+        operations.push_back(std::move(parsed));
+    }
+    return operations;
+}
+
+// The pointers to the values whose contents operations change: the parent of whatever is added or removed, and what
+// is replaced. These are pointers into the json as it was before the patch; any operation that moves the items of an
+// array along addresses a card, container or action set, and that has the whole card parsed again anyway.
+std::vector<JsonPointer> GetChangedValues(const std::vector<PatchOperation>& operations)
+{
+    const auto parentOf = [](JsonPointer pointer) {
+        if (!pointer.empty())
+        {
+            pointer.pop_back();
+        }
+        return pointer;
+    };
+
+    std::vector<JsonPointer> changed;
+    for (const auto& operation : operations)
+    {
+        if (operation.op == "replace")
+        {
+            changed.push_back(operation.path);
+        }
+        else if (operation.op != "test")
+        {
+            changed.push_back(parentOf(operation.path));
+            if (operation.op == "move")
+            {
+                changed.push_back(parentOf(operation.from));
+            }
+        }
+    }
+    return changed;
+}
+
+// A value of the json as it was before an operation changed it
+struct JsonSnapshot
+{
+    JsonPointer pointer;
+    Json::Value value;
+};
+
+void TakeSnapshot(Json::Value& json, JsonPointer pointer, std::vector<JsonSnapshot>& snapshots)
+{
+    Json::Value value = GetValue(json, pointer, pointer.size());
+    snapshots.push_back({std::move(pointer), std::move(value)});
+}
+
+// Undoes the operations snapshots were taken for, last first
+void RestoreSnapshots(Json::Value& json, std::vector<JsonSnapshot>& snapshots)
+{
+    for (auto snapshot = snapshots.rbegin(); snapshot != snapshots.rend(); ++snapshot)
+    {
+        GetValue(json, snapshot->pointer, snapshot->pointer.size()).swap(snapshot->value);
+    }
+    snapshots.clear();
+}
+
+// Applies operations to json in place, taking a snapshot of each value before it changes. Copying only the values
+// that change keeps a patch cheap, where copying the whole json would cost about as much as a parse.
+void ApplyJsonPatch(Json::Value& json, const std::vector<PatchOperation>& operations, std::vector<JsonSnapshot>& snapshots)
+{
+    const auto add = [&](const JsonPointer& path, Json::Value value) {
+        TakeSnapshot(json, JsonPointer(path.begin(), path.end() - (path.empty() ? 0 : 1)), snapshots);
+        AddValue(json, path, std::move(value));
+    };
+    const auto remove = [&](const JsonPointer& path) {
+        TakeSnapshot(json, JsonPointer(path.begin(), path.end() - (path.empty() ? 0 : 1)), snapshots);
+        return RemoveValue(json, path);
+    };
+
+    for (const auto& operation : operations)
+    {
+        const JsonPointer& path = operation.path;
+        if (operation.op == "add")
+        {
+            add(path, *operation.value);
+        }
+        else if (operation.op == "remove")
+        {
+            remove(path);
+        }
+        else if (operation.op == "replace")
+        {
+            TakeSnapshot(json, path, snapshots);
+            GetValue(json, path, path.size()) = *operation.value;
+        }
+        else if (operation.op == "move")
+        {
+            const JsonPointer& from = operation.from;
+            if (from.size() < path.size() && std::equal(from.begin(), from.end(), path.begin()))
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Can't move a value into itself");
+            }
+            add(path, remove(from));
+        }
+        else if (operation.op == "copy")
+        {
+            add(path, GetValue(json, operation.from, operation.from.size()));
+        }
+        else if (GetValue(json, path, path.size()) != *operation.value)
+        {
+            throw AdaptiveCardParseException(
+                ErrorStatusCode::InvalidPropertyValue, "JSON Patch test failed: " + JoinJsonPointer(path, path.size()));
+        }
+    }
+}
+
+// An element or action of the card that a pointer leads into
+struct PatchTarget
+{
+    // The number of tokens of the pointer that address the element's json
+    size_t depth;
+    // The element, unless it's an action
+    std::shared_ptr<BaseCardElement> cardElement;
+    // The card's slot for the element or action, unless it's one of a collection of a more specific type (such as the
+    // columns of a column set), which is never parsed on its own
+    std::shared_ptr<BaseCardElement>* element;
+    std::shared_ptr<BaseActionElement>* action;
+    // The card and the cards of Action.ShowCard actions that the element or action is in
+    std::vector<AdaptiveCard*> cards;
+};
+
+// Steps from a collection of elements into the item indexToken names, making sure the collection still matches the
+// json it was parsed from (fallback content or dropped elements would make indices point at the wrong item)
+template <typename T>
+std::shared_ptr<T>* StepIntoItem(std::vector<std::shared_ptr<T>>& items, const Json::Value& itemsJson, const std::string& indexToken, const Json::Value*& itemJson)
+{
+    if (!itemsJson.isArray() || itemsJson.size() != items.size())
+    {
+        return nullptr;
+    }
+
+    const auto index = GetArrayIndex(indexToken, itemsJson.size(), false);
+    if (!index || !items[*index] || !itemsJson[*index].isObject())
+    {
+        return nullptr;
+    }
+
+    const Json::Value& type = itemsJson[*index]["type"];
+    if (type.isString() && type.asString() != items[*index]->GetElementTypeString())
+    {
+        return nullptr;
+    }
+
+    itemJson = &itemsJson[*index];
+    return &items[*index];
+}
+
+// Finds the innermost element or action of card whose json contains the value pointer addresses. Returns nullopt
+// when that is the card itself (or a card of an Action.ShowCard), when it's inside a carousel, or when the card
+// doesn't match cardJson closely enough to tell.
+std::optional<PatchTarget> FindPatchTarget(AdaptiveCard& card, const Json::Value& cardJson, const JsonPointer& pointer)
+{
+    AdaptiveCard* currentCard = &card;
+    const Json::Value* json = &cardJson;
+    PatchTarget target{0, nullptr, nullptr, nullptr, {&card}};
+
+    const auto stepIntoElement = [&](auto& items) {
+        auto slot = StepIntoItem(items, (*json)[pointer[target.depth]], pointer[target.depth + 1], json);
+        if (!slot)
+        {
+            return false;
+        }
+
+        target.cardElement = *slot;
+        if constexpr (std::is_same_v<std::decay_t<decltype(*slot)>, std::shared_ptr<BaseCardElement>>)
+        {
+            target.element = slot;
+        }
+        else
+        {
+            target.element = nullptr;
+        }
+        target.action = nullptr;
+        target.depth += 2;
+        return true;
+    };
+    const auto stepIntoAction = [&](std::vector<std::shared_ptr<BaseActionElement>>& items) {
+        auto slot = StepIntoItem(items, (*json)[pointer[target.depth]], pointer[target.depth + 1], json);
+        if (!slot)
+        {
+            return false;
+        }
+
+        target.cardElement = nullptr;
+        target.element = nullptr;
+        target.action = slot;
+        target.depth += 2;
+        return true;
+    };
+
+    while (target.depth < pointer.size())
+    {
+        const std::string& name = pointer[target.depth];
+        const bool hasIndex = target.depth + 1 < pointer.size();
+
+        if (currentCard)
+        {
+            if (!hasIndex || !(name == "body" ? stepIntoElement(currentCard->GetBody())
+                                              : name == "actions" && stepIntoAction(currentCard->GetActions())))
+            {
+                return std::nullopt;
+            }
+            currentCard = nullptr;
+        }
+        else if (!target.cardElement)
+        {
+            const auto showCard = std::dynamic_pointer_cast<ShowCardAction>(*target.action);
+            if (!showCard || name != "card" || !showCard->GetCard() || !(*json)["card"].isObject())
+            {
+                break;
+            }
+
+            currentCard = showCard->GetCard().get();
+            target.cards.push_back(currentCard);
+            json = &(*json)["card"];
+            target.action = nullptr;
+            target.depth += 1;
+        }
+        else
+        {
+            const auto& element = target.cardElement;
+            std::shared_ptr<Container> container;
+            std::shared_ptr<Column> column;
+            std::shared_ptr<ColumnSet> columnSet;
+            std::shared_ptr<Table> table;
+            std::shared_ptr<TableRow> tableRow;
+            std::shared_ptr<ActionSet> actionSet;
+
+            if (std::dynamic_pointer_cast<Carousel>(element))
+            {
+                return std::nullopt;
+            }
+
+            // Each of these steps either moves into a child or returns, so that a failed step is never taken for
+            // having reached the innermost element
+            if (!hasIndex)
+            {
+                break;
+            }
+            else if (name == "items" && (container = std::dynamic_pointer_cast<Container>(element)))
+            {
+                if (!stepIntoElement(container->GetItems()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else if (name == "items" && (column = std::dynamic_pointer_cast<Column>(element)))
+            {
+                if (!stepIntoElement(column->GetItems()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else if (name == "columns" && (columnSet = std::dynamic_pointer_cast<ColumnSet>(element)))
+            {
+                if (!stepIntoElement(columnSet->GetColumns()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else if (name == "rows" && (table = std::dynamic_pointer_cast<Table>(element)))
+            {
+                if (!stepIntoElement(table->GetRows()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else if (name == "cells" && (tableRow = std::dynamic_pointer_cast<TableRow>(element)))
+            {
+                if (!stepIntoElement(tableRow->GetCells()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else if (name == "actions" && (actionSet = std::dynamic_pointer_cast<ActionSet>(element)))
+            {
+                if (!stepIntoAction(actionSet->GetActions()))
+                {
+                    return std::nullopt;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    if (currentCard)
+    {
+        return std::nullopt;
+    }
+    return target;
+}
+
+// Whether json has any of the keys or types that tie the parse of an element to the rest of the card
+bool IsSelfContained(const Json::Value& json)
+{
+    if (json.isObject())
+    {
+        if (json.isMember("fallback") || json.isMember("requires"))
+        {
+            return false;
+        }
+
+        const Json::Value& type = json["type"];
+        if (type.isString() && type.asString() == ActionTypeToString(ActionType::ShowCard))
+        {
+            return false;
+        }
+    }
+
+    if (json.isObject() || json.isArray())
+    {
+        for (const auto& child : json)
+        {
+            if (!IsSelfContained(child))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Gathers the ids and types of json and everything in it
+void CollectIdsAndTypes(const Json::Value& json, std::vector<std::string>& ids, std::unordered_set<std::string>& types)
+{
+    if (json.isObject())
+    {
+        const Json::Value& id = json["id"];
+        if (id.isString())
+        {
+            ids.push_back(id.asString());
+        }
+
+        const Json::Value& type = json["type"];
+        if (type.isString())
+        {
+            types.insert(type.asString());
+        }
+    }
+
+    if (json.isObject() || json.isArray())
+    {
+        for (const auto& child : json)
+        {
+            CollectIdsAndTypes(child, ids, types);
+        }
+    }
+}
+
+bool CanParseAlone(const BaseCardElement& element)
+{
+    switch (element.GetElementType())
+    {
+    case CardElementType::TextBlock:
+    case CardElementType::RichTextBlock:
+    case CardElementType::Image:
+    case CardElementType::Media:
+    case CardElementType::FactSet:
+    case CardElementType::TextInput:
+    case CardElementType::NumberInput:
+    case CardElementType::DateInput:
+    case CardElementType::TimeInput:
+    case CardElementType::ToggleInput:
+    case CardElementType::ChoiceSetInput:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool CanParseAlone(const BaseActionElement& action)
+{
+    switch (action.GetElementType())
+    {
+    case ActionType::Execute:
+    case ActionType::OpenUrl:
+    case ActionType::Submit:
+    case ActionType::ToggleVisibility:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// The language the card gave element while it was parsed, as far as element kept it
+std::optional<std::string> GetParsedLanguage(const BaseElement& element)
+{
+    if (const auto textBlock = dynamic_cast<const TextBlock*>(&element))
+    {
+        return textBlock->GetLanguage();
+    }
+
+    if (const auto factSet = dynamic_cast<const FactSet*>(&element))
+    {
+        if (!factSet->GetFacts().empty())
+        {
+            return factSet->GetFacts().front()->GetLanguage();
+        }
+    }
+
+    if (const auto richTextBlock = dynamic_cast<const RichTextBlock*>(&element))
+    {
+        for (const auto& inlineElement : richTextBlock->GetInlines())
+        {
+            if (const auto textRun = std::dynamic_pointer_cast<TextRun>(inlineElement))
+            {
+                return textRun->GetLanguage();
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+PatchableCard::PatchableCard(const std::string& jsonString, std::string rendererVersion, const ParseContext& context) :
+    m_rendererVersion(std::move(rendererVersion)), m_context(context.CreateSettingsCopy())
+{
+    m_json = ParseUtil::GetJsonValueFromString(jsonString);
+    CardPatchResult result;
+    Reparse(result);
+}
+
+std::shared_ptr<AdaptiveCard> PatchableCard::GetAdaptiveCard() const
+{
+    return m_card;
+}
+
+const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& PatchableCard::GetWarnings() const
+{
+    return m_warnings;
+}
+
+const Json::Value& PatchableCard::GetJson() const
+{
+    return m_json;
+}
+
+CardPatchResult PatchableCard::Replace(const std::string& jsonPointer, const Json::Value& value)
+{
+    Json::Value operation;
+    operation["op"] = "replace";
+    operation["path"] = jsonPointer;
+    operation["value"] = value;
+
+    Json::Value patch(Json::arrayValue);
+    patch.append(std::move(operation));
+    return ApplyPatch(patch);
+}
+
+CardPatchResult PatchableCard::ApplyPatch(const Json::Value& patch)
+{
+    const auto operations = ParseJsonPatch(patch);
+
+    // Find the elements the patch changes while the card still matches its json
+    struct Replacement
+    {
+        PatchTarget target;
+        JsonPointer pointer;
+        Json::Value type;
+        std::vector<std::string> ids;
+        std::unordered_set<std::string> types;
+        std::shared_ptr<BaseElement> element;
+    };
+    std::vector<Replacement> replacements;
+    bool parseCard = false;
+
+    for (const auto& pointer : GetChangedValues(operations))
+    {
+        const auto target = FindPatchTarget(*m_card, m_json, pointer);
+        if (!target || (!target->element && !target->action))
+        {
+            parseCard = true;
+            break;
+        }
+
+        if (std::any_of(replacements.begin(), replacements.end(), [&](const Replacement& replacement) {
+                return replacement.target.element == target->element && replacement.target.action == target->action;
+            }))
+        {
+            continue;
+        }
+
+        const Json::Value& json = *FindValue(m_json, pointer, target->depth);
+        const bool canParseAlone = target->element ? CanParseAlone(**target->element) : CanParseAlone(**target->action);
+        if (!canParseAlone || !IsSelfContained(json))
+        {
+            parseCard = true;
+            break;
+        }
+
+        Replacement replacement{*target, JsonPointer(pointer.begin(), pointer.begin() + target->depth), json["type"], {}, {}, nullptr};
+        CollectIdsAndTypes(json, replacement.ids, replacement.types);
+        std::sort(replacement.ids.begin(), replacement.ids.end());
+        replacements.push_back(std::move(replacement));
+    }
+
+    // Parses each changed element again on its own, or returns false if that might not give what a full parse would
+    const auto parseReplacements = [&](CardPatchResult& result) {
+        for (auto& replacement : replacements)
+        {
+            const Json::Value* json = FindValue(m_json, replacement.pointer, replacement.pointer.size());
+            if (!json || !json->isObject() || (*json)["type"] != replacement.type || !IsSelfContained(*json))
+            {
+                return false;
+            }
+
+            std::vector<std::string> ids;
+            CollectIdsAndTypes(*json, ids, replacement.types);
+            std::sort(ids.begin(), ids.end());
+            if (ids != replacement.ids)
+            {
+                return false;
+            }
+
+            const BaseElement& oldElement = replacement.target.element
+                ? static_cast<const BaseElement&>(**replacement.target.element)
+                : static_cast<const BaseElement&>(**replacement.target.action);
+            ParseContext context(m_context);
+            context.SetCanFallbackToAncestor(oldElement.CanFallbackToAncestor());
+
+            // Text takes the language of the card it's in, so it has to be known to parse text on its own
+            if (replacement.types.count(CardElementTypeToString(CardElementType::TextBlock)) ||
+                replacement.types.count(CardElementTypeToString(CardElementType::RichTextBlock)) ||
+                replacement.types.count(CardElementTypeToString(CardElementType::FactSet)))
+            {
+                const auto language = GetParsedLanguage(oldElement);
+                if (!language)
+                {
+                    return false;
+                }
+                context.SetLanguage(*language);
+            }
+
+            if (replacement.target.element)
+            {
+                std::vector<std::shared_ptr<BaseCardElement>> elements;
+                ParseUtil::AddElementCollectionItem<BaseCardElement>(true, context, *json, 0, 1, "", elements);
+                if (elements.size() == 1)
+                {
+                    replacement.element = elements.front();
+                }
+            }
+            else
+            {
+                replacement.element = ParseUtil::GetActionFromJsonValue(context, *json);
+            }
+
+            if (!replacement.element)
+            {
+                return false;
+            }
+
+            context.ConsolidateWarnings();
+            context.ReleaseCardArena();
+            result.warnings.insert(result.warnings.end(), context.warnings.begin(), context.warnings.end());
+        }
+        return true;
+    };
+
+    // The patch is applied in place, and undone if it or the parse of its result fails
+    std::vector<JsonSnapshot> snapshots;
+    try
+    {
+        ApplyJsonPatch(m_json, operations, snapshots);
+
+        CardPatchResult result{false, {}, {}};
+        if (parseCard || !parseReplacements(result))
+        {
+            Reparse(result);
+            return result;
+        }
+
+        for (const auto& replacement : replacements)
+        {
+            if (replacement.target.element)
+            {
+                result.patchedElements.push_back({(*replacement.target.element)->GetInternalId(), replacement.element});
+                *replacement.target.element = std::static_pointer_cast<BaseCardElement>(replacement.element);
+            }
+            else
+            {
+                result.patchedElements.push_back({(*replacement.target.action)->GetInternalId(), replacement.element});
+                *replacement.target.action = std::static_pointer_cast<BaseActionElement>(replacement.element);
+            }
+
+            // the indices of the cards the element was swapped into still hold the element it replaced
+            for (AdaptiveCard* card : replacement.target.cards)
+            {
+                card->ResetElementIndex();
+            }
+        }
+        return result;
+    }
+    catch (...)
+    {
+        RestoreSnapshots(m_json, snapshots);
+        throw;
+    }
+}
+
+// Parses m_json as a whole, leaving the card as it was if that fails
+void PatchableCard::Reparse(CardPatchResult& result)
+{
+    ParseContext context(m_context);
+    const auto parseResult = AdaptiveCard::Deserialize(m_json, m_rendererVersion, context);
+
+    m_card = parseResult->GetAdaptiveCard();
+    m_warnings = parseResult->GetWarnings();
+
+    result.reparsedCard = true;
+    result.patchedElements.clear();
+    result.warnings = m_warnings;
+}
+} // namespace AdaptiveCards
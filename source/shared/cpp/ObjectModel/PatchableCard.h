@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "AdaptiveCardParseWarning.h"
+#include "InternalId.h"
+#include "ParseContext.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseElement;
+
+// An element or action that a patch replaced with a newly parsed one
+struct PatchedElement
+{
+    // The internal id of the element the card had before the patch, which is what a renderer knows it by
+    InternalId previousInternalId;
+    std::shared_ptr<BaseElement> element;
+};
+
+struct CardPatchResult
+{
+    // Set when the patch couldn't be applied to parts of the card alone, so the whole card was parsed again and
+    // GetAdaptiveCard() returns a new card. Every element should be considered changed then, and patchedElements is
+    // empty.
+    bool reparsedCard;
+    // Otherwise, the elements and actions that were parsed again, in place in the same card
+    std::vector<PatchedElement> patchedElements;
+    // The warnings of whatever was parsed again
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+};
+
+// A parsed card that keeps its json, so that it can be updated with a JSON Patch (RFC 6902) instead of being parsed
+// again from scratch. Hosts whose cards change in small ways between updates, such as a fact's value or an action's
+// isEnabled, re-parse and re-render only the elements a patch touches.
+//
+// An element is parsed on its own when the patch only changes properties within it, and when parsing it can't
+// depend on or affect anything outside of it: a built-in element or action that doesn't contain containers, cards,
+// fallback content or requirements, keeps its type and keeps the same ids. Everything else, such as adding or
+// removing elements of a container, is handled by parsing the whole patched card again, so the result is always the
+// card a full parse of the patched json gives.
+class PatchableCard
+{
+public:
+    // Parses jsonString with the parser registrations and settings of context (see ParseContext::CreateSettingsCopy);
+    // throws as AdaptiveCard::DeserializeFromString does
+    PatchableCard(const std::string& jsonString, std::string rendererVersion, const ParseContext& context = ParseContext());
+
+    std::shared_ptr<AdaptiveCard> GetAdaptiveCard() const;
+    // The warnings of the last full parse
+    const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& GetWarnings() const;
+    const Json::Value& GetJson() const;
+
+    // Applies patch, an array of JSON Patch operations, to the card's json and updates the card. Throws an
+    // AdaptiveCardParseException if the patch is malformed, can't be applied, or gives json that doesn't parse; the
+    // card and its json are left as they were then.
+    CardPatchResult ApplyPatch(const Json::Value& patch);
+    // Replaces the value jsonPointer (RFC 6901) addresses with value
+    CardPatchResult Replace(const std::string& jsonPointer, const Json::Value& value);
+
+private:
+    void Reparse(CardPatchResult& result);
+
+    std::string m_rendererVersion;
+    // Holds the registrations and settings of every parse, and none of the state of a parse
+    ParseContext m_context;
+    Json::Value m_json;
+    std::shared_ptr<AdaptiveCard> m_card;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+};
+} // namespace AdaptiveCards
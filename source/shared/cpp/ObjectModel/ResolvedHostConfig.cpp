@@ -0,0 +1,208 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ResolvedHostConfig.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// Enum values out of range, which only bindings can produce, get the value HostConfig falls back to for them
+template <size_t Count, typename T>
+constexpr size_t ToIndex(T value, T fallback)
+{
+    const auto index = static_cast<size_t>(value);
+    return (index < Count) ? index : static_cast<size_t>(fallback);
+}
+
+unsigned int GetSpacingFromConfig(const SpacingConfig& spacingConfig, Spacing spacing)
+{
+    switch (spacing)
+    {
+    case Spacing::Small:
+        return spacingConfig.smallSpacing;
+    case Spacing::Default:
+        return spacingConfig.defaultSpacing;
+    case Spacing::Medium:
+        return spacingConfig.mediumSpacing;
+    case Spacing::Large:
+        return spacingConfig.largeSpacing;
+    case Spacing::ExtraLarge:
+        return spacingConfig.extraLargeSpacing;
+    case Spacing::Padding:
+        return spacingConfig.paddingSpacing;
+    case Spacing::None:
+    default:
+        return 0;
+    }
+}
+} // namespace
+
+ResolvedHostConfig::ResolvedHostConfig(const HostConfig& hostConfig) : m_hostConfig(hostConfig)
+{
+    for (size_t styleIndex = 0; styleIndex < ContainerStyleCount; ++styleIndex)
+    {
+        const auto style = static_cast<ContainerStyle>(styleIndex);
+        m_backgroundColors[styleIndex] = m_hostConfig.GetBackgroundColor(style);
+        m_borderColors[styleIndex] = m_hostConfig.GetBorderColor(style);
+        m_borderThicknesses[styleIndex] = m_hostConfig.GetBorderThickness(style);
+
+        for (size_t colorIndex = 0; colorIndex < ForegroundColorCount; ++colorIndex)
+        {
+            const auto color = static_cast<ForegroundColor>(colorIndex);
+            for (const bool isSubtle : {false, true})
+            {
+                const size_t index = GetColorIndex(style, color, isSubtle);
+                m_foregroundColors[index] = m_hostConfig.GetForegroundColor(style, color, isSubtle);
+                m_highlightColors[index] = m_hostConfig.GetHighlightColor(style, color, isSubtle);
+            }
+        }
+    }
+
+    for (size_t fontTypeIndex = 0; fontTypeIndex < FontTypeCount; ++fontTypeIndex)
+    {
+        const auto fontType = static_cast<FontType>(fontTypeIndex);
+        m_fontFamilies[fontTypeIndex] = m_hostConfig.GetFontFamily(fontType);
+
+        for (size_t sizeIndex = 0; sizeIndex < TextSizeCount; ++sizeIndex)
+        {
+            m_fontSizes[fontTypeIndex * TextSizeCount + sizeIndex] =
+                m_hostConfig.GetFontSize(fontType, static_cast<TextSize>(sizeIndex));
+        }
+
+        for (size_t weightIndex = 0; weightIndex < TextWeightCount; ++weightIndex)
+        {
+            m_fontWeights[fontTypeIndex * TextWeightCount + weightIndex] =
+                m_hostConfig.GetFontWeight(fontType, static_cast<TextWeight>(weightIndex));
+        }
+    }
+
+    for (size_t spacingIndex = 0; spacingIndex < SpacingCount; ++spacingIndex)
+    {
+        m_spacings[spacingIndex] = GetSpacingFromConfig(m_hostConfig._spacing, static_cast<Spacing>(spacingIndex));
+    }
+}
+
+size_t ResolvedHostConfig::GetColorIndex(ContainerStyle style, ForegroundColor color, bool isSubtle)
+{
+    const size_t styleIndex = ToIndex<ContainerStyleCount>(style, ContainerStyle::Default);
+    const size_t colorIndex = ToIndex<ForegroundColorCount>(color, ForegroundColor::Default);
+    return (styleIndex * ForegroundColorCount + colorIndex) * 2 + (isSubtle ? 1 : 0);
+}
+
+const std::string& ResolvedHostConfig::GetBackgroundColor(ContainerStyle style) const
+{
+    return m_backgroundColors[ToIndex<ContainerStyleCount>(style, ContainerStyle::Default)];
+}
+
+const std::string& ResolvedHostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return m_foregroundColors[GetColorIndex(style, color, isSubtle)];
+}
+
+const std::string& ResolvedHostConfig::GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    return m_highlightColors[GetColorIndex(style, color, isSubtle)];
+}
+
+const std::string& ResolvedHostConfig::GetBorderColor(ContainerStyle style) const
+{
+    return m_borderColors[ToIndex<ContainerStyleCount>(style, ContainerStyle::Default)];
+}
+
+unsigned int ResolvedHostConfig::GetBorderThickness(ContainerStyle style) const
+{
+    return m_borderThicknesses[ToIndex<ContainerStyleCount>(style, ContainerStyle::Default)];
+}
+
+const std::string& ResolvedHostConfig::GetFontFamily(FontType fontType) const
+{
+    return m_fontFamilies[ToIndex<FontTypeCount>(fontType, FontType::Default)];
+}
+
+unsigned int ResolvedHostConfig::GetFontSize(FontType fontType, TextSize size) const
+{
+    return m_fontSizes[ToIndex<FontTypeCount>(fontType, FontType::Default) * TextSizeCount +
+                       ToIndex<TextSizeCount>(size, TextSize::Default)];
+}
+
+unsigned int ResolvedHostConfig::GetFontWeight(FontType fontType, TextWeight weight) const
+{
+    return m_fontWeights[ToIndex<FontTypeCount>(fontType, FontType::Default) * TextWeightCount +
+                         ToIndex<TextWeightCount>(weight, TextWeight::Default)];
+}
+
+unsigned int ResolvedHostConfig::GetSpacing(Spacing spacing) const
+{
+    return m_spacings[ToIndex<SpacingCount>(spacing, Spacing::None)];
+}
+
+const HostConfig& ResolvedHostConfig::GetHostConfig() const
+{
+    return m_hostConfig;
+}
+
+const SeparatorConfig& ResolvedHostConfig::GetSeparator() const
+{
+    return m_hostConfig._separator;
+}
+
+const SpacingConfig& ResolvedHostConfig::GetSpacing() const
+{
+    return m_hostConfig._spacing;
+}
+
+const ImageSizesConfig& ResolvedHostConfig::GetImageSizes() const
+{
+    return m_hostConfig._imageSizes;
+}
+
+const ImageConfig& ResolvedHostConfig::GetImage() const
+{
+    return m_hostConfig._image;
+}
+
+const ImageSetConfig& ResolvedHostConfig::GetImageSet() const
+{
+    return m_hostConfig._imageSet;
+}
+
+const FactSetConfig& ResolvedHostConfig::GetFactSet() const
+{
+    return m_hostConfig._factSet;
+}
+
+const ActionsConfig& ResolvedHostConfig::GetActions() const
+{
+    return m_hostConfig._actions;
+}
+
+const ContainerStylesDefinition& ResolvedHostConfig::GetContainerStyles() const
+{
+    return m_hostConfig._containerStyles;
+}
+
+const MediaConfig& ResolvedHostConfig::GetMedia() const
+{
+    return m_hostConfig._media;
+}
+
+const InputsConfig& ResolvedHostConfig::GetInputs() const
+{
+    return m_hostConfig._inputs;
+}
+
+const TextStylesConfig& ResolvedHostConfig::GetTextStyles() const
+{
+    return m_hostConfig._textStyles;
+}
+
+const TextBlockConfig& ResolvedHostConfig::GetTextBlock() const
+{
+    return m_hostConfig._textBlock;
+}
+
+const TableConfig& ResolvedHostConfig::GetTable() const
+{
+    return m_hostConfig._table;
+}
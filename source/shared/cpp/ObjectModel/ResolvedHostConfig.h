@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "HostConfig.h"
+
+namespace AdaptiveCards
+{
+// A read-only snapshot of a HostConfig for renderers, which look up colors, fonts and spacing for every element they
+// render. Every value HostConfig computes on lookup (palette and color selection, the font type and deprecated font
+// fallbacks) is resolved once on construction into flat tables, so lookups are an index into an array and never copy
+// or allocate. Changes to the HostConfig after construction are not reflected.
+class ResolvedHostConfig
+{
+public:
+    explicit ResolvedHostConfig(const HostConfig& hostConfig);
+
+    const std::string& GetBackgroundColor(ContainerStyle style) const;
+    const std::string& GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    const std::string& GetHighlightColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+    const std::string& GetBorderColor(ContainerStyle style) const;
+    unsigned int GetBorderThickness(ContainerStyle style) const;
+
+    const std::string& GetFontFamily(FontType fontType) const;
+    unsigned int GetFontSize(FontType fontType, TextSize size) const;
+    unsigned int GetFontWeight(FontType fontType, TextWeight weight) const;
+
+    unsigned int GetSpacing(Spacing spacing) const;
+
+    // The rest of the config, without the copies HostConfig's getters make
+    const HostConfig& GetHostConfig() const;
+    const SeparatorConfig& GetSeparator() const;
+    const SpacingConfig& GetSpacing() const;
+    const ImageSizesConfig& GetImageSizes() const;
+    const ImageConfig& GetImage() const;
+    const ImageSetConfig& GetImageSet() const;
+    const FactSetConfig& GetFactSet() const;
+    const ActionsConfig& GetActions() const;
+    const ContainerStylesDefinition& GetContainerStyles() const;
+    const MediaConfig& GetMedia() const;
+    const InputsConfig& GetInputs() const;
+    const TextStylesConfig& GetTextStyles() const;
+    const TextBlockConfig& GetTextBlock() const;
+    const TableConfig& GetTable() const;
+
+private:
+    static constexpr size_t ContainerStyleCount = static_cast<size_t>(ContainerStyle::Accent) + 1;
+    static constexpr size_t ForegroundColorCount = static_cast<size_t>(ForegroundColor::Attention) + 1;
+    static constexpr size_t FontTypeCount = static_cast<size_t>(FontType::Monospace) + 1;
+    static constexpr size_t TextSizeCount = static_cast<size_t>(TextSize::ExtraLarge) + 1;
+    static constexpr size_t TextWeightCount = static_cast<size_t>(TextWeight::Bolder) + 1;
+    static constexpr size_t SpacingCount = static_cast<size_t>(Spacing::Padding) + 1;
+    static constexpr size_t ColorCount = ContainerStyleCount * ForegroundColorCount * 2;
+
+    static size_t GetColorIndex(ContainerStyle style, ForegroundColor color, bool isSubtle);
+
+    const HostConfig m_hostConfig;
+
+    std::array<std::string, ContainerStyleCount> m_backgroundColors;
+    std::array<std::string, ContainerStyleCount> m_borderColors;
+    std::array<unsigned int, ContainerStyleCount> m_borderThicknesses;
+    std::array<std::string, ColorCount> m_foregroundColors;
+    std::array<std::string, ColorCount> m_highlightColors;
+
+    std::array<std::string, FontTypeCount> m_fontFamilies;
+    std::array<unsigned int, FontTypeCount * TextSizeCount> m_fontSizes;
+    std::array<unsigned int, FontTypeCount * TextWeightCount> m_fontWeights;
+
+    std::array<unsigned int, SpacingCount> m_spacings;
+};
+} // namespace AdaptiveCards
@@ -64,7 +64,7 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext&
 
     std::shared_ptr<RichTextBlock> richTextBlock = BaseCardElement::Deserialize<RichTextBlock>(context, json);
     richTextBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     auto inlines = ParseUtil::GetElementCollectionOfSingleType<Inline>(
         context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, false);
@@ -80,7 +80,9 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::Inlines});
+    m_knownProperties = &knownProperties;
 }
@@ -74,11 +74,9 @@ void RichTextElementProperties::Deserialize(ParseContext& context, const Json::V
     SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
 }
 
-void RichTextElementProperties::PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties)
+void RichTextElementProperties::PopulateKnownPropertiesSet(KnownPropertiesSet& knownProperties)
 {
     TextElementProperties::PopulateKnownPropertiesSet(knownProperties);
-    knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Italic),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Strikethrough),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Underline)});
+    AddKnownProperties(
+        knownProperties, {AdaptiveCardSchemaKey::Italic, AdaptiveCardSchemaKey::Strikethrough, AdaptiveCardSchemaKey::Underline});
 }
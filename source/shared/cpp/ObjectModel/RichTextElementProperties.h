@@ -28,7 +28,8 @@ public:
 
     Json::Value SerializeToJsonValue(Json::Value& root) const override;
     void Deserialize(ParseContext& context, const Json::Value& root) override;
-    void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties) override;
+    using TextElementProperties::PopulateKnownPropertiesSet;
+    void PopulateKnownPropertiesSet(KnownPropertiesSet& knownProperties) override;
 
 private:
     bool m_italic;
@@ -7,6 +7,22 @@
 using namespace AdaptiveCards;
 
 SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor(0), _build(0), _revision(0)
+{
+    const auto parsedVersion = TryParse(version);
+    if (!parsedVersion.has_value())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+    }
+
+    *this = parsedVersion.value();
+}
+
+SemanticVersion::SemanticVersion(unsigned int major, unsigned int minor, unsigned int build, unsigned int revision) :
+    _major(major), _minor(minor), _build(build), _revision(revision)
+{
+}
+
+std::optional<SemanticVersion> SemanticVersion::TryParse(const std::string& version) noexcept
 {
     // valid:
     // "1"
@@ -18,53 +34,41 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // ""
     // "1."
     // "F"
+    //
+    // each part is one or more decimal digits, and must fit in an int
+    std::array<unsigned int, 4> parts{};
+    size_t partCount = 0;
+    auto current = version.cbegin();
+    const auto end = version.cend();
 
-    bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    while (true)
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
-
-        try
+        if (partCount == parts.size() || current == end || *current < '0' || *current > '9')
         {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
-
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
-
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
+            return std::nullopt;
+        }
 
-            if (subMatches[4].matched)
+        unsigned int part = 0;
+        for (; current != end && *current >= '0' && *current <= '9'; ++current)
+        {
+            const unsigned int digit = *current - '0';
+            if (part > (static_cast<unsigned int>(std::numeric_limits<int>::max()) - digit) / 10)
             {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
+                return std::nullopt;
             }
+            part = part * 10 + digit;
         }
-        catch (const std::out_of_range&)
+        parts[partCount++] = part;
+
+        if (current == end)
         {
-            versionValid = false;
+            return SemanticVersion(parts[0], parts[1], parts[2], parts[3]);
         }
-    }
 
-    if (!versionValid)
-    {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+        if (*current != '.')
+        {
+            return std::nullopt;
+        }
+        ++current;
     }
 }
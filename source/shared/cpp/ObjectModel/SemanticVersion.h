@@ -9,7 +9,12 @@ namespace AdaptiveCards
 class SemanticVersion
 {
 public:
+    // Throws an AdaptiveCardParseException if version isn't valid
     SemanticVersion(const std::string& version);
+    SemanticVersion(unsigned int major, unsigned int minor, unsigned int build, unsigned int revision);
+
+    // Parses version without throwing, returning std::nullopt if it isn't valid
+    static std::optional<SemanticVersion> TryParse(const std::string& version) noexcept;
 
     unsigned int GetMajor() const
     {
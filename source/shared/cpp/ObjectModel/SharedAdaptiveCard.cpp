@@ -7,12 +7,122 @@
 #include "ShowCardAction.h"
 #include "TextBlock.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ParallelBodyParser.h"
 #include "SemanticVersion.h"
 #include "ParseContext.h"
 #include "BackgroundImage.h"
+#include "JsonTokenizer.h"
+#include "JsonWriter.h"
 
 using namespace AdaptiveCards;
 
+namespace
+{
+// Where the top level "body" array sits in the json text of a card, and where each of its items starts and ends
+struct BodyLayout
+{
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    std::vector<std::pair<const char*, const char*>> items;
+};
+
+bool TryFindBody(const char* jsonBegin, const char* jsonEnd, BodyLayout& body)
+{
+    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    JsonTokenizer tokenizer(jsonBegin, jsonEnd);
+    bool foundBody = false;
+
+    if (!tokenizer.TryConsume('{') || tokenizer.TryConsume('}'))
+    {
+        return false;
+    }
+
+    do
+    {
+        std::string_view name;
+        if (!tokenizer.ReadString(name) || !tokenizer.TryConsume(':'))
+        {
+            return false;
+        }
+
+        // A property name with escape sequences might decode to "body" too. jsoncpp decides which of several
+        // body properties wins, so leave such cards to the regular path.
+        if (name.find('\\') != std::string_view::npos)
+        {
+            return false;
+        }
+
+        if (name != bodyPropertyName)
+        {
+            if (!tokenizer.SkipValue())
+            {
+                return false;
+            }
+            continue;
+        }
+
+        if (foundBody || !tokenizer.SkipWhitespace())
+        {
+            return false;
+        }
+        foundBody = true;
+
+        body.begin = tokenizer.GetPosition();
+        if (!tokenizer.TryConsume('['))
+        {
+            // not an array, which the regular path reports
+            return false;
+        }
+
+        if (!tokenizer.TryConsume(']'))
+        {
+            do
+            {
+                if (!tokenizer.SkipWhitespace())
+                {
+                    return false;
+                }
+
+                const char* itemBegin = tokenizer.GetPosition();
+                if (!tokenizer.SkipValue())
+                {
+                    return false;
+                }
+                body.items.emplace_back(itemBegin, tokenizer.GetPosition());
+            } while (tokenizer.TryConsume(','));
+
+            if (!tokenizer.TryConsume(']'))
+            {
+                return false;
+            }
+        }
+        body.end = tokenizer.GetPosition();
+    } while (tokenizer.TryConsume(','));
+
+    return foundBody && tokenizer.TryConsume('}');
+}
+
+// Lets go of a context's card arena when a parse is done, including one that throws, so that the next card parsed with
+// the context doesn't carry on in the arena of the card that failed
+class CardArenaRelease
+{
+public:
+    explicit CardArenaRelease(ParseContext& context) : m_context(context)
+    {
+    }
+    CardArenaRelease(const CardArenaRelease&) = delete;
+    CardArenaRelease& operator=(const CardArenaRelease&) = delete;
+
+    ~CardArenaRelease()
+    {
+        m_context.ReleaseCardArena();
+    }
+
+private:
+    ParseContext& m_context;
+};
+} // namespace
+
 AdaptiveCard::AdaptiveCard() :
     AdaptiveCard("", "", std::shared_ptr<BackgroundImage>(), ContainerStyle::None, "", "", VerticalContentAlignment::Top, HeightType::Auto, 0)
 {
@@ -173,6 +283,30 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
 #else
 std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
+{
+    const CardArenaRelease cardArenaRelease(context);
+    return MakeParseResult(DeserializeCard(json, rendererVersion, context), context);
+}
+
+std::shared_ptr<ParseResult> AdaptiveCard::MakeParseResult(const std::shared_ptr<AdaptiveCard>& card, ParseContext& context)
+{
+    context.ConsolidateWarnings();
+    return std::make_shared<ParseResult>(card, context.warnings);
+}
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::DeserializeCard(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
+{
+    return DeserializeCard(json, rendererVersion, context, [&json](ParseContext& context) {
+        if (context.GetMaxParseThreads() > 1)
+        {
+            return ParallelBodyParser::Parse(context, ParseUtil::GetArray(json, AdaptiveCardSchemaKey::Body, false));
+        }
+        return ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+    });
+}
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::DeserializeCard(
+    const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const BodyDeserializer& deserializeBody)
 {
     ParseUtil::ThrowIfNotJsonObject(json);
 
@@ -204,7 +338,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         const SemanticVersion rendererMaxVersion(rendererVersion);
         const SemanticVersion cardVersion(version);
 
-        if (rendererVersion < cardVersion)
+        if (rendererMaxVersion < cardVersion)
         {
             if (fallbackText.empty())
             {
@@ -218,7 +352,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
             context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
                 AdaptiveCards::WarningStatusCode::UnsupportedSchemaVersion, "Schema version not supported"));
-            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
+            return MakeFallbackTextCard(fallbackText, language, speak);
         }
     }
 
@@ -229,25 +363,25 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         context, json, AdaptiveCardSchemaKey::Authentication, Authentication::Deserialize);
 
     ContainerStyle style =
-        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString);
+        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString);
     context.SetParentalContainerStyle(style);
 
     VerticalContentAlignment verticalContentAlignment = ParseUtil::GetEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentFromString);
+        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentTryFromString);
     HeightType height =
-        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
+        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString);
 
     unsigned int minHeight =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings).value_or(0);
 
     // Parse body
-    auto body = ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
+    auto body = deserializeBody(context);
     // Parse actions if present
     auto actions = ParseUtil::GetActionCollection(context, json, AdaptiveCardSchemaKey::Actions, false);
 
     EnsureShowCardVersions(actions, version);
 
-    auto result = std::make_shared<AdaptiveCard>(
+    auto result = context.MakeShared<AdaptiveCard>(
         version, fallbackText, backgroundImage, refresh, authentication, style, speak, language, verticalContentAlignment, height, minHeight, body, actions);
     result->SetLanguage(language);
     result->SetRtl(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::Rtl));
@@ -256,10 +390,10 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
     Json::Value additionalProperties;
-    HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
+    HandleUnknownProperties(json, *result->m_knownProperties, additionalProperties);
     result->SetAdditionalProperties(additionalProperties);
 
-    return std::make_shared<ParseResult>(result, context.warnings);
+    return result;
 }
 
 #ifdef __ANDROID__
@@ -280,10 +414,100 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(
 std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
 {
-    return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
+    if (!context.GetDeferNestedContent())
+    {
+        return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
+    }
+
+    // The json is the parse's own here, so deferred content can hold on to it and point into it rather than copy its
+    // part of it
+    const auto json = std::make_shared<const Json::Value>(ParseUtil::GetJsonValueFromString(jsonString));
+    context.m_sourceJson = json;
+    try
+    {
+        auto parseResult = AdaptiveCard::Deserialize(*json, rendererVersion, context);
+        context.m_sourceJson.reset();
+        return parseResult;
+    }
+    catch (...)
+    {
+        context.m_sourceJson.reset();
+        throw;
+    }
 }
 
-Json::Value AdaptiveCard::SerializeToJsonValue() const
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByBodyItem(
+    const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByBodyItem(const std::string& jsonString, const std::string& rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromStringByBodyItem(jsonString, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByBodyItem(
+    const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromStringByBodyItem(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    const char* const jsonBegin = jsonString.data();
+    const char* const jsonEnd = jsonBegin + jsonString.size();
+
+    BodyLayout body;
+    if (!TryFindBody(jsonBegin, jsonEnd, body) || body.items.empty())
+    {
+        // Either there's no body worth splitting up, or the text has a shape we leave to jsoncpp (malformed json,
+        // duplicate body properties). The regular path handles those and reports errors the usual way.
+        return AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+    }
+
+    const CardArenaRelease cardArenaRelease(context);
+
+    // Everything outside of the body is parsed up front as a card with an empty body
+    Json::Value cardJson;
+    {
+        std::string cardJsonString;
+        cardJsonString.reserve(jsonString.size() - (body.end - body.begin) + 2);
+        cardJsonString.append(jsonBegin, body.begin).append("[]").append(body.end, jsonEnd);
+        cardJson = ParseUtil::GetJsonValueFromString(cardJsonString);
+    }
+
+    const auto card = DeserializeCard(cardJson, rendererVersion, context, [&jsonString, &body](ParseContext& context) {
+        const size_t itemCount = body.items.size();
+        std::vector<std::shared_ptr<BaseCardElement>> elements;
+        elements.reserve(itemCount);
+
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            const auto& [itemBegin, itemEnd] = body.items[i];
+
+            Json::Value itemJson;
+            try
+            {
+                itemJson = ParseUtil::GetJsonValueFromString(std::string_view(itemBegin, itemEnd - itemBegin));
+            }
+            catch (const AdaptiveCardParseException&)
+            {
+                // report the error against the whole card, exactly as the regular path would
+                ParseUtil::GetJsonValueFromString(jsonString);
+                throw;
+            }
+
+            ParseUtil::AddElementCollectionItem<BaseCardElement>(true, context, itemJson, i, itemCount, "", elements);
+        }
+
+        return elements;
+    });
+
+    return MakeParseResult(card, context);
+}
+
+Json::Value AdaptiveCard::SerializePropertiesToJsonValue() const
 {
     Json::Value root = GetAdditionalProperties();
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
@@ -347,6 +571,13 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
+    return root;
+}
+
+Json::Value AdaptiveCard::SerializeToJsonValue() const
+{
+    Json::Value root = SerializePropertiesToJsonValue();
+
     const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
     root[bodyPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : GetBody())
@@ -386,7 +617,72 @@ std::shared_ptr<AdaptiveCard> AdaptiveCard::MakeFallbackTextCard(
 
 std::string AdaptiveCard::Serialize() const
 {
-    return ParseUtil::JsonToString(SerializeToJsonValue());
+    std::string output;
+    {
+        JsonWriter writer(output);
+        Serialize(writer);
+    }
+    return output;
+}
+
+void AdaptiveCard::Serialize(JsonWriter& writer) const
+{
+    Json::Value root = SerializePropertiesToJsonValue();
+
+    // The body and actions replace any additional properties of the same names, as in SerializeToJsonValue
+    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    root.removeMember(actionsPropertyName);
+    root.removeMember(bodyPropertyName);
+
+    const auto writeElements = [&writer](const std::string_view name, const auto& elements) {
+        writer.WriteName(name);
+        writer.BeginArray();
+        for (const auto& element : elements)
+        {
+            writer.WriteValue(element->SerializeToJsonValue());
+        }
+        writer.EndArray();
+    };
+
+    // Members are written in the order jsoncpp sorts them in, so the actions and then the body are written as soon
+    // as the next member's name sorts after theirs
+    bool actionsWritten = false;
+    bool bodyWritten = false;
+    const auto writeElementsBefore = [&](const std::string_view name) {
+        if (!actionsWritten && actionsPropertyName < name)
+        {
+            writeElements(actionsPropertyName, GetActions());
+            actionsWritten = true;
+        }
+        if (!bodyWritten && bodyPropertyName < name)
+        {
+            writeElements(bodyPropertyName, GetBody());
+            bodyWritten = true;
+        }
+    };
+
+    writer.BeginObject();
+    for (auto member = root.begin(); member != root.end(); ++member)
+    {
+        const char* nameEnd;
+        const char* nameBegin = member.memberName(&nameEnd);
+        const std::string_view name(nameBegin, nameEnd - nameBegin);
+
+        writeElementsBefore(name);
+        writer.WriteName(name);
+        writer.WriteValue(*member);
+    }
+    if (!actionsWritten)
+    {
+        writeElements(actionsPropertyName, GetActions());
+    }
+    if (!bodyWritten)
+    {
+        writeElements(bodyPropertyName, GetBody());
+    }
+    writer.EndObject();
+    writer.WriteRaw("\n");
 }
 
 std::string AdaptiveCard::GetVersion() const
@@ -547,28 +843,39 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
 
 void AdaptiveCard::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        KnownPropertiesSet{},
+        {AdaptiveCardSchemaKey::Type,
+         AdaptiveCardSchemaKey::Version,
+         AdaptiveCardSchemaKey::Body,
+         AdaptiveCardSchemaKey::Actions,
+         AdaptiveCardSchemaKey::FallbackText,
+         AdaptiveCardSchemaKey::BackgroundImage,
+         AdaptiveCardSchemaKey::Refresh,
+         AdaptiveCardSchemaKey::Authentication,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Speak,
+         AdaptiveCardSchemaKey::Language,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::Schema});
+    m_knownProperties = &knownProperties;
 }
 
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    // Parsing uses the KnownPropertiesSet directly; this copy of it keeps the type callers (and the bindings) expect
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        std::unordered_set<std::string> properties;
+        for (const auto& property : *m_knownProperties)
+        {
+            properties.emplace(property);
+        }
+        return properties;
+    }();
+    return knownProperties;
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
@@ -610,3 +917,13 @@ std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
 
     return resourceVector;
 }
+
+std::shared_ptr<const ElementIndex> AdaptiveCard::GetElementIndex() const
+{
+    return m_elementIndex.Get(*this);
+}
+
+void AdaptiveCard::ResetElementIndex()
+{
+    m_elementIndex.Reset();
+}
@@ -8,11 +8,13 @@
 #include "ParseResult.h"
 #include "Refresh.h"
 #include "Authentication.h"
+#include "ElementIndex.h"
 
 namespace AdaptiveCards
 {
 class Container;
 class BackgroundImage;
+class JsonWriter;
 
 class AdaptiveCard
 {
@@ -122,6 +124,11 @@ public:
 
     std::vector<RemoteResourceInformation> GetResourceInformation();
 
+    // The card's elements and actions by id, including those of its show cards. Built the first time it's asked for,
+    // so changes made to the card after that aren't in it, apart from the elements a PatchableCard swaps in. Those
+    // drop the index, and it's built again the next time it's asked for; an index already handed out is left as it was.
+    std::shared_ptr<const ElementIndex> GetElementIndex() const;
+
     CardElementType GetElementType() const;
 #ifdef __ANDROID__
 #pragma GCC diagnostic ignored "-Wdynamic-exception-spec"
@@ -137,6 +144,11 @@ public:
         const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<ParseResult> DeserializeFromString(
         const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromStringByBodyItem(
+        const std::string& jsonString, std::string rendererVersion, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromStringByBodyItem(
+        const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak) throw(AdaptiveCards::AdaptiveCardParseException);
 #else
@@ -148,12 +160,23 @@ public:
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
     static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
 
+    // Produces the same result as DeserializeFromString, but parses the top level items of the card's body one at a
+    // time. The tokenizer locates each item in the text, and only that item is parsed into a Json::Value and
+    // deserialized before moving on to the next. Anything nested in an item is parsed along with it, so this only
+    // helps cards whose body has many top level items.
+    static std::shared_ptr<ParseResult> DeserializeFromStringByBodyItem(
+        const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromStringByBodyItem(const std::string& jsonString, const std::string& rendererVersion);
+
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak);
 
 #endif // __ANDROID__
     Json::Value SerializeToJsonValue() const;
     std::string Serialize() const;
+    // Writes the same text Serialize() returns, one element of the body and actions at a time, so the json of the
+    // whole card is never built
+    void Serialize(JsonWriter& writer) const;
 
     const InternalId GetInternalId() const
     {
@@ -161,6 +184,27 @@ public:
     }
 
 private:
+    friend class ShowCardActionParser;
+    friend class PatchableCard;
+
+    using BodyDeserializer = std::function<std::vector<std::shared_ptr<BaseCardElement>>(ParseContext& context)>;
+
+    // Deserializes the card without producing a ParseResult; its warnings are left in context. Cards of nested
+    // Action.ShowCard actions are parsed this way, so a parse collects its warnings in one list.
+    static std::shared_ptr<AdaptiveCard> DeserializeCard(const Json::Value& json, const std::string& rendererVersion, ParseContext& context);
+
+    // Deserializes everything in json but the body, which deserializeBody provides
+    static std::shared_ptr<AdaptiveCard> DeserializeCard(
+        const Json::Value& json, const std::string& rendererVersion, ParseContext& context, const BodyDeserializer& deserializeBody);
+
+    static std::shared_ptr<ParseResult> MakeParseResult(const std::shared_ptr<AdaptiveCard>& card, ParseContext& context);
+
+    // Drops the card's ElementIndex, for when elements or actions of the card are replaced in place
+    void ResetElementIndex();
+
+    // The json of everything but the body and actions
+    Json::Value SerializePropertiesToJsonValue() const;
+
     static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
     void PopulateKnownPropertiesSet();
 
@@ -177,12 +221,14 @@ private:
     unsigned int m_minHeight;
     std::optional<bool> m_rtl;
     InternalId m_internalId;
-    std::unordered_set<std::string> m_knownProperties;
+    const KnownPropertiesSet* m_knownProperties;
     Json::Value m_additionalProperties;
 
     std::vector<std::shared_ptr<BaseCardElement>> m_body;
     std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
     std::shared_ptr<BaseActionElement> m_selectAction;
+
+    ElementIndexCache m_elementIndex;
 };
 } // namespace AdaptiveCards
@@ -24,20 +24,46 @@ Json::Value ShowCardAction::SerializeToJsonValue() const
 
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 {
-    return m_card;
+    return m_deferredCard ? m_deferredCard->Get() : m_card;
+}
+
+std::shared_ptr<const DeferredContent<AdaptiveCard>> ShowCardAction::GetDeferredCard() const
+{
+    return m_deferredCard;
 }
 
 void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
 {
+    m_deferredCard.reset();
     m_card = card;
 }
 
+void ShowCardAction::EnsureCardVersion(const std::string& version)
+{
+    const auto ensureVersion = [version](AdaptiveCard& card) {
+        if (card.GetVersion().empty())
+        {
+            card.SetVersion(version);
+        }
+    };
+
+    if (m_deferredCard)
+    {
+        m_deferredCard->SetAfterParse(ensureVersion);
+    }
+    else
+    {
+        ensureVersion(*m_card);
+    }
+}
+
 void ShowCardAction::SetLanguage(const std::string& value)
 {
     // If the card inside doesn't specify language, propagate
-    if (m_card->GetLanguage().empty())
+    const auto card = GetCard();
+    if (card->GetLanguage().empty())
     {
-        m_card->SetLanguage(value);
+        card->SetLanguage(value);
     }
 }
 
@@ -45,14 +71,28 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContex
 {
     std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
-
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
-
-    auto showCardWarnings = parseResult->GetWarnings();
-    auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
+    const auto& cardJson = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card);
+    if (DeferredContentIds::IsDeferring(context) && cardJson.isObject())
+    {
+        showCardAction->m_deferredCard = std::make_shared<DeferredContent<AdaptiveCard>>(
+            context, cardJson, [](ParseContext& cardContext, const Json::Value& json) {
+                return AdaptiveCard::DeserializeCard(json, "", cardContext);
+            });
+        DeferredContentIds::ScanCard(context, cardJson);
+
+        // parsing the card leaves its language and style in context for the elements after it, so skipping the
+        // parse has to as well
+        if (const auto language = ParseUtil::GetString(cardJson, AdaptiveCardSchemaKey::Language); !language.empty())
+        {
+            context.SetLanguage(language);
+        }
+        context.SetParentalContainerStyle(ParseUtil::GetEnumValue<ContainerStyle>(
+            cardJson, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
+        return showCardAction;
+    }
 
-    showCardAction->SetCard(parseResult->GetAdaptiveCard());
+    // the warnings of the card go straight to context, where the parse of the enclosing card collects them
+    showCardAction->SetCard(AdaptiveCard::DeserializeCard(cardJson, "", context));
 
     return showCardAction;
 }
@@ -64,7 +104,8 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(*m_knownProperties, {AdaptiveCardSchemaKey::Card});
+    m_knownProperties = &knownProperties;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
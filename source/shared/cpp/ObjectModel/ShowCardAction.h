@@ -6,11 +6,14 @@
 #include "SharedAdaptiveCard.h"
 #include "BaseActionElement.h"
 #include "ActionParserRegistration.h"
+#include "DeferredContent.h"
 
 namespace AdaptiveCards
 {
 class ShowCardAction : public BaseActionElement
 {
+    friend class ShowCardActionParser;
+
 public:
     ShowCardAction();
     ShowCardAction(const ShowCardAction&) = default;
@@ -21,8 +24,14 @@ public:
 
     Json::Value SerializeToJsonValue() const override;
 
+    // Parses the card first, if its parse was deferred (see ParseContext::SetDeferNestedContent)
     std::shared_ptr<AdaptiveCards::AdaptiveCard> GetCard() const;
     void SetCard(const std::shared_ptr<AdaptiveCards::AdaptiveCard>);
+    // The card while its parse is deferred, or nullptr when it was parsed along with the rest of the card or set
+    std::shared_ptr<const DeferredContent<AdaptiveCard>> GetDeferredCard() const;
+
+    // Gives the card version if it doesn't have one of its own, without parsing a card whose parse was deferred
+    void EnsureCardVersion(const std::string& version);
 
     void SetLanguage(const std::string& value);
 
@@ -32,6 +41,7 @@ private:
     void PopulateKnownPropertiesSet();
 
     std::shared_ptr<AdaptiveCard> m_card;
+    std::shared_ptr<DeferredContent<AdaptiveCard>> m_deferredCard;
 };
 
 class ShowCardActionParser : public ActionElementParser
@@ -15,14 +15,16 @@ Table::Table() :
 
 void Table::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::FirstRowAsHeaders,
+         AdaptiveCardSchemaKey::GridStyle,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rows,
+         AdaptiveCardSchemaKey::ShowGridLines,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 bool Table::GetShowGridLines() const
@@ -184,12 +186,12 @@ std::shared_ptr<BaseCardElement> TableParser::Deserialize(ParseContext& context,
 
     table->SetShowGridLines(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::ShowGridLines, true, false));
     table->SetGridStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleTryFromString));
     table->SetFirstRowAsHeaders(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::FirstRowAsHeaders, true, false));
     table->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     table->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
     return table;
 }
@@ -18,12 +18,14 @@ TableRow::TableRow() :
 
 void TableRow::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Cells,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 std::vector<std::shared_ptr<TableCell>>& TableRow::GetCells()
@@ -115,11 +117,11 @@ std::shared_ptr<TableRow> TableRow::DeserializeTableRow(ParseContext& context, c
     std::shared_ptr<TableRow> tableRow = BaseCardElement::Deserialize<TableRow>(context, json);
 
     tableRow->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     tableRow->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
     tableRow->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
     auto cells = ParseUtil::GetElementCollectionOfSingleType<TableCell>(
         context, json, AdaptiveCardSchemaKey::Cells, &TableCell::DeserializeTableCell, false);
@@ -0,0 +1,1464 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TemplateExpression.h"
+#include "ParseUtil.h"
+
+#include <clocale>
+#include <cmath>
+
+using namespace AdaptiveCards;
+
+namespace AdaptiveCards
+{
+struct TemplateExpression::Node
+{
+    enum class Kind
+    {
+        Constant,
+        Data,
+        Root,
+        Host,
+        Index,
+        // the item of a select or where that the node is inside of
+        Local,
+        // children[0].name
+        Member,
+        // children[0][children[1]]
+        Element,
+        Not,
+        Negate,
+        Binary,
+        And,
+        Or,
+        If,
+        Select,
+        Where,
+        Call,
+    };
+
+    using Function = Json::Value (*)(std::vector<TemplateValue>& arguments);
+
+    explicit Node(Kind kind) : kind(kind), op(0), slot(0), function(nullptr) {}
+
+    Kind kind;
+    Json::Value constant;
+    std::string name;
+    // the operator of a Binary node: one of + - * / % & < > = ! l (<=) g (>=)
+    char op;
+    // the local a Local node reads, or a Select or Where node binds
+    size_t slot;
+    Function function;
+    std::vector<std::unique_ptr<Node>> children;
+};
+} // namespace AdaptiveCards
+
+namespace
+{
+using Node = TemplateExpression::Node;
+using NodeKind = TemplateExpression::Node::Kind;
+using Locals = std::vector<const Json::Value*>;
+
+[[noreturn]] void ThrowEvaluationError(const std::string& message)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, message);
+}
+
+bool IsInteger(const Json::Value& value)
+{
+    return value.type() == Json::intValue || value.type() == Json::uintValue;
+}
+
+bool IsNumber(const Json::Value& value)
+{
+    return IsInteger(value) || value.type() == Json::realValue;
+}
+
+double ToDouble(const Json::Value& value, const char* function)
+{
+    if (!IsNumber(value))
+    {
+        ThrowEvaluationError(std::string(function) + " expects a number");
+    }
+    return value.asDouble();
+}
+
+bool IsTrue(const Json::Value& value)
+{
+    return value.isBool() ? value.asBool() : !value.isNull();
+}
+
+bool AreEqual(const Json::Value& left, const Json::Value& right)
+{
+    if (IsNumber(left) && IsNumber(right))
+    {
+        if (IsInteger(left) && IsInteger(right) && left.type() == right.type())
+        {
+            return left == right;
+        }
+        return left.asDouble() == right.asDouble();
+    }
+    return left == right;
+}
+
+// The byte offset of the codepoint at index codepoints into text, or text.size() if text has fewer
+size_t GetCodepointOffset(const std::string& text, size_t codepoints)
+{
+    size_t offset = 0;
+    for (; offset < text.size(); ++offset)
+    {
+        if ((static_cast<unsigned char>(text[offset]) & 0xC0) != 0x80 && codepoints-- == 0)
+        {
+            break;
+        }
+    }
+    return offset;
+}
+
+size_t CountCodepoints(const std::string& text)
+{
+    return static_cast<size_t>(
+        std::count_if(text.begin(), text.end(), [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
+}
+
+// printf and strtod use the decimal point of the C locale the host has set, which isn't '.' everywhere. Numbers in
+// expressions and their results always use '.'.
+//
+// printf with '.' as the decimal point whatever the C locale's is
+std::string FormatDouble(const char* format, int precision, double number)
+{
+    char text[512];
+    snprintf(text, sizeof(text), format, precision, number);
+
+    std::string formatted = text;
+    if (const char decimalPoint = *std::localeconv()->decimal_point; decimalPoint != '.')
+    {
+        std::replace(formatted.begin(), formatted.end(), decimalPoint, '.');
+    }
+    return formatted;
+}
+
+// strtod with '.' as the decimal point whatever the C locale's is. Returns the number text starts with, and sets length
+// to the number of characters it takes up.
+double ReadDouble(std::string text, size_t& length)
+{
+    if (const char decimalPoint = *std::localeconv()->decimal_point; decimalPoint != '.')
+    {
+        // the locale's decimal point isn't one here, so strtod has to stop at it
+        if (const size_t localePoint = text.find(decimalPoint); localePoint != std::string::npos)
+        {
+            text.resize(localePoint);
+        }
+        std::replace(text.begin(), text.end(), '.', decimalPoint);
+    }
+
+    char* end = nullptr;
+    const double number = std::strtod(text.c_str(), &end);
+    length = static_cast<size_t>(end - text.c_str());
+    return number;
+}
+
+// Numbers the way JavaScript shows them: integers without a fraction, and the shortest text that reads back as the
+// same double otherwise
+std::string NumberToString(const Json::Value& value)
+{
+    if (value.type() == Json::intValue)
+    {
+        return std::to_string(value.asLargestInt());
+    }
+    if (value.type() == Json::uintValue)
+    {
+        return std::to_string(value.asLargestUInt());
+    }
+
+    const double number = value.asDouble();
+    if (std::isnan(number))
+    {
+        return "NaN";
+    }
+    if (std::isinf(number))
+    {
+        return number < 0 ? "-Infinity" : "Infinity";
+    }
+
+    if (number == std::trunc(number) && std::fabs(number) < 1e21)
+    {
+        return FormatDouble("%.*f", 0, number);
+    }
+
+    std::string text;
+    for (int precision = 15; precision <= 17; ++precision)
+    {
+        text = FormatDouble("%.*g", precision, number);
+        size_t length;
+        if (ReadDouble(text, length) == number)
+        {
+            break;
+        }
+    }
+    return text;
+}
+
+// Numbers and arrays given to sum, min and max either as one array or as arguments of their own
+std::vector<const Json::Value*> GetNumbers(const std::vector<TemplateValue>& arguments, const char* function)
+{
+    std::vector<const Json::Value*> numbers;
+    for (const auto& argument : arguments)
+    {
+        if (argument.Get().isArray())
+        {
+            for (const auto& item : argument.Get())
+            {
+                numbers.push_back(&item);
+            }
+        }
+        else
+        {
+            numbers.push_back(&argument.Get());
+        }
+    }
+
+    for (const auto number : numbers)
+    {
+        ToDouble(*number, function);
+    }
+    return numbers;
+}
+
+std::string GetStringArgument(const TemplateValue& argument, const char* function)
+{
+    if (!argument.Get().isString())
+    {
+        ThrowEvaluationError(std::string(function) + " expects a string");
+    }
+    return argument.Get().asString();
+}
+
+// Date and time functions. Times are milliseconds since the Unix epoch, in UTC.
+
+int64_t DaysFromCivil(int64_t year, unsigned int month, unsigned int day)
+{
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const auto yearOfEra = static_cast<unsigned int>(year - era * 400);
+    const unsigned int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+}
+
+void CivilFromDays(int64_t days, int64_t& year, unsigned int& month, unsigned int& day)
+{
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const auto dayOfEra = static_cast<unsigned int>(days - era * 146097);
+    const unsigned int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned int monthIndex = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = static_cast<int64_t>(yearOfEra) + era * 400 + (month <= 2);
+}
+
+// Reads count digits at text[position], advancing position past them
+bool ReadDigits(const std::string& text, size_t& position, size_t minCount, size_t maxCount, unsigned int& value)
+{
+    size_t count = 0;
+    value = 0;
+    while (count < maxCount && position < text.size() && text[position] >= '0' && text[position] <= '9')
+    {
+        value = value * 10 + static_cast<unsigned int>(text[position] - '0');
+        ++position;
+        ++count;
+    }
+    return count >= minCount;
+}
+
+// Parses the timestamps templates get in their data: ISO 8601 (2017-02-14T06:08:00Z, with an optional fraction and
+// offset, or just a date) and US style (03/15/2018 12:00:00). Times without an offset are taken to be UTC.
+int64_t ParseTimestamp(const std::string& text)
+{
+    unsigned int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    int64_t milliseconds = 0;
+    size_t position = 0;
+
+    const auto expect = [&](char c) {
+        if (position < text.size() && text[position] == c)
+        {
+            ++position;
+            return true;
+        }
+        return false;
+    };
+    const auto fail = [&]() -> int64_t { ThrowEvaluationError("Unrecognized timestamp: " + text); };
+
+    if (text.size() > 2 && (text[1] == '/' || text[2] == '/'))
+    {
+        if (!ReadDigits(text, position, 1, 2, month) || !expect('/') || !ReadDigits(text, position, 1, 2, day) ||
+            !expect('/') || !ReadDigits(text, position, 4, 4, year))
+        {
+            return fail();
+        }
+        if (!expect(' ') && !expect('T') && position != text.size())
+        {
+            return fail();
+        }
+    }
+    else
+    {
+        if (!ReadDigits(text, position, 4, 4, year) || !expect('-') || !ReadDigits(text, position, 2, 2, month) ||
+            !expect('-') || !ReadDigits(text, position, 2, 2, day))
+        {
+            return fail();
+        }
+        if (!expect('T') && !expect(' ') && position != text.size())
+        {
+            return fail();
+        }
+    }
+
+    if (position < text.size())
+    {
+        if (!ReadDigits(text, position, 1, 2, hour) || !expect(':') || !ReadDigits(text, position, 2, 2, minute))
+        {
+            return fail();
+        }
+        if (expect(':') && !ReadDigits(text, position, 2, 2, second))
+        {
+            return fail();
+        }
+        if (expect('.'))
+        {
+            int64_t scale = 100;
+            for (; position < text.size() && text[position] >= '0' && text[position] <= '9'; ++position)
+            {
+                milliseconds += (text[position] - '0') * scale;
+                scale /= 10;
+            }
+        }
+
+        if (expect('Z') || expect('z'))
+        {
+        }
+        else if (position < text.size() && (text[position] == '+' || text[position] == '-'))
+        {
+            const int64_t sign = text[position++] == '-' ? -1 : 1;
+            unsigned int offsetHours = 0, offsetMinutes = 0;
+            if (!ReadDigits(text, position, 2, 2, offsetHours))
+            {
+                return fail();
+            }
+            expect(':');
+            ReadDigits(text, position, 2, 2, offsetMinutes);
+            milliseconds -= sign * (offsetHours * 60 + offsetMinutes) * 60000;
+        }
+    }
+
+    if (position != text.size() || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+    {
+        return fail();
+    }
+
+    return DaysFromCivil(year, month, day) * 86400000 + ((hour * 60 + minute) * 60 + second) * int64_t{1000} + milliseconds;
+}
+
+// Formats time with a .NET custom date and time format string, as the Adaptive Expressions functions do
+std::string FormatTimestamp(int64_t time, const std::string& format)
+{
+    static constexpr const char* monthNames[] = {"January", "February", "March",     "April",   "May",      "June",
+                                                 "July",    "August",   "September", "October", "November", "December"};
+    static constexpr const char* dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+
+    int64_t days = time / 86400000;
+    int64_t millisecondOfDay = time % 86400000;
+    if (millisecondOfDay < 0)
+    {
+        millisecondOfDay += 86400000;
+        --days;
+    }
+
+    int64_t year;
+    unsigned int month, day;
+    CivilFromDays(days, year, month, day);
+    const auto dayOfWeek = static_cast<size_t>(((days % 7) + 11) % 7);
+    const auto hour = static_cast<unsigned int>(millisecondOfDay / 3600000);
+    const auto minute = static_cast<unsigned int>(millisecondOfDay / 60000 % 60);
+    const auto second = static_cast<unsigned int>(millisecondOfDay / 1000 % 60);
+    const auto millisecond = static_cast<unsigned int>(millisecondOfDay % 1000);
+
+    std::string result;
+    const auto appendNumber = [&result](int64_t value, size_t minDigits) {
+        std::string digits = std::to_string(value);
+        if (digits.size() < minDigits)
+        {
+            result.append(minDigits - digits.size(), '0');
+        }
+        result += digits;
+    };
+
+    for (size_t i = 0; i < format.size();)
+    {
+        const char c = format[i];
+        if (c == '\'' || c == '"')
+        {
+            const size_t end = format.find(c, i + 1);
+            result.append(format, i + 1, (end == std::string::npos ? format.size() : end) - i - 1);
+            i = end == std::string::npos ? format.size() : end + 1;
+            continue;
+        }
+        if (c == '\\' && i + 1 < format.size())
+        {
+            result += format[i + 1];
+            i += 2;
+            continue;
+        }
+
+        size_t count = 1;
+        while (i + count < format.size() && format[i + count] == c)
+        {
+            ++count;
+        }
+
+        switch (c)
+        {
+        case 'y':
+            appendNumber(count <= 2 ? year % 100 : year, count == 1 ? 1 : count);
+            break;
+        case 'M':
+            if (count >= 3)
+            {
+                result += count == 3 ? std::string(monthNames[month - 1], 3) : monthNames[month - 1];
+            }
+            else
+            {
+                appendNumber(month, count);
+            }
+            break;
+        case 'd':
+            if (count >= 3)
+            {
+                result += count == 3 ? std::string(dayNames[dayOfWeek], 3) : dayNames[dayOfWeek];
+            }
+            else
+            {
+                appendNumber(day, count);
+            }
+            break;
+        case 'H':
+            appendNumber(hour, std::min<size_t>(count, 2));
+            break;
+        case 'h':
+            appendNumber(hour % 12 == 0 ? 12 : hour % 12, std::min<size_t>(count, 2));
+            break;
+        case 'm':
+            appendNumber(minute, std::min<size_t>(count, 2));
+            break;
+        case 's':
+            appendNumber(second, std::min<size_t>(count, 2));
+            break;
+        case 'f':
+        case 'F':
+        {
+            std::string fraction = std::to_string(millisecond + 1000).substr(1) + "0000";
+            fraction.resize(std::min<size_t>(count, 7));
+            if (c == 'F')
+            {
+                fraction.erase(fraction.find_last_not_of('0') + 1);
+            }
+            result += fraction;
+            break;
+        }
+        case 't':
+            result += count == 1 ? (hour < 12 ? "A" : "P") : (hour < 12 ? "AM" : "PM");
+            break;
+        case 'z':
+            result += count == 1 ? "+0" : count == 2 ? "+00" : "+00:00";
+            break;
+        default:
+            result.append(count, c);
+            break;
+        }
+        i += count;
+    }
+    return result;
+}
+
+std::string GetFormatArgument(std::vector<TemplateValue>& arguments, const char* function)
+{
+    return arguments.size() > 1 ? GetStringArgument(arguments[1], function) : "yyyy-MM-ddTHH:mm:ss.fffZ";
+}
+
+// The functions templates can call, other than if, select, foreach and where, which decide what to evaluate
+namespace Functions
+{
+Json::Value String(std::vector<TemplateValue>& arguments)
+{
+    return TemplateExpression::ToString(arguments[0].Get());
+}
+
+Json::Value Int(std::vector<TemplateValue>& arguments)
+{
+    const Json::Value& value = arguments[0].Get();
+    if (IsNumber(value))
+    {
+        return Json::Value(static_cast<Json::Int64>(value.asDouble()));
+    }
+    if (value.isString())
+    {
+        const std::string text = value.asString();
+        char* end = nullptr;
+        const long long number = std::strtoll(text.c_str(), &end, 10);
+        if (!text.empty() && *end == '\0')
+        {
+            return Json::Value(static_cast<Json::Int64>(number));
+        }
+    }
+    ThrowEvaluationError("int expects a number or a string of an integer");
+}
+
+Json::Value Float(std::vector<TemplateValue>& arguments)
+{
+    const Json::Value& value = arguments[0].Get();
+    if (IsNumber(value))
+    {
+        return Json::Value(value.asDouble());
+    }
+    if (value.isString())
+    {
+        const std::string text = value.asString();
+        size_t length;
+        const double number = ReadDouble(text, length);
+        if (!text.empty() && length == text.size())
+        {
+            return Json::Value(number);
+        }
+    }
+    ThrowEvaluationError("float expects a number or a string of a number");
+}
+
+Json::Value ParseJson(std::vector<TemplateValue>& arguments)
+{
+    return ParseUtil::GetJsonValueFromString(GetStringArgument(arguments[0], "json"));
+}
+
+Json::Value Exists(std::vector<TemplateValue>& arguments)
+{
+    return !arguments[0].Get().isNull();
+}
+
+Json::Value Length(std::vector<TemplateValue>& arguments)
+{
+    const Json::Value& value = arguments[0].Get();
+    if (value.isString())
+    {
+        return static_cast<Json::UInt64>(CountCodepoints(value.asString()));
+    }
+    if (value.isArray())
+    {
+        return static_cast<Json::UInt64>(value.size());
+    }
+    ThrowEvaluationError("length expects a string or an array");
+}
+
+Json::Value ToLower(std::vector<TemplateValue>& arguments)
+{
+    std::string text = GetStringArgument(arguments[0], "toLower");
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) { return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c; });
+    return text;
+}
+
+Json::Value ToUpper(std::vector<TemplateValue>& arguments)
+{
+    std::string text = GetStringArgument(arguments[0], "toUpper");
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) { return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c; });
+    return text;
+}
+
+Json::Value Substring(std::vector<TemplateValue>& arguments)
+{
+    const std::string text = GetStringArgument(arguments[0], "substring");
+    const double start = ToDouble(arguments[1].Get(), "substring");
+    const size_t length = CountCodepoints(text);
+    const double count = arguments.size() > 2 ? ToDouble(arguments[2].Get(), "substring") : length - start;
+    if (start < 0 || count < 0 || start + count > length)
+    {
+        ThrowEvaluationError("substring is out of range");
+    }
+
+    const size_t begin = GetCodepointOffset(text, static_cast<size_t>(start));
+    const size_t end = GetCodepointOffset(text, static_cast<size_t>(start + count));
+    return text.substr(begin, end - begin);
+}
+
+Json::Value IndexOf(std::vector<TemplateValue>& arguments)
+{
+    const Json::Value& collection = arguments[0].Get();
+    const Json::Value& item = arguments[1].Get();
+    if (collection.isArray())
+    {
+        for (Json::ArrayIndex i = 0; i < collection.size(); ++i)
+        {
+            if (AreEqual(collection[i], item))
+            {
+                return static_cast<Json::Int64>(i);
+            }
+        }
+        return -1;
+    }
+
+    const std::string text = GetStringArgument(arguments[0], "indexOf");
+    const size_t position = text.find(GetStringArgument(arguments[1], "indexOf"));
+    return position == std::string::npos ? Json::Int64{-1} : static_cast<Json::Int64>(CountCodepoints(text.substr(0, position)));
+}
+
+Json::Value Concat(std::vector<TemplateValue>& arguments)
+{
+    if (std::all_of(arguments.begin(), arguments.end(), [](const TemplateValue& argument) { return argument.Get().isArray(); }))
+    {
+        Json::Value items(Json::arrayValue);
+        for (auto& argument : arguments)
+        {
+            for (const auto& item : argument.Get())
+            {
+                items.append(item);
+            }
+        }
+        return items;
+    }
+
+    std::string text;
+    for (const auto& argument : arguments)
+    {
+        text += TemplateExpression::ToString(argument.Get());
+    }
+    return text;
+}
+
+Json::Value Sum(std::vector<TemplateValue>& arguments)
+{
+    const auto numbers = GetNumbers(arguments, "sum");
+    if (std::all_of(numbers.begin(), numbers.end(), [](const Json::Value* number) { return IsInteger(*number); }))
+    {
+        Json::Int64 sum = 0;
+        for (const auto number : numbers)
+        {
+            sum += number->asLargestInt();
+        }
+        return sum;
+    }
+
+    double sum = 0;
+    for (const auto number : numbers)
+    {
+        sum += number->asDouble();
+    }
+    return sum;
+}
+
+template <bool isMax>
+Json::Value MinOrMax(std::vector<TemplateValue>& arguments)
+{
+    const auto numbers = GetNumbers(arguments, isMax ? "max" : "min");
+    if (numbers.empty())
+    {
+        ThrowEvaluationError(isMax ? "max expects numbers" : "min expects numbers");
+    }
+
+    const Json::Value* result = numbers.front();
+    for (const auto number : numbers)
+    {
+        if (isMax ? number->asDouble() > result->asDouble() : number->asDouble() < result->asDouble())
+        {
+            result = number;
+        }
+    }
+    return *result;
+}
+
+Json::Value FormatNumber(std::vector<TemplateValue>& arguments)
+{
+    const double number = ToDouble(arguments[0].Get(), "formatNumber");
+    const int precision = static_cast<int>(std::clamp(ToDouble(arguments[1].Get(), "formatNumber"), 0.0, 20.0));
+
+    // Group the digits of the integer part in threes, as the default en-US locale does
+    std::string formatted = FormatDouble("%.*f", precision, number);
+    const size_t digitsBegin = formatted[0] == '-' ? 1 : 0;
+    size_t digitsEnd = formatted.find('.');
+    if (digitsEnd == std::string::npos)
+    {
+        digitsEnd = formatted.size();
+    }
+    for (size_t separator = digitsEnd; separator > digitsBegin + 3; separator -= 3)
+    {
+        formatted.insert(separator - 3, 1, ',');
+    }
+    return formatted;
+}
+
+Json::Value FormatDateTime(std::vector<TemplateValue>& arguments)
+{
+    return FormatTimestamp(ParseTimestamp(GetStringArgument(arguments[0], "formatDateTime")), GetFormatArgument(arguments, "formatDateTime"));
+}
+
+Json::Value FormatEpoch(std::vector<TemplateValue>& arguments)
+{
+    const double seconds = ToDouble(arguments[0].Get(), "formatEpoch");
+    return FormatTimestamp(static_cast<int64_t>(std::llround(seconds * 1000)), GetFormatArgument(arguments, "formatEpoch"));
+}
+
+Json::Value FormatTicks(std::vector<TemplateValue>& arguments)
+{
+    // Ticks are 100ns intervals since 0001-01-01
+    constexpr int64_t unixEpochTicks = 621355968000000000;
+    const Json::Value& ticks = arguments[0].Get();
+    const int64_t milliseconds = IsInteger(ticks) ? (ticks.asLargestInt() - unixEpochTicks) / 10000
+                                                  : static_cast<int64_t>((ToDouble(ticks, "formatTicks") - unixEpochTicks) / 10000);
+    return FormatTimestamp(milliseconds, GetFormatArgument(arguments, "formatTicks"));
+}
+} // namespace Functions
+
+struct FunctionInfo
+{
+    const char* name;
+    Node::Function function;
+    size_t minArguments;
+    size_t maxArguments;
+};
+
+constexpr size_t anyNumber = std::numeric_limits<size_t>::max();
+
+constexpr FunctionInfo functions[] = {
+    {"string", Functions::String, 1, 1},
+    {"int", Functions::Int, 1, 1},
+    {"float", Functions::Float, 1, 1},
+    {"json", Functions::ParseJson, 1, 1},
+    {"exists", Functions::Exists, 1, 1},
+    {"length", Functions::Length, 1, 1},
+    {"count", Functions::Length, 1, 1},
+    {"toLower", Functions::ToLower, 1, 1},
+    {"toUpper", Functions::ToUpper, 1, 1},
+    {"substring", Functions::Substring, 2, 3},
+    {"indexOf", Functions::IndexOf, 2, 2},
+    {"concat", Functions::Concat, 1, anyNumber},
+    {"sum", Functions::Sum, 1, anyNumber},
+    {"min", Functions::MinOrMax<false>, 1, anyNumber},
+    {"max", Functions::MinOrMax<true>, 1, anyNumber},
+    {"formatNumber", Functions::FormatNumber, 2, 3},
+    {"formatDateTime", Functions::FormatDateTime, 1, 3},
+    {"formatEpoch", Functions::FormatEpoch, 1, 3},
+    {"formatTicks", Functions::FormatTicks, 1, 3},
+};
+
+// A recursive descent parser over the text of an expression, which resolves names to what they refer to as it goes
+class ExpressionParser
+{
+public:
+    explicit ExpressionParser(std::string_view text) : m_text(text), m_position(0) {}
+
+    std::unique_ptr<Node> ParseExpression()
+    {
+        auto node = ParseOr();
+        SkipWhitespace();
+        if (m_position != m_text.size())
+        {
+            Fail();
+        }
+        return node;
+    }
+
+private:
+    [[noreturn]] void Fail() const
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid template expression: " + std::string(m_text));
+    }
+
+    void SkipWhitespace()
+    {
+        while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+        {
+            ++m_position;
+        }
+    }
+
+    bool Accept(std::string_view token)
+    {
+        SkipWhitespace();
+        if (m_text.substr(m_position, token.size()) == token)
+        {
+            m_position += token.size();
+            return true;
+        }
+        return false;
+    }
+
+    void Expect(std::string_view token)
+    {
+        if (!Accept(token))
+        {
+            Fail();
+        }
+    }
+
+    static std::unique_ptr<Node> MakeNode(NodeKind kind, std::unique_ptr<Node> left = nullptr, std::unique_ptr<Node> right = nullptr)
+    {
+        auto node = std::make_unique<Node>(kind);
+        if (left)
+        {
+            node->children.push_back(std::move(left));
+        }
+        if (right)
+        {
+            node->children.push_back(std::move(right));
+        }
+        return node;
+    }
+
+    static std::unique_ptr<Node> MakeBinary(char op, std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+    {
+        auto node = MakeNode(NodeKind::Binary, std::move(left), std::move(right));
+        node->op = op;
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseOr()
+    {
+        auto node = ParseAnd();
+        while (Accept("||"))
+        {
+            node = MakeNode(NodeKind::Or, std::move(node), ParseAnd());
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseAnd()
+    {
+        auto node = ParseEquality();
+        while (Accept("&&"))
+        {
+            node = MakeNode(NodeKind::And, std::move(node), ParseEquality());
+        }
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseEquality()
+    {
+        auto node = ParseRelational();
+        while (true)
+        {
+            if (Accept("=="))
+            {
+                node = MakeBinary('=', std::move(node), ParseRelational());
+            }
+            else if (Accept("!="))
+            {
+                node = MakeBinary('!', std::move(node), ParseRelational());
+            }
+            else
+            {
+                return node;
+            }
+        }
+    }
+
+    std::unique_ptr<Node> ParseRelational()
+    {
+        auto node = ParseAdditive();
+        while (true)
+        {
+            if (Accept("<="))
+            {
+                node = MakeBinary('l', std::move(node), ParseAdditive());
+            }
+            else if (Accept(">="))
+            {
+                node = MakeBinary('g', std::move(node), ParseAdditive());
+            }
+            else if (Accept("<"))
+            {
+                node = MakeBinary('<', std::move(node), ParseAdditive());
+            }
+            else if (Accept(">"))
+            {
+                node = MakeBinary('>', std::move(node), ParseAdditive());
+            }
+            else
+            {
+                return node;
+            }
+        }
+    }
+
+    std::unique_ptr<Node> ParseAdditive()
+    {
+        auto node = ParseMultiplicative();
+        while (true)
+        {
+            SkipWhitespace();
+            if ((m_position < m_text.size() && (m_text[m_position] == '+' || m_text[m_position] == '-')) ||
+                (m_text.substr(m_position, 1) == "&" && m_text.substr(m_position, 2) != "&&"))
+            {
+                const char op = m_text[m_position++];
+                node = MakeBinary(op, std::move(node), ParseMultiplicative());
+            }
+            else
+            {
+                return node;
+            }
+        }
+    }
+
+    std::unique_ptr<Node> ParseMultiplicative()
+    {
+        auto node = ParseUnary();
+        while (true)
+        {
+            SkipWhitespace();
+            if (m_position < m_text.size() && (m_text[m_position] == '*' || m_text[m_position] == '/' || m_text[m_position] == '%'))
+            {
+                const char op = m_text[m_position++];
+                node = MakeBinary(op, std::move(node), ParseUnary());
+            }
+            else
+            {
+                return node;
+            }
+        }
+    }
+
+    std::unique_ptr<Node> ParseUnary()
+    {
+        SkipWhitespace();
+        if (m_text.substr(m_position, 1) == "!" && m_text.substr(m_position, 2) != "!=")
+        {
+            ++m_position;
+            return MakeNode(NodeKind::Not, ParseUnary());
+        }
+        if (Accept("-"))
+        {
+            return MakeNode(NodeKind::Negate, ParseUnary());
+        }
+        if (Accept("+"))
+        {
+            return ParseUnary();
+        }
+        return ParsePostfix();
+    }
+
+    std::unique_ptr<Node> ParsePostfix()
+    {
+        auto node = ParsePrimary();
+        while (true)
+        {
+            if (Accept("."))
+            {
+                auto member = MakeNode(NodeKind::Member, std::move(node));
+                member->name = ParseIdentifier();
+                node = std::move(member);
+            }
+            else if (Accept("["))
+            {
+                node = MakeNode(NodeKind::Element, std::move(node), ParseOr());
+                Expect("]");
+            }
+            else
+            {
+                return node;
+            }
+        }
+    }
+
+    std::string ParseIdentifier()
+    {
+        SkipWhitespace();
+        const size_t begin = m_position;
+        while (m_position < m_text.size() &&
+               (std::isalnum(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '_' ||
+                m_text[m_position] == '$' || m_text[m_position] == '@'))
+        {
+            ++m_position;
+        }
+        if (m_position == begin || std::isdigit(static_cast<unsigned char>(m_text[begin])))
+        {
+            Fail();
+        }
+        return std::string(m_text.substr(begin, m_position - begin));
+    }
+
+    std::unique_ptr<Node> ParseConstant(Json::Value value)
+    {
+        auto node = MakeNode(NodeKind::Constant);
+        node->constant = std::move(value);
+        return node;
+    }
+
+    std::unique_ptr<Node> ParseNumber()
+    {
+        const size_t begin = m_position;
+        bool isInteger = true;
+        while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+        {
+            ++m_position;
+        }
+        if (m_position + 1 < m_text.size() && m_text[m_position] == '.' && std::isdigit(static_cast<unsigned char>(m_text[m_position + 1])))
+        {
+            isInteger = false;
+            for (++m_position; m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])); ++m_position)
+            {
+            }
+        }
+        if (m_position < m_text.size() && (m_text[m_position] == 'e' || m_text[m_position] == 'E'))
+        {
+            isInteger = false;
+            ++m_position;
+            if (m_position < m_text.size() && (m_text[m_position] == '+' || m_text[m_position] == '-'))
+            {
+                ++m_position;
+            }
+            while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+            {
+                ++m_position;
+            }
+        }
+
+        const std::string text(m_text.substr(begin, m_position - begin));
+        if (isInteger && text.size() < 19)
+        {
+            return ParseConstant(static_cast<Json::Int64>(std::stoll(text)));
+        }
+        size_t length;
+        return ParseConstant(ReadDouble(text, length));
+    }
+
+    std::unique_ptr<Node> ParseString(char quote)
+    {
+        std::string text;
+        for (++m_position; m_position < m_text.size() && m_text[m_position] != quote; ++m_position)
+        {
+            char c = m_text[m_position];
+            if (c == '\\' && m_position + 1 < m_text.size())
+            {
+                c = m_text[++m_position];
+                c = c == 'n' ? '\n' : c == 't' ? '\t' : c == 'r' ? '\r' : c;
+            }
+            text += c;
+        }
+        Expect(std::string_view(&quote, 1));
+        return ParseConstant(std::move(text));
+    }
+
+    std::vector<std::unique_ptr<Node>> ParseArguments()
+    {
+        std::vector<std::unique_ptr<Node>> arguments;
+        if (Accept(")"))
+        {
+            return arguments;
+        }
+        do
+        {
+            arguments.push_back(ParseOr());
+        } while (Accept(","));
+        Expect(")");
+        return arguments;
+    }
+
+    std::unique_ptr<Node> ParseCall(const std::string& name)
+    {
+        // select(collection, item, expression) and the like evaluate expression with item bound to each item
+        const bool isSelect = name == "select" || name == "foreach";
+        if (isSelect || name == "where")
+        {
+            auto node = MakeNode(isSelect ? NodeKind::Select : NodeKind::Where, ParseOr());
+            Expect(",");
+            node->slot = m_locals.size();
+            m_locals.push_back(ParseIdentifier());
+            Expect(",");
+            node->children.push_back(ParseOr());
+            Expect(")");
+            m_locals.pop_back();
+            return node;
+        }
+
+        auto arguments = ParseArguments();
+        if (name == "if")
+        {
+            if (arguments.size() != 3)
+            {
+                Fail();
+            }
+            auto node = MakeNode(NodeKind::If);
+            node->children = std::move(arguments);
+            return node;
+        }
+
+        const auto function = std::find_if(std::begin(functions), std::end(functions), [&name](const FunctionInfo& info) {
+            return name == info.name;
+        });
+        if (function == std::end(functions) || arguments.size() < function->minArguments || arguments.size() > function->maxArguments)
+        {
+            Fail();
+        }
+
+        auto node = MakeNode(NodeKind::Call);
+        node->name = name;
+        node->function = function->function;
+        node->children = std::move(arguments);
+        return node;
+    }
+
+    std::unique_ptr<Node> ParsePrimary()
+    {
+        SkipWhitespace();
+        if (m_position == m_text.size())
+        {
+            Fail();
+        }
+
+        const char c = m_text[m_position];
+        if (std::isdigit(static_cast<unsigned char>(c)))
+        {
+            return ParseNumber();
+        }
+        if (c == '\'' || c == '"')
+        {
+            return ParseString(c);
+        }
+        if (Accept("("))
+        {
+            auto node = ParseOr();
+            Expect(")");
+            return node;
+        }
+
+        const std::string name = ParseIdentifier();
+        if (Accept("("))
+        {
+            return ParseCall(name);
+        }
+
+        if (name == "true" || name == "false")
+        {
+            return ParseConstant(name == "true");
+        }
+        if (name == "null")
+        {
+            return ParseConstant(Json::Value());
+        }
+        if (name == "$data")
+        {
+            return MakeNode(NodeKind::Data);
+        }
+        if (name == "$root")
+        {
+            return MakeNode(NodeKind::Root);
+        }
+        if (name == "$host")
+        {
+            return MakeNode(NodeKind::Host);
+        }
+        if (name == "$index")
+        {
+            return MakeNode(NodeKind::Index);
+        }
+
+        const auto local = std::find(m_locals.rbegin(), m_locals.rend(), name);
+        if (local != m_locals.rend())
+        {
+            auto node = MakeNode(NodeKind::Local);
+            node->slot = static_cast<size_t>(m_locals.rend() - local) - 1;
+            return node;
+        }
+
+        auto member = MakeNode(NodeKind::Member, MakeNode(NodeKind::Data));
+        member->name = name;
+        return member;
+    }
+
+    std::string_view m_text;
+    size_t m_position;
+    // The items bound by the selects and wheres being parsed, innermost last
+    std::vector<std::string> m_locals;
+};
+
+// A value within parent: a reference if parent is one, so that paths into the data never copy it
+TemplateValue GetChild(const TemplateValue& parent, const Json::Value* child)
+{
+    if (!child)
+    {
+        return TemplateValue();
+    }
+    return parent.IsReference() ? TemplateValue(child) : TemplateValue(Json::Value(*child));
+}
+
+TemplateValue Evaluate(const Node& node, const TemplateScope& scope, Locals& locals);
+
+Json::Value EvaluateBinary(char op, const Json::Value& left, const Json::Value& right)
+{
+    switch (op)
+    {
+    case '=':
+        return AreEqual(left, right);
+    case '!':
+        return !AreEqual(left, right);
+    case '&':
+        return TemplateExpression::ToString(left) + TemplateExpression::ToString(right);
+    case '+':
+        if (left.isString() || right.isString())
+        {
+            return TemplateExpression::ToString(left) + TemplateExpression::ToString(right);
+        }
+        break;
+    case '<':
+    case '>':
+    case 'l':
+    case 'g':
+        if (left.isString() && right.isString())
+        {
+            const int comparison = left.asString().compare(right.asString());
+            return op == '<' ? comparison < 0 : op == '>' ? comparison > 0 : op == 'l' ? comparison <= 0 : comparison >= 0;
+        }
+        break;
+    }
+
+    if (!IsNumber(left) || !IsNumber(right))
+    {
+        ThrowEvaluationError(std::string("Operator ") + op + " expects numbers");
+    }
+
+    if (IsInteger(left) && IsInteger(right))
+    {
+        const Json::Int64 a = left.asLargestInt();
+        const Json::Int64 b = right.asLargestInt();
+        switch (op)
+        {
+        case '+':
+            return a + b;
+        case '-':
+            return a - b;
+        case '*':
+            return a * b;
+        case '/':
+        case '%':
+            if (b == 0)
+            {
+                ThrowEvaluationError("Division by zero");
+            }
+            return op == '/' ? a / b : a % b;
+        }
+    }
+
+    const double a = left.asDouble();
+    const double b = right.asDouble();
+    switch (op)
+    {
+    case '+':
+        return a + b;
+    case '-':
+        return a - b;
+    case '*':
+        return a * b;
+    case '/':
+        if (b == 0)
+        {
+            ThrowEvaluationError("Division by zero");
+        }
+        return a / b;
+    case '%':
+        return std::fmod(a, b);
+    case '<':
+        return a < b;
+    case '>':
+        return a > b;
+    case 'l':
+        return a <= b;
+    default:
+        return a >= b;
+    }
+}
+
+TemplateValue Evaluate(const Node& node, const TemplateScope& scope, Locals& locals)
+{
+    switch (node.kind)
+    {
+    case NodeKind::Constant:
+        return TemplateValue(&node.constant);
+    case NodeKind::Data:
+        return TemplateValue(scope.data);
+    case NodeKind::Root:
+        return TemplateValue(scope.root);
+    case NodeKind::Host:
+        return TemplateValue(scope.host);
+    case NodeKind::Index:
+        return scope.index ? TemplateValue(scope.index) : TemplateValue();
+    case NodeKind::Local:
+        return TemplateValue(locals[node.slot]);
+    case NodeKind::Member:
+    {
+        const TemplateValue parent = Evaluate(*node.children[0], scope, locals);
+        const Json::Value& value = parent.Get();
+        return GetChild(parent, value.isObject() ? value.find(node.name.data(), node.name.data() + node.name.size()) : nullptr);
+    }
+    case NodeKind::Element:
+    {
+        const TemplateValue parent = Evaluate(*node.children[0], scope, locals);
+        const TemplateValue index = Evaluate(*node.children[1], scope, locals);
+        const Json::Value& value = parent.Get();
+        if (value.isArray() && IsNumber(index.Get()))
+        {
+            const double position = index.Get().asDouble();
+            return GetChild(parent, position >= 0 && position < value.size() ? &value[static_cast<Json::ArrayIndex>(position)] : nullptr);
+        }
+        if (value.isObject() && index.Get().isString())
+        {
+            const std::string name = index.Get().asString();
+            return GetChild(parent, value.find(name.data(), name.data() + name.size()));
+        }
+        return TemplateValue();
+    }
+    case NodeKind::Not:
+        return TemplateValue(Json::Value(!IsTrue(Evaluate(*node.children[0], scope, locals).Get())));
+    case NodeKind::Negate:
+    {
+        const TemplateValue operand = Evaluate(*node.children[0], scope, locals);
+        if (IsInteger(operand.Get()))
+        {
+            return TemplateValue(Json::Value(-operand.Get().asLargestInt()));
+        }
+        return TemplateValue(Json::Value(-ToDouble(operand.Get(), "Operator -")));
+    }
+    case NodeKind::Binary:
+        return TemplateValue(EvaluateBinary(
+            node.op, Evaluate(*node.children[0], scope, locals).Get(), Evaluate(*node.children[1], scope, locals).Get()));
+    case NodeKind::And:
+        return TemplateValue(Json::Value(IsTrue(Evaluate(*node.children[0], scope, locals).Get()) &&
+                                         IsTrue(Evaluate(*node.children[1], scope, locals).Get())));
+    case NodeKind::Or:
+        return TemplateValue(Json::Value(IsTrue(Evaluate(*node.children[0], scope, locals).Get()) ||
+                                         IsTrue(Evaluate(*node.children[1], scope, locals).Get())));
+    case NodeKind::If:
+        return Evaluate(*node.children[IsTrue(Evaluate(*node.children[0], scope, locals).Get()) ? 1 : 2], scope, locals);
+    case NodeKind::Select:
+    case NodeKind::Where:
+    {
+        const TemplateValue collection = Evaluate(*node.children[0], scope, locals);
+        if (!collection.Get().isArray())
+        {
+            ThrowEvaluationError(node.kind == NodeKind::Select ? "select expects an array" : "where expects an array");
+        }
+
+        Json::Value results(Json::arrayValue);
+        locals.resize(node.slot + 1);
+        for (const auto& item : collection.Get())
+        {
+            locals[node.slot] = &item;
+            TemplateValue result = Evaluate(*node.children[1], scope, locals);
+            if (node.kind == NodeKind::Select)
+            {
+                results.append(result.Take());
+            }
+            else if (IsTrue(result.Get()))
+            {
+                results.append(item);
+            }
+        }
+        locals.resize(node.slot);
+        return TemplateValue(std::move(results));
+    }
+    case NodeKind::Call:
+    {
+        std::vector<TemplateValue> arguments;
+        arguments.reserve(node.children.size());
+        for (const auto& child : node.children)
+        {
+            arguments.push_back(Evaluate(*child, scope, locals));
+        }
+        return TemplateValue(node.function(arguments));
+    }
+    }
+    return TemplateValue();
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+TemplateValue::TemplateValue() : m_reference(nullptr)
+{
+}
+
+TemplateValue::TemplateValue(const Json::Value* reference) : m_reference(reference)
+{
+}
+
+TemplateValue::TemplateValue(Json::Value&& value) : m_reference(nullptr), m_value(std::move(value))
+{
+}
+
+const Json::Value& TemplateValue::Get() const
+{
+    return m_reference ? *m_reference : m_value;
+}
+
+bool TemplateValue::IsReference() const
+{
+    return m_reference != nullptr;
+}
+
+Json::Value TemplateValue::Take()
+{
+    return m_reference ? *m_reference : std::move(m_value);
+}
+
+TemplateExpression::TemplateExpression(std::string_view text) :
+    m_text(text), m_root(ExpressionParser(text).ParseExpression())
+{
+}
+
+TemplateExpression::~TemplateExpression() = default;
+
+TemplateValue TemplateExpression::Evaluate(const TemplateScope& scope) const
+{
+    Locals locals;
+    return ::Evaluate(*m_root, scope, locals);
+}
+
+bool TemplateExpression::IsPath() const
+{
+    const Node* node = m_root.get();
+    while (node->kind == NodeKind::Member || node->kind == NodeKind::Element)
+    {
+        if (node->kind == NodeKind::Element && node->children[1]->kind != NodeKind::Constant)
+        {
+            return false;
+        }
+        node = node->children[0].get();
+    }
+    return node != m_root.get() &&
+        (node->kind == NodeKind::Data || node->kind == NodeKind::Root || node->kind == NodeKind::Host);
+}
+
+const std::string& TemplateExpression::GetText() const
+{
+    return m_text;
+}
+
+std::string TemplateExpression::ToString(const Json::Value& value)
+{
+    switch (value.type())
+    {
+    case Json::nullValue:
+        return std::string();
+    case Json::stringValue:
+        return value.asString();
+    case Json::booleanValue:
+        return value.asBool() ? "true" : "false";
+    case Json::intValue:
+    case Json::uintValue:
+    case Json::realValue:
+        return NumberToString(value);
+    default:
+    {
+        std::string json = ParseUtil::JsonToString(value);
+        json.pop_back();
+        return json;
+    }
+    }
+}
+} // namespace AdaptiveCards
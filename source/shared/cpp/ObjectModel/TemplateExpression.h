@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// The data a template expression is evaluated against: $root, $host, $data and $index
+struct TemplateScope
+{
+    const Json::Value* root;
+    const Json::Value* host;
+    const Json::Value* data;
+    // null outside of an element repeated over an array
+    const Json::Value* index;
+};
+
+// The result of evaluating a template expression: either a value of the data, which isn't copied, or one the
+// expression computed
+class TemplateValue
+{
+public:
+    TemplateValue();
+    explicit TemplateValue(const Json::Value* reference);
+    explicit TemplateValue(Json::Value&& value);
+
+    const Json::Value& Get() const;
+    bool IsReference() const;
+    // Moves the value out, copying it if it's a reference into the data
+    Json::Value Take();
+
+private:
+    const Json::Value* m_reference;
+    Json::Value m_value;
+};
+
+// An expression of a template's ${...} binding, parsed once and evaluated against any number of data objects.
+//
+// Supports the Adaptive Expressions syntax templates use: literals, paths into the data ($data, $root, $host, $index,
+// a.b, a[0], a['b']), the operators ! - * / % + < <= > >= == != && || and the functions used by the template samples
+// (if, exists, string, int, float, json, length, count, toLower, toUpper, substring, indexOf, concat, sum, min, max,
+// select/foreach, where, formatNumber, formatDateTime, formatEpoch and formatTicks). Identifiers resolve against
+// $data.
+class TemplateExpression
+{
+public:
+    // Parses text, which is what's between "${" and "}". Throws an AdaptiveCardParseException if text isn't an
+    // expression or calls a function that isn't supported.
+    explicit TemplateExpression(std::string_view text);
+    ~TemplateExpression();
+
+    TemplateExpression(const TemplateExpression&) = delete;
+    TemplateExpression& operator=(const TemplateExpression&) = delete;
+
+    // Throws an AdaptiveCardParseException if the expression can't be evaluated against scope, for instance because
+    // a function is given arguments of the wrong type. A path that isn't in the data evaluates to null.
+    TemplateValue Evaluate(const TemplateScope& scope) const;
+
+    // Whether the expression is only a path into the data, which templates show as written when it's not in the data
+    bool IsPath() const;
+    const std::string& GetText() const;
+
+    // How values are shown when they're bound into a string: strings as they are, numbers the way JavaScript shows
+    // them, null as nothing and arrays and objects as json
+    static std::string ToString(const Json::Value& value);
+
+    struct Node;
+
+private:
+    std::string m_text;
+    std::unique_ptr<Node> m_root;
+};
+} // namespace AdaptiveCards
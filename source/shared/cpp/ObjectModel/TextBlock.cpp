@@ -67,6 +67,11 @@ DateTimePreparser TextBlock::GetTextForDateParsing() const
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+void TextBlock::GetTextForDateParsing(DateTimeTokenBuffer& buffer) const
+{
+    m_textElementProperties->GetTextForDateParsing(buffer);
+}
+
 std::optional<TextStyle> TextBlock::GetStyle() const
 {
     return m_textStyle;
@@ -175,10 +180,10 @@ std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& cont
     textBlock->m_textElementProperties->Deserialize(context, json);
 
     textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
-    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleFromString));
+    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleTryFromString));
     textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
     textBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     return textBlock;
 }
@@ -190,11 +195,17 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const KnownPropertiesSet knownProperties = [this]() {
+        KnownPropertiesSet properties{*m_knownProperties};
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+
+        AddKnownProperties(
+            properties,
+            {AdaptiveCardSchemaKey::Wrap,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::MaxLines,
+             AdaptiveCardSchemaKey::HorizontalAlignment});
+        return properties;
+    }();
+    m_knownProperties = &knownProperties;
 }
@@ -109,6 +109,11 @@ DateTimePreparser TextElementProperties::GetTextForDateParsing() const
     return DateTimePreparser(m_text);
 }
 
+void TextElementProperties::GetTextForDateParsing(DateTimeTokenBuffer& buffer) const
+{
+    DateTimePreparser::Tokenize(m_text, buffer);
+}
+
 std::optional<TextSize> TextElementProperties::GetTextSize() const
 {
     return m_textSize;
@@ -178,21 +183,32 @@ void TextElementProperties::Deserialize(ParseContext& context, const Json::Value
             WarningStatusCode::RequiredPropertyMissing, "required property, \"text\", is either empty or missing"));
     }
 
-    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeFromString));
-    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorFromString));
-    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightFromString));
-    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeFromString));
+    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeTryFromString));
+    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorTryFromString));
+    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightTryFromString));
+    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeTryFromString));
     SetIsSubtle(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::IsSubtle));
     SetLanguage(context.GetLanguage());
 }
 
+void TextElementProperties::PopulateKnownPropertiesSet(KnownPropertiesSet& knownProperties)
+{
+    AddKnownProperties(
+        knownProperties,
+        {AdaptiveCardSchemaKey::Text,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Color,
+         AdaptiveCardSchemaKey::TextWeight,
+         AdaptiveCardSchemaKey::FontType,
+         AdaptiveCardSchemaKey::IsSubtle});
+}
+
 void TextElementProperties::PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties)
 {
-    knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextWeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontType),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsSubtle)});
+    KnownPropertiesSet properties;
+    PopulateKnownPropertiesSet(properties);
+    for (const auto& property : properties)
+    {
+        knownProperties.emplace(property);
+    }
 }
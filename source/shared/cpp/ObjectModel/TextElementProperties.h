@@ -26,6 +26,8 @@ public:
     std::string GetText() const;
     void SetText(const std::string& value);
     DateTimePreparser GetTextForDateParsing() const;
+    // Tokenizes the text into buffer without copying it. The tokens are valid until the text or buffer change.
+    void GetTextForDateParsing(DateTimeTokenBuffer& buffer) const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -46,7 +48,9 @@ public:
     const std::string& GetLanguage() const;
 
     virtual void Deserialize(ParseContext& context, const Json::Value& root);
-    virtual void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
+    virtual void PopulateKnownPropertiesSet(KnownPropertiesSet& knownProperties);
+    // Adds the same properties to a set of strings, for callers (such as the bindings) that keep one
+    void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
 
 private:
     static std::string _ProcessHTMLEntities(const std::string& input);
@@ -139,7 +139,7 @@ std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& cont
     textInput->SetIsMultiline(isMultiline);
 
     const auto textInputStyle =
-        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleFromString);
+        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleTryFromString);
     textInput->SetTextInputStyle(textInputStyle);
 
     // emit warning in the case where style is `password` but multiline is specified (this is an invalid combination.
@@ -163,10 +163,12 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::IsMultiline,
+         AdaptiveCardSchemaKey::MaxLength,
+         AdaptiveCardSchemaKey::TextInput});
+    m_knownProperties = &knownProperties;
 }
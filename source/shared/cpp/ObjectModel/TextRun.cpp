@@ -14,7 +14,12 @@ TextRun::TextRun() :
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    static const KnownPropertiesSet knownProperties = [this]() {
+        KnownPropertiesSet properties{*m_knownProperties};
+        m_textElementProperties->PopulateKnownPropertiesSet(properties);
+        return properties;
+    }();
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
@@ -51,6 +56,11 @@ DateTimePreparser TextRun::GetTextForDateParsing() const
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+void TextRun::GetTextForDateParsing(DateTimeTokenBuffer& buffer) const
+{
+    m_textElementProperties->GetTextForDateParsing(buffer);
+}
+
 std::optional<TextSize> TextRun::GetTextSize() const
 {
     return m_textElementProperties->GetTextSize();
@@ -163,7 +173,7 @@ void TextRun::SetUnderline(const bool value)
 
 std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
+    std::shared_ptr<TextRun> inlineTextRun = context.MakeShared<TextRun>();
 
     if (json.isString())
     {
@@ -178,7 +188,7 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
         inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
         inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+        HandleUnknownProperties(json, *inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
     }
 
     return inlineTextRun;
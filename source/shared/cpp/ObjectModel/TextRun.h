@@ -26,6 +26,8 @@ public:
     std::string GetText() const;
     void SetText(const std::string& value);
     DateTimePreparser GetTextForDateParsing() const;
+    // Tokenizes the text into buffer without copying it. The tokens are valid until the text or buffer change.
+    void GetTextForDateParsing(DateTimeTokenBuffer& buffer) const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -100,9 +100,11 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
 
 void TimeInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
+    static const KnownPropertiesSet knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value});
+    m_knownProperties = &knownProperties;
 }
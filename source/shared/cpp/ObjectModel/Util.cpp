@@ -12,6 +12,70 @@
 
 using namespace AdaptiveCards;
 
+namespace
+{
+constexpr bool IsAsciiDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool IsAsciiHexDigit(char c)
+{
+    return IsAsciiDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// Scans dimension for a pixel size without allocating. Accepts exactly what ^([1-9]+\d*)(\.\d+)?(px)$ matches, and
+// points integralPart at the digits in front of the decimal point.
+bool TryScanPixelDimension(std::string_view dimension, std::string_view& integralPart)
+{
+    constexpr std::string_view unit{"px"};
+
+    if (dimension.empty() || dimension.front() < '1' || dimension.front() > '9')
+    {
+        return false;
+    }
+
+    size_t index = 1;
+    while (index < dimension.size() && IsAsciiDigit(dimension[index]))
+    {
+        ++index;
+    }
+    integralPart = dimension.substr(0, index);
+
+    if (index < dimension.size() && dimension[index] == '.')
+    {
+        const size_t fractionStart = ++index;
+        while (index < dimension.size() && IsAsciiDigit(dimension[index]))
+        {
+            ++index;
+        }
+
+        if (index == fractionStart)
+        {
+            return false;
+        }
+    }
+
+    return dimension.substr(index) == unit;
+}
+
+// Converts digits (at least one, all of them 0-9) to an int, or returns std::nullopt if the value doesn't fit
+std::optional<int> ParseNonNegativeInt(std::string_view digits)
+{
+    int value = 0;
+    for (const char digit : digits)
+    {
+        const int digitValue = digit - '0';
+        if (value > (std::numeric_limits<int>::max() - digitValue) / 10)
+        {
+            return std::nullopt;
+        }
+        value = value * 10 + digitValue;
+    }
+    return value;
+}
+} // namespace
+
 std::string ValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
 {
     if (backgroundColor.empty())
@@ -20,11 +84,8 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
     }
 
     const size_t backgroundColorLength = backgroundColor.length();
-    bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
-    for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
-    {
-        isValidColor = isxdigit(backgroundColor.at(i));
-    }
+    const bool isValidColor = (backgroundColor.front() == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9) &&
+        std::all_of(backgroundColor.begin() + 1, backgroundColor.end(), IsAsciiHexDigit);
 
     if (!isValidColor)
     {
@@ -34,65 +95,16 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
         return "#00000000";
     }
 
-    std::string validBackgroundColor;
     // If format given was #RRGGBB
     if (backgroundColorLength == 7)
     {
-        validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
-    }
-    else
-    {
-        validBackgroundColor = backgroundColor;
+        std::string validBackgroundColor;
+        validBackgroundColor.reserve(9);
+        validBackgroundColor.append("#FF").append(backgroundColor, 1, 6);
+        return validBackgroundColor;
     }
 
-    return validBackgroundColor;
-}
-
-void ValidateUserInputForDimensionWithUnit(
-    const std::string& unit,
-    const std::string& requestedDimension,
-    std::optional<int>& parsedDimension,
-    std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
-{
-    constexpr auto warningMessage =
-        "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
-    std::smatch matches;
-
-    if (std::regex_search(requestedDimension, matches, pattern))
-    {
-        try
-        {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
-        }
-        catch (const std::invalid_argument&)
-        {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
-            }
-        }
-        catch (const std::out_of_range&)
-        {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + requestedDimension));
-            }
-        }
-    }
-    else
-    {
-        if (warnings)
-        {
-            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
-        }
-    }
+    return backgroundColor;
 }
 
 bool ShouldParseForExplicitDimension(const std::string& input)
@@ -125,11 +137,28 @@ bool ShouldParseForExplicitDimension(const std::string& input)
 
 std::optional<int> ParseSizeForPixelSize(const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
 {
-    std::optional<int> parsedSize{};
-    if (ShouldParseForExplicitDimension(sizeString))
+    if (!ShouldParseForExplicitDimension(sizeString))
     {
-        const std::string unit = "px";
-        ValidateUserInputForDimensionWithUnit(unit, sizeString, parsedSize, warnings);
+        return std::nullopt;
+    }
+
+    std::string_view integralPart;
+    if (!TryScanPixelDimension(sizeString, integralPart))
+    {
+        if (warnings)
+        {
+            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidDimensionSpecified,
+                "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received " + sizeString));
+        }
+        return std::nullopt;
+    }
+
+    const std::optional<int> parsedSize = ParseNonNegativeInt(integralPart);
+    if (!parsedSize.has_value() && warnings)
+    {
+        warnings->emplace_back(
+            std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified, "out of range: " + sizeString));
     }
     return parsedSize;
 }
@@ -140,11 +169,21 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
     {
         if (action->GetElementType() == ActionType::ShowCard)
         {
-            auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
-            if (showCardAction->GetCard()->GetVersion().empty())
-            {
-                showCardAction->GetCard()->SetVersion(version);
-            }
+            std::static_pointer_cast<ShowCardAction>(action)->EnsureCardVersion(version);
+        }
+    }
+}
+
+void HandleUnknownProperties(const Json::Value& json, const KnownPropertiesSet& knownProperties, Json::Value& unknownProperties)
+{
+    for (auto it = json.begin(); it != json.end(); ++it)
+    {
+        const char* keyEnd = nullptr;
+        const char* keyBegin = it.memberName(&keyEnd);
+        const std::string_view key{keyBegin, static_cast<size_t>(keyEnd - keyBegin)};
+        if (knownProperties.find(key) == knownProperties.end())
+        {
+            unknownProperties[std::string{key}] = *it;
         }
     }
 }
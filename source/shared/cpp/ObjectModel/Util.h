@@ -12,4 +12,5 @@ std::optional<int> ParseSizeForPixelSize(
 
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>>& actions, const std::string& version);
 
+void HandleUnknownProperties(const Json::Value& json, const AdaptiveCards::KnownPropertiesSet& knownProperties, Json::Value& unknownProperties);
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
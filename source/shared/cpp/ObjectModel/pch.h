@@ -3,10 +3,13 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <limits>
 #include <locale>
 #include <memory>
 #include <numeric>
@@ -14,6 +17,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace AdaptiveCards::Benchmark
+{
+using BenchmarkFunction = void (*)();
+
+struct BenchmarkInfo
+{
+    const char* name;
+    BenchmarkFunction function;
+};
+
+// Every benchmark registers itself here (through ADAPTIVECARDS_BENCHMARK) so that main can run all of them, or just
+// the ones matching a filter, without a central list that has to be kept up to date.
+class BenchmarkRegistry
+{
+public:
+    static std::vector<BenchmarkInfo>& GetBenchmarks()
+    {
+        static std::vector<BenchmarkInfo> benchmarks;
+        return benchmarks;
+    }
+
+    BenchmarkRegistry(const char* name, BenchmarkFunction function) { GetBenchmarks().push_back({name, function}); }
+};
+
+// Runs operation iterations times, after one untimed warm-up run, and prints the mean time per run and how many heap
+// allocations each item took. itemsPerRun is used to report throughput when a single run processes several items
+// (cards in a corpus, for instance).
+void Measure(const std::string& name, size_t iterations, const std::function<void()>& operation, size_t itemsPerRun = 1);
+
+// The number of heap allocations the process has made so far
+size_t GetAllocationCount();
+
+// The largest the resident set of the process has been so far, in bytes, or 0 where that isn't known
+size_t GetPeakResidentSetSize();
+
+// Keeps the compiler from optimizing away a computation whose result would otherwise go unused
+template <typename T>
+void DoNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+    // MSVC has no inline assembly on x64, so read the value through a volatile pointer and fence the compiler instead
+    static_cast<void>(*reinterpret_cast<const volatile char*>(&value));
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+} // namespace AdaptiveCards::Benchmark
+
+#define ADAPTIVECARDS_BENCHMARK(benchmarkName)                                                                           \
+    static void benchmarkName();                                                                                         \
+    static const AdaptiveCards::Benchmark::BenchmarkRegistry benchmarkName##Registration{#benchmarkName, benchmarkName}; \
+    static void benchmarkName()
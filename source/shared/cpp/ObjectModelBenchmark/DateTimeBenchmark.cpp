@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "DateTimePreparser.h"
+#include "TextBlock.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// The text of a card with a lot of text in it: mostly plain, some with a date or a time in it, some with templating
+// that isn't a date
+std::vector<std::shared_ptr<TextBlock>> MakeTextBlocks(unsigned int count)
+{
+    const std::vector<std::string> texts = {
+        "Your order has shipped and should arrive within the next few business days.",
+        "Delivered on {{DATE(2017-10-27T22:23:00Z, SHORT)}} at {{TIME(2017-10-27T22:23:00Z)}}",
+        "Hello {{name}}, you have {{count}} new messages waiting for you.",
+        "The meeting moved to {{DATE(2019-02-12T15:00:00-08:00, LONG)}}, please update your calendar.",
+        "**Status:** Approved by the reviewer without comments",
+        "Last updated {{DATE(2020-06-30T09:45:00+05:30)}}"};
+
+    std::vector<std::shared_ptr<TextBlock>> textBlocks;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        auto textBlock = std::make_shared<TextBlock>();
+        textBlock->SetText(texts[i % texts.size()]);
+        textBlocks.push_back(std::move(textBlock));
+    }
+    return textBlocks;
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(DateTimePreparsing)
+{
+    constexpr unsigned int textBlockCount = 1000;
+    const auto textBlocks = MakeTextBlocks(textBlockCount);
+
+    // What a renderer does for every text element on every render
+    Measure("GetTextForDateParsing (1k TextBlocks)", 200, [&textBlocks]() {
+        for (const auto& textBlock : textBlocks)
+        {
+            DoNotOptimize(textBlock->GetTextForDateParsing().GetTextTokens().size());
+        }
+    }, textBlockCount);
+
+    Measure("GetTextForDateParsing into a buffer (1k TextBlocks)", 200, [&textBlocks]() {
+        DateTimeTokenBuffer buffer;
+        for (const auto& textBlock : textBlocks)
+        {
+            textBlock->GetTextForDateParsing(buffer);
+            DoNotOptimize(buffer.GetTokens().size());
+        }
+    }, textBlockCount);
+}
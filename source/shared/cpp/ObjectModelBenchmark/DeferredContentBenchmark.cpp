@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+constexpr unsigned int c_showCardCount = 8;
+constexpr unsigned int c_inputsPerShowCard = 20;
+
+// A card with a row of Action.ShowCards, each with a form behind it whose inputs have fallback content, the way
+// cards with several optional sections are usually built
+std::string MakeShowCardsCard()
+{
+    std::string actions;
+    for (unsigned int showCard = 0; showCard < c_showCardCount; ++showCard)
+    {
+        std::string body;
+        for (unsigned int input = 0; input < c_inputsPerShowCard; ++input)
+        {
+            const std::string id = std::to_string(showCard) + "_" + std::to_string(input);
+            body += std::string(body.empty() ? "" : ",") + R"(
+                { "type": "TextBlock", "text": "Question )" + id + R"(", "wrap": true, "weight": "bolder" },
+                { "type": "Input.ChoiceSet", "id": "choice)" + id + R"(", "style": "filtered", "choices": [
+                    { "title": "First", "value": "1" }, { "title": "Second", "value": "2" }, { "title": "Third", "value": "3" } ],
+                  "fallback": { "type": "Input.Text", "id": "text)" + id + R"(", "placeholder": "Your answer" } })";
+        }
+
+        actions += std::string(actions.empty() ? "" : ",") + R"(
+            { "type": "Action.ShowCard", "title": "Section )" + std::to_string(showCard) + R"(", "card": {
+                "type": "AdaptiveCard", "body": [)" + body + R"(],
+                "actions": [ { "type": "Action.Submit", "title": "Send", "data": { "section": )" + std::to_string(showCard) + R"( } } ] } })";
+    }
+
+    return R"({ "type": "AdaptiveCard", "version": "1.6",
+        "body": [ { "type": "TextBlock", "text": "Pick a section", "size": "large" } ],
+        "actions": [)" + actions + "] }";
+}
+
+std::shared_ptr<ParseResult> Parse(const std::string& card, bool deferNestedContent)
+{
+    ParseContext context;
+    context.SetDeferNestedContent(deferNestedContent);
+    return AdaptiveCard::DeserializeFromString(card, "1.6", context);
+}
+} // namespace
+
+// Parses a card with several show cards as it's shown, where a user opens one section at most, with and without
+// deferring the show cards and fallback content
+ADAPTIVECARDS_BENCHMARK(DeferredParsing)
+{
+    const std::string card = MakeShowCardsCard();
+
+    Measure("DeserializeFromString", 200, [&card]() { DoNotOptimize(Parse(card, false)); });
+
+    Measure("DeserializeFromString, deferred", 200, [&card]() { DoNotOptimize(Parse(card, true)); });
+
+    Measure("DeserializeFromString, deferred, one show card opened", 200, [&card]() {
+        const auto parseResult = Parse(card, true);
+        const auto& action = parseResult->GetAdaptiveCard()->GetActions().front();
+        DoNotOptimize(std::static_pointer_cast<ShowCardAction>(action)->GetCard());
+    });
+
+    Measure("DeserializeFromString, deferred, every show card opened", 200, [&card]() {
+        const auto parseResult = Parse(card, true);
+        for (const auto& action : parseResult->GetAdaptiveCard()->GetActions())
+        {
+            DoNotOptimize(std::static_pointer_cast<ShowCardAction>(action)->GetCard());
+        }
+    });
+}
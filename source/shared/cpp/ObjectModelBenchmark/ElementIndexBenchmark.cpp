@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "Container.h"
+#include "ElementIndex.h"
+#include "SharedAdaptiveCard.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// A card of sections that are each shown or hidden by an Action.ToggleVisibility, with one action that toggles them all
+std::string MakeToggleCard(unsigned int sectionCount)
+{
+    std::string body;
+    std::string targets;
+    for (unsigned int section = 0; section < sectionCount; ++section)
+    {
+        const std::string id = "section" + std::to_string(section);
+        body += std::string(body.empty() ? "" : ",") + R"(
+            { "type": "Container", "items": [
+                { "type": "ActionSet", "actions": [ { "type": "Action.ToggleVisibility", "title": "Details", "targetElements": [ ")" +
+                id + R"(" ] } ] },
+                { "type": "Container", "id": ")" + id + R"(", "isVisible": false, "items": [
+                    { "type": "TextBlock", "text": "Details of )" + id + R"(", "wrap": true } ] } ] })";
+        targets += std::string(targets.empty() ? "" : ",") + "\"" + id + "\"";
+    }
+
+    return R"({ "type": "AdaptiveCard", "version": "1.5", "body": [)" + body +
+           R"(], "actions": [ { "type": "Action.ToggleVisibility", "title": "Toggle all", "targetElements": [)" + targets + "] } ] }";
+}
+
+// What finding an element by id takes without an index: a walk of the card until it turns up
+std::shared_ptr<BaseCardElement> FindElement(const std::vector<std::shared_ptr<BaseCardElement>>& elements, const std::string& id)
+{
+    for (const auto& element : elements)
+    {
+        if (element->GetId() == id)
+        {
+            return element;
+        }
+
+        if (element->GetElementType() == CardElementType::Container)
+        {
+            if (auto found = FindElement(std::static_pointer_cast<Container>(element)->GetItems(), id))
+            {
+                return found;
+            }
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+// Resolves the targets of an Action.ToggleVisibility that toggles every section of a card, by walking the card for each
+// and with an ElementIndex
+ADAPTIVECARDS_BENCHMARK(ElementIdLookup)
+{
+    for (const unsigned int sectionCount : {1000u, 4000u})
+    {
+        const auto card = AdaptiveCard::DeserializeFromString(MakeToggleCard(sectionCount), "1.5")->GetAdaptiveCard();
+        const auto& targets = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions().front())->GetTargetElements();
+        const std::string suffix = " (" + std::to_string(targets.size()) + " targets)";
+
+        Measure("walking the card" + suffix, sectionCount < 2000 ? 5 : 1, [&card, &targets]() {
+            for (const auto& target : targets)
+            {
+                DoNotOptimize(FindElement(card->GetBody(), target->GetElementId()));
+            }
+        }, targets.size());
+
+        Measure("building an ElementIndex" + suffix, 50, [&card]() { DoNotOptimize(ElementIndex(*card)); });
+
+        const auto index = card->GetElementIndex();
+        Measure("ElementIndex::GetTargetElement" + suffix, 200, [&index, &targets]() {
+            for (const auto& target : targets)
+            {
+                DoNotOptimize(index->GetTargetElement(*target));
+            }
+        }, targets.size());
+    }
+}
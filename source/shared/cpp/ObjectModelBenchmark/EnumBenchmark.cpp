@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "pch.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+// Every enum defined with DEFINE_ADAPTIVECARD_ENUM
+#define ADAPTIVECARDS_FOR_EACH_ENUM(X) \
+    X(AdaptiveCardSchemaKey) \
+    X(CardElementType) \
+    X(ActionType) \
+    X(HeightType) \
+    X(Spacing) \
+    X(SeparatorThickness) \
+    X(ImageStyle) \
+    X(VerticalAlignment) \
+    X(ImageFillMode) \
+    X(ImageSize) \
+    X(HorizontalAlignment) \
+    X(ForegroundColor) \
+    X(TextStyle) \
+    X(TextWeight) \
+    X(TextSize) \
+    X(FontType) \
+    X(ActionsOrientation) \
+    X(ActionMode) \
+    X(ActionRole) \
+    X(AssociatedInputs) \
+    X(ChoiceSetStyle) \
+    X(TextInputStyle) \
+    X(ContainerStyle) \
+    X(ActionAlignment) \
+    X(IconPlacement) \
+    X(VerticalContentAlignment) \
+    X(InlineElementType) \
+    X(CarouselOrientation) \
+    X(Mode) \
+    X(ErrorStatusCode)
+
+namespace
+{
+// Collects the strings that the values of T serialize to. None of the enums have values outside of [0, 256).
+template <typename T>
+std::vector<std::string> GetEnumStrings(const std::string& (*toString)(const T))
+{
+    std::vector<std::string> strings;
+    for (int i = 0; i < 256; ++i)
+    {
+        try
+        {
+            strings.push_back(toString(static_cast<T>(i)));
+        }
+        catch (const std::out_of_range&)
+        {
+            // not a value of T, or one that doesn't serialize
+        }
+    }
+    return strings;
+}
+
+// Cards aren't always cased the way the schema is, so look up every string as is and upper cased
+std::vector<std::string> WithUpperCase(std::vector<std::string> strings)
+{
+    const size_t count = strings.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string upper = strings[i];
+        std::transform(upper.begin(), upper.end(), upper.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+        strings.push_back(std::move(upper));
+    }
+    return strings;
+}
+
+// Strings of a similar shape that don't map to any value: anagrams and truncations of the valid ones
+std::vector<std::string> MakeMisses(const std::vector<std::string>& strings)
+{
+    std::vector<std::string> misses;
+    for (const auto& str : strings)
+    {
+        std::string reversed(str.rbegin(), str.rend());
+        misses.push_back(reversed + "#");
+        misses.push_back(str.substr(0, str.size() / 2) + "#");
+    }
+    return misses;
+}
+
+template <typename T>
+void MeasureEnum(
+    const char* enumName,
+    const std::string& (*toString)(const T),
+    T (*fromString)(const std::string&),
+    std::optional<T> (*tryFromString)(std::string_view))
+{
+    const std::vector<std::string> hits = WithUpperCase(GetEnumStrings(toString));
+    const std::vector<std::string> misses = MakeMisses(hits);
+    const size_t iterations = 200000 / hits.size() + 1;
+
+    Measure(std::string(enumName) + " TryFromString hits", iterations, [&hits, tryFromString]() {
+        for (const auto& str : hits)
+        {
+            DoNotOptimize(tryFromString(str));
+        }
+    }, hits.size());
+
+    Measure(std::string(enumName) + " TryFromString misses", iterations, [&misses, tryFromString]() {
+        for (const auto& str : misses)
+        {
+            DoNotOptimize(tryFromString(str));
+        }
+    }, misses.size());
+
+    // What a miss costs callers that still go through the throwing FromString
+    Measure(std::string(enumName) + " FromString misses", iterations / 100 + 1, [&misses, fromString]() {
+        for (const auto& str : misses)
+        {
+            try
+            {
+                DoNotOptimize(fromString(str));
+            }
+            catch (const std::out_of_range&)
+            {
+            }
+        }
+    }, misses.size());
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(EnumStringLookup)
+{
+#define ADAPTIVECARDS_MEASURE_ENUM(ENUMTYPE) MeasureEnum<ENUMTYPE>(#ENUMTYPE, ENUMTYPE##ToString, ENUMTYPE##FromString, ENUMTYPE##TryFromString);
+    ADAPTIVECARDS_FOR_EACH_ENUM(ADAPTIVECARDS_MEASURE_ENUM)
+#undef ADAPTIVECARDS_MEASURE_ENUM
+}
@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "FallbackResolution.h"
+#include "FeatureRegistration.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+constexpr unsigned int c_elementCount = 1000;
+
+Json::Value MakeRequires(const std::string& featureVersion)
+{
+    Json::Value requirements;
+    requirements["adaptiveCards"] = "1.2";
+    requirements["foobar"] = featureVersion;
+    return requirements;
+}
+
+// A card of elementCount TextBlocks that each require a feature, falling back to a TextBlock that requires an older
+// version of it, which in turn is dropped
+Json::Value MakeFallbackCard(unsigned int elementCount)
+{
+    Json::Value body(Json::arrayValue);
+    for (unsigned int i = 0; i < elementCount; ++i)
+    {
+        Json::Value fallback;
+        fallback["type"] = "TextBlock";
+        fallback["text"] = "Fallback " + std::to_string(i);
+        fallback["requires"] = MakeRequires("1.0");
+        fallback["fallback"] = "drop";
+
+        Json::Value textBlock;
+        textBlock["type"] = "TextBlock";
+        textBlock["text"] = "Text " + std::to_string(i);
+        textBlock["requires"] = MakeRequires("2.1.3");
+        textBlock["fallback"] = std::move(fallback);
+        body.append(std::move(textBlock));
+    }
+
+    Json::Value card;
+    card["type"] = "AdaptiveCard";
+    card["version"] = "1.5";
+    card["body"] = std::move(body);
+    return card;
+}
+
+// What a renderer does for each element: walk its fallback chain until it finds one the host supports
+size_t CountRenderedElements(const AdaptiveCard& card, const FeatureRegistration& featureRegistration)
+{
+    size_t renderedCount = 0;
+    for (const auto& element : card.GetBody())
+    {
+        for (auto candidate = std::static_pointer_cast<BaseElement>(element); candidate;
+             candidate = candidate->GetFallbackContent())
+        {
+            if (candidate->MeetsRequirements(featureRegistration))
+            {
+                ++renderedCount;
+                break;
+            }
+        }
+    }
+    return renderedCount;
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(Fallback)
+{
+    const std::string cardString = ParseUtil::JsonToString(MakeFallbackCard(c_elementCount));
+    const auto card = AdaptiveCard::DeserializeFromString(cardString, "1.5")->GetAdaptiveCard();
+
+    FeatureRegistration featureRegistration;
+    featureRegistration.AddFeature("foobar", "1.5");
+
+    Measure("DeserializeFromString", 20, [&cardString]() {
+        DoNotOptimize(AdaptiveCard::DeserializeFromString(cardString, "1.5"));
+    }, c_elementCount);
+
+    Measure("MeetsRequirements", 200, [&card, &featureRegistration]() {
+        DoNotOptimize(CountRenderedElements(*card, featureRegistration));
+    }, c_elementCount);
+
+    // done once per card and host, after which rendering the resolved card takes no fallback work
+    const ElementParserRegistration elementParserRegistration;
+    const ActionParserRegistration actionParserRegistration;
+    Measure("ResolveFallback", 200, [&card, &featureRegistration, &elementParserRegistration, &actionParserRegistration]() {
+        DoNotOptimize(ResolveFallback(card, featureRegistration, elementParserRegistration, actionParserRegistration));
+    }, c_elementCount);
+
+    Measure("SemanticVersion", 20000, []() { DoNotOptimize(SemanticVersion("1.12.3.4")); });
+}
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "ResolvedHostConfig.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+constexpr ContainerStyle c_styles[] = {ContainerStyle::Default, ContainerStyle::Emphasis, ContainerStyle::Accent};
+constexpr ForegroundColor c_colors[] = {ForegroundColor::Default, ForegroundColor::Accent, ForegroundColor::Attention};
+constexpr TextSize c_sizes[] = {TextSize::Small, TextSize::Default, TextSize::Large};
+constexpr TextWeight c_weights[] = {TextWeight::Default, TextWeight::Bolder};
+
+// The lookups a renderer makes to style one TextBlock, for a range of styles
+template <typename Config>
+void StyleTextBlocks(const Config& config)
+{
+    for (const auto style : c_styles)
+    {
+        for (const auto color : c_colors)
+        {
+            for (const auto size : c_sizes)
+            {
+                for (const auto weight : c_weights)
+                {
+                    DoNotOptimize(config.GetForegroundColor(style, color, false));
+                    DoNotOptimize(config.GetFontFamily(FontType::Default));
+                    DoNotOptimize(config.GetFontSize(FontType::Default, size));
+                    DoNotOptimize(config.GetFontWeight(FontType::Default, weight));
+                }
+            }
+        }
+    }
+}
+
+constexpr size_t c_textBlocksPerRun = std::size(c_styles) * std::size(c_colors) * std::size(c_sizes) * std::size(c_weights);
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(HostConfigLookups)
+{
+    const HostConfig hostConfig;
+    const ResolvedHostConfig resolvedHostConfig(hostConfig);
+
+    Measure("HostConfig", 20000, [&hostConfig]() { StyleTextBlocks(hostConfig); }, c_textBlocksPerRun);
+    Measure("ResolvedHostConfig", 20000, [&resolvedHostConfig]() { StyleTextBlocks(resolvedHostConfig); }, c_textBlocksPerRun);
+    Measure("ResolvedHostConfig construction", 2000, [&hostConfig]() { DoNotOptimize(ResolvedHostConfig(hostConfig)); });
+}
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+std::string Repeat(const std::string& text, unsigned int count)
+{
+    std::string repeated;
+    repeated.reserve(text.size() * count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        repeated += text;
+    }
+    return repeated;
+}
+
+void MeasureMarkDown(const std::string& name, const std::string& text, size_t iterations)
+{
+    Measure(name + " (" + std::to_string(text.size()) + " chars)", iterations, [&text]() {
+        MarkDownParser parser(text);
+        DoNotOptimize(parser.TransformToHtml());
+        DoNotOptimize(parser.HasHtmlTags());
+    }, text.size());
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(MarkDownToHtml)
+{
+    MeasureMarkDown("Short text", "Your order of **3 items** has _shipped_.", 20000);
+
+    MeasureMarkDown(
+        "Emphasis", Repeat("Some *emphasized*, **strong** and ***both*** text, with_intra_word_underscores and a * stray. ", 100), 200);
+
+    MeasureMarkDown("Links", Repeat("See [the *docs*](https://adaptivecards.io/docs?a=(1)) or [here](http://x.y). ", 100), 200);
+
+    MeasureMarkDown("Lists", Repeat("- first **item**\r- second _item_\r1. numbered\r2. more\r\r", 100), 200);
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "ParseContext.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+Json::Value MakeTextBlock(const std::string& text)
+{
+    Json::Value textBlock;
+    textBlock["type"] = "TextBlock";
+    textBlock["text"] = text;
+    textBlock["wrap"] = true;
+    return textBlock;
+}
+
+// Builds a card whose body is depth Containers nested inside each other. Every level carries the subtrees that the
+// parser used to copy on the way down: its items array, a fallback element and a selectAction with submit data.
+Json::Value MakeNestedCard(unsigned int depth)
+{
+    Json::Value items(Json::arrayValue);
+    for (unsigned int level = depth; level > 0; --level)
+    {
+        Json::Value data;
+        data["level"] = level;
+        data["payload"] = std::string(64, 'x');
+
+        Json::Value selectAction;
+        selectAction["type"] = "Action.Submit";
+        selectAction["data"] = data;
+
+        Json::Value container;
+        container["type"] = "Container";
+        container["fallback"] = MakeTextBlock("Fallback for level " + std::to_string(level));
+        container["selectAction"] = selectAction;
+        container["items"] = Json::Value(Json::arrayValue);
+        container["items"].append(MakeTextBlock("Level " + std::to_string(level)));
+        container["items"].append(MakeTextBlock("Another block at level " + std::to_string(level)));
+        for (auto& item : items)
+        {
+            container["items"].append(std::move(item));
+        }
+
+        items = Json::Value(Json::arrayValue);
+        items.append(std::move(container));
+    }
+
+    Json::Value card;
+    card["type"] = "AdaptiveCard";
+    card["version"] = "1.6";
+    card["body"] = std::move(items);
+    return card;
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(NestedCardParsing)
+{
+    for (const unsigned int depth : {4u, 16u, 64u, 128u})
+    {
+        const Json::Value cardJson = MakeNestedCard(depth);
+        const std::string cardString = ParseUtil::JsonToString(cardJson);
+        const size_t iterations = 4096 / depth;
+
+        Measure("Deserialize (depth " + std::to_string(depth) + ")", iterations, [&cardJson]() {
+            ParseContext context;
+            DoNotOptimize(AdaptiveCard::Deserialize(cardJson, "1.6", context));
+        });
+
+        Measure("DeserializeFromString (depth " + std::to_string(depth) + ")", iterations, [&cardString]() {
+            DoNotOptimize(AdaptiveCard::DeserializeFromString(cardString, "1.6"));
+        });
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "CardBatchParser.h"
+#include "DateTimePreparser.h"
+#include "HostConfig.h"
+#include "MarkDownParser.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// The samples directory of the repo, unless ADAPTIVECARDS_SAMPLES_DIRECTORY points somewhere else at run time
+std::filesystem::path GetSamplesDirectory()
+{
+    if (const char* directory = std::getenv("ADAPTIVECARDS_SAMPLES_DIRECTORY"))
+    {
+        return directory;
+    }
+    return ADAPTIVECARDS_SAMPLES_DIRECTORY;
+}
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Collects the text of every element in json, to feed the markdown and date parsers what cards actually contain
+void CollectTexts(const Json::Value& json, std::vector<std::string>& texts)
+{
+    if (json.isObject())
+    {
+        const Json::Value& text = json["text"];
+        if (text.isString())
+        {
+            texts.push_back(text.asString());
+        }
+    }
+
+    if (json.isObject() || json.isArray())
+    {
+        for (const auto& child : json)
+        {
+            CollectTexts(child, texts);
+        }
+    }
+}
+
+struct Corpus
+{
+    std::vector<std::string> cards;
+    std::vector<std::string> hostConfigs;
+    std::vector<std::string> texts;
+};
+
+// Loads every card under the samples directory that parses, and every host config in samples/HostConfig
+Corpus LoadSampleCorpus()
+{
+    Corpus corpus;
+    const std::filesystem::path samplesDirectory = GetSamplesDirectory();
+    if (!std::filesystem::is_directory(samplesDirectory))
+    {
+        std::printf("  samples not found at %s; set ADAPTIVECARDS_SAMPLES_DIRECTORY\n", samplesDirectory.string().c_str());
+        return corpus;
+    }
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(samplesDirectory))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".json")
+        {
+            continue;
+        }
+
+        std::string contents = ReadFile(entry.path());
+        if (entry.path().parent_path().filename() == "HostConfig")
+        {
+            corpus.hostConfigs.push_back(std::move(contents));
+            continue;
+        }
+
+        try
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(contents);
+            if (!json.isObject() || json["type"].asString() != "AdaptiveCard")
+            {
+                continue;
+            }
+
+            AdaptiveCard::DeserializeFromString(contents, "1.6");
+            CollectTexts(json, corpus.texts);
+            corpus.cards.push_back(std::move(contents));
+        }
+        catch (const std::exception&)
+        {
+            // not a card the parser accepts, so it says nothing about how fast parsing is
+        }
+    }
+    return corpus;
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(SampleCorpus)
+{
+    const Corpus corpus = LoadSampleCorpus();
+    if (corpus.cards.empty())
+    {
+        return;
+    }
+
+    std::vector<std::shared_ptr<AdaptiveCard>> cards;
+    for (const auto& card : corpus.cards)
+    {
+        cards.push_back(AdaptiveCard::DeserializeFromString(card, "1.6")->GetAdaptiveCard());
+    }
+
+    Measure("DeserializeFromString (" + std::to_string(corpus.cards.size()) + " cards)", 20, [&corpus]() {
+        for (const auto& card : corpus.cards)
+        {
+            DoNotOptimize(AdaptiveCard::DeserializeFromString(card, "1.6"));
+        }
+    }, corpus.cards.size());
+
+    Measure("DeserializeFromString with card arena", 20, [&corpus]() {
+        for (const auto& card : corpus.cards)
+        {
+            ParseContext context;
+            context.SetUseCardArena(true);
+            DoNotOptimize(AdaptiveCard::DeserializeFromString(card, "1.6", context));
+        }
+    }, corpus.cards.size());
+
+    const CardBatchParser batchParser("1.6");
+    Measure("CardBatchParser", 20, [&corpus, &batchParser]() {
+        DoNotOptimize(batchParser.DeserializeFromStrings(corpus.cards));
+    }, corpus.cards.size());
+
+    Measure("Serialize", 20, [&cards]() {
+        for (const auto& card : cards)
+        {
+            DoNotOptimize(card->Serialize());
+        }
+    }, cards.size());
+
+    Measure("GetResourceInformation", 100, [&cards]() {
+        for (const auto& card : cards)
+        {
+            DoNotOptimize(card->GetResourceInformation());
+        }
+    }, cards.size());
+
+    if (!corpus.hostConfigs.empty())
+    {
+        Measure("HostConfig::DeserializeFromString (" + std::to_string(corpus.hostConfigs.size()) + " configs)", 200, [&corpus]() {
+            for (const auto& hostConfig : corpus.hostConfigs)
+            {
+                DoNotOptimize(HostConfig::DeserializeFromString(hostConfig));
+            }
+        }, corpus.hostConfigs.size());
+    }
+
+    Measure("MarkDownParser::TransformToHtml (" + std::to_string(corpus.texts.size()) + " texts)", 20, [&corpus]() {
+        for (const auto& text : corpus.texts)
+        {
+            MarkDownParser parser(text);
+            DoNotOptimize(parser.TransformToHtml());
+        }
+    }, corpus.texts.size());
+
+    Measure("DateTimePreparser", 20, [&corpus]() {
+        DateTimeTokenBuffer buffer;
+        for (const auto& text : corpus.texts)
+        {
+            DateTimePreparser::Tokenize(text, buffer);
+            DoNotOptimize(buffer.GetTokens().size());
+        }
+    }, corpus.texts.size());
+}
@@ -0,0 +1,177 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "JsonWriter.h"
+#include "ParseUtil.h"
+#include "PatchableCard.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+Json::Value MakeCard(Json::Value body)
+{
+    Json::Value card;
+    card["type"] = "AdaptiveCard";
+    card["version"] = "1.6";
+    card["body"] = std::move(body);
+    return card;
+}
+
+// A card with a single Table of rowCount rows and columnCount columns, with a TextBlock in every cell
+Json::Value MakeWideTableCard(unsigned int rowCount, unsigned int columnCount)
+{
+    Json::Value columns(Json::arrayValue);
+    for (unsigned int column = 0; column < columnCount; ++column)
+    {
+        Json::Value columnDefinition;
+        columnDefinition["width"] = 1;
+        columns.append(std::move(columnDefinition));
+    }
+
+    Json::Value rows(Json::arrayValue);
+    for (unsigned int row = 0; row < rowCount; ++row)
+    {
+        Json::Value cells(Json::arrayValue);
+        for (unsigned int column = 0; column < columnCount; ++column)
+        {
+            Json::Value textBlock;
+            textBlock["type"] = "TextBlock";
+            textBlock["text"] = "Cell " + std::to_string(row) + "," + std::to_string(column);
+
+            Json::Value cell;
+            cell["type"] = "TableCell";
+            cell["items"].append(std::move(textBlock));
+            cells.append(std::move(cell));
+        }
+
+        Json::Value tableRow;
+        tableRow["type"] = "TableRow";
+        tableRow["cells"] = std::move(cells);
+        rows.append(std::move(tableRow));
+    }
+
+    Json::Value table;
+    table["type"] = "Table";
+    table["firstRowAsHeader"] = true;
+    table["columns"] = std::move(columns);
+    table["rows"] = std::move(rows);
+
+    Json::Value body(Json::arrayValue);
+    body.append(std::move(table));
+    return MakeCard(std::move(body));
+}
+
+// A card with a single ChoiceSet of choiceCount choices
+Json::Value MakeChoiceSetCard(unsigned int choiceCount)
+{
+    Json::Value choices(Json::arrayValue);
+    for (unsigned int i = 0; i < choiceCount; ++i)
+    {
+        Json::Value choice;
+        choice["title"] = "Choice " + std::to_string(i);
+        choice["value"] = std::to_string(i);
+        choices.append(std::move(choice));
+    }
+
+    Json::Value choiceSet;
+    choiceSet["type"] = "Input.ChoiceSet";
+    choiceSet["id"] = "choices";
+    choiceSet["style"] = "filtered";
+    choiceSet["choices"] = std::move(choices);
+
+    Json::Value body(Json::arrayValue);
+    body.append(std::move(choiceSet));
+    return MakeCard(std::move(body));
+}
+
+// A card with a body of containerCount Containers of a few TextBlocks each
+Json::Value MakeLongBodyCard(unsigned int containerCount)
+{
+    Json::Value body(Json::arrayValue);
+    for (unsigned int i = 0; i < containerCount; ++i)
+    {
+        Json::Value items(Json::arrayValue);
+        for (unsigned int item = 0; item < 5; ++item)
+        {
+            Json::Value textBlock;
+            textBlock["type"] = "TextBlock";
+            textBlock["id"] = "text" + std::to_string(i) + "_" + std::to_string(item);
+            textBlock["text"] = "Item " + std::to_string(item) + " of container " + std::to_string(i);
+            textBlock["wrap"] = true;
+            items.append(std::move(textBlock));
+        }
+
+        Json::Value container;
+        container["type"] = "Container";
+        container["id"] = "container" + std::to_string(i);
+        container["items"] = std::move(items);
+        body.append(std::move(container));
+    }
+    return MakeCard(std::move(body));
+}
+
+// Measures the paths a host takes for every card it renders
+void MeasureCard(const std::string& name, const Json::Value& cardJson, size_t iterations)
+{
+    const std::string cardString = ParseUtil::JsonToString(cardJson);
+    const auto card = AdaptiveCard::DeserializeFromString(cardString, "1.6")->GetAdaptiveCard();
+
+    Measure("DeserializeFromString (" + name + ")", iterations, [&cardString]() {
+        DoNotOptimize(AdaptiveCard::DeserializeFromString(cardString, "1.6"));
+    });
+
+    Measure("DeserializeFromString with card arena (" + name + ")", iterations, [&cardString]() {
+        ParseContext context;
+        context.SetUseCardArena(true);
+        DoNotOptimize(AdaptiveCard::DeserializeFromString(cardString, "1.6", context));
+    });
+
+    Measure("DeserializeFromString on 4 threads (" + name + ")", iterations, [&cardString]() {
+        ParseContext context;
+        context.SetMaxParseThreads(4);
+        DoNotOptimize(AdaptiveCard::DeserializeFromString(cardString, "1.6", context));
+    });
+
+    Measure("Serialize (" + name + ")", iterations, [&card]() { DoNotOptimize(card->Serialize()); });
+
+    Measure("Serialize to a sink (" + name + ")", iterations, [&card]() {
+        size_t length = 0;
+        JsonWriter writer([&length](std::string_view text) { length += text.size(); });
+        card->Serialize(writer);
+        writer.Flush();
+        DoNotOptimize(length);
+    });
+
+    Measure("GetResourceInformation (" + name + ")", iterations, [&card]() {
+        DoNotOptimize(card->GetResourceInformation());
+    });
+}
+
+// Measures updating one value of a card, by patching the parsed card or by parsing the updated card from scratch
+void MeasurePatch(const std::string& name, const Json::Value& cardJson, const std::string& jsonPointer, size_t iterations)
+{
+    PatchableCard card(ParseUtil::JsonToString(cardJson), "1.6");
+    size_t update = 0;
+
+    Measure("PatchableCard::Replace (" + name + ")", iterations, [&]() {
+        DoNotOptimize(card.Replace(jsonPointer, "Update " + std::to_string(++update)));
+    });
+
+    const std::string updatedString = ParseUtil::JsonToString(card.GetJson());
+    Measure("DeserializeFromString of the updated card (" + name + ")", iterations, [&updatedString]() {
+        DoNotOptimize(AdaptiveCard::DeserializeFromString(updatedString, "1.6"));
+    });
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(ScaledCards)
+{
+    MeasureCard("table 200x20", MakeWideTableCard(200, 20), 20);
+    MeasureCard("table 20x200", MakeWideTableCard(20, 200), 20);
+    MeasureCard("10k choices", MakeChoiceSetCard(10000), 20);
+    MeasureCard("2000 containers", MakeLongBodyCard(2000), 20);
+    MeasurePatch("2000 containers", MakeLongBodyCard(2000), "/body/1000/items/2/text", 20);
+}
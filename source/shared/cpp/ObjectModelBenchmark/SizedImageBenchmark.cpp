@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "ParseContext.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "Util.h"
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// Builds a card of imageCount Images that all have a pixel width and height and a background color, so that parsing
+// it is dominated by the dimension and color validators
+Json::Value MakeSizedImageCard(unsigned int imageCount)
+{
+    Json::Value body(Json::arrayValue);
+    for (unsigned int i = 0; i < imageCount; ++i)
+    {
+        Json::Value image;
+        image["type"] = "Image";
+        image["url"] = "https://adaptivecards.io/content/cats/" + std::to_string(i % 3 + 1) + ".png";
+        image["width"] = std::to_string(16 + i % 200) + "px";
+        image["height"] = std::to_string(16 + i % 100) + ".5px";
+        image["backgroundColor"] = (i % 2 == 0) ? "#FF00FF" : "#80FFFFFF";
+        body.append(std::move(image));
+    }
+
+    Json::Value card;
+    card["type"] = "AdaptiveCard";
+    card["version"] = "1.6";
+    card["minHeight"] = "500px";
+    card["body"] = std::move(body);
+    return card;
+}
+} // namespace
+
+ADAPTIVECARDS_BENCHMARK(SizedImageParsing)
+{
+    constexpr unsigned int imageCount = 10000;
+    const Json::Value cardJson = MakeSizedImageCard(imageCount);
+
+    Measure("Deserialize (10k sized images)", 20, [&cardJson]() {
+        ParseContext context;
+        DoNotOptimize(AdaptiveCard::Deserialize(cardJson, "1.6", context));
+    }, imageCount);
+
+    const std::vector<std::string> sizes = {"20px", "120.5px", "1200px", "-5px", "10 px", "auto"};
+    Measure("ParseSizeForPixelSize", 100000, [&sizes]() {
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+        for (const auto& size : sizes)
+        {
+            DoNotOptimize(ParseSizeForPixelSize(size, &warnings));
+        }
+    }, sizes.size());
+
+    const std::vector<std::string> colors = {"#FF00FF", "#80FFFFFF", "#GG00FF", "red"};
+    Measure("ValidateColor", 100000, [&colors]() {
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+        for (const auto& color : colors)
+        {
+            DoNotOptimize(ValidateColor(color, warnings));
+        }
+    }, colors.size());
+}
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "CardSnapshot.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// The samples directory of the repo, unless ADAPTIVECARDS_SAMPLES_DIRECTORY points somewhere else at run time
+std::filesystem::path GetSamplesDirectory()
+{
+    if (const char* directory = std::getenv("ADAPTIVECARDS_SAMPLES_DIRECTORY"))
+    {
+        return directory;
+    }
+    return ADAPTIVECARDS_SAMPLES_DIRECTORY;
+}
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Every card under the samples directory that parses
+std::vector<std::string> LoadSampleCards()
+{
+    std::vector<std::string> cards;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(GetSamplesDirectory()))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".json" || entry.path().parent_path().filename() == "HostConfig")
+        {
+            continue;
+        }
+
+        std::string contents = ReadFile(entry.path());
+        try
+        {
+            const Json::Value json = ParseUtil::GetJsonValueFromString(contents);
+            if (json.isObject() && json["type"].asString() == "AdaptiveCard")
+            {
+                AdaptiveCard::DeserializeFromString(contents, "1.6");
+                cards.push_back(std::move(contents));
+            }
+        }
+        catch (const std::exception&)
+        {
+            // not a card the parser accepts
+        }
+    }
+    return cards;
+}
+
+// The bytes of a file, memory-mapped where that's available and read into memory elsewhere
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+#if defined(__linux__) || defined(__APPLE__)
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        const auto size = static_cast<size_t>(std::filesystem::file_size(path));
+        void* mapping = size != 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0) : MAP_FAILED;
+        close(descriptor);
+        if (mapping != MAP_FAILED)
+        {
+            m_mapping = mapping;
+            m_contents = std::string_view(static_cast<const char*>(mapping), size);
+            return;
+        }
+#endif
+        m_buffer = ReadFile(path);
+        m_contents = m_buffer;
+    }
+
+    ~MappedFile()
+    {
+#if defined(__linux__) || defined(__APPLE__)
+        if (m_mapping)
+        {
+            munmap(m_mapping, m_contents.size());
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view GetContents() const { return m_contents; }
+
+private:
+    void* m_mapping = nullptr;
+    std::string m_buffer;
+    std::string_view m_contents;
+};
+} // namespace
+
+// Loads the sample corpus from snapshots, as a host that parses cards once and keeps them on disk would, against
+// parsing their json each time
+ADAPTIVECARDS_BENCHMARK(Snapshot)
+{
+    if (!std::filesystem::is_directory(GetSamplesDirectory()))
+    {
+        std::printf("  samples not found at %s; set ADAPTIVECARDS_SAMPLES_DIRECTORY\n", GetSamplesDirectory().string().c_str());
+        return;
+    }
+
+    const auto cards = LoadSampleCards();
+    std::vector<std::shared_ptr<ParseResult>> parseResults;
+    size_t jsonSize = 0;
+    for (const auto& card : cards)
+    {
+        parseResults.push_back(AdaptiveCard::DeserializeFromString(card, "1.6"));
+        jsonSize += card.size();
+    }
+
+    // all of the snapshots go into one file, one after another
+    const auto snapshotPath = std::filesystem::temp_directory_path() / "ObjectModelBenchmark.snapshots";
+    std::vector<std::pair<size_t, size_t>> snapshotRanges;
+    {
+        std::ofstream snapshotFile(snapshotPath, std::ios::binary | std::ios::trunc);
+        size_t offset = 0;
+        for (const auto& parseResult : parseResults)
+        {
+            const auto snapshot = CardSnapshot::Save(*parseResult);
+            snapshotFile << snapshot;
+            snapshotRanges.emplace_back(offset, snapshot.size());
+            offset += snapshot.size();
+        }
+    }
+    const MappedFile snapshots(snapshotPath);
+    std::printf("  %zu bytes of json, %zu bytes of snapshots\n", jsonSize, snapshots.GetContents().size());
+
+    Measure("DeserializeFromString (" + std::to_string(cards.size()) + " cards)", 20, [&cards]() {
+        for (const auto& card : cards)
+        {
+            DoNotOptimize(AdaptiveCard::DeserializeFromString(card, "1.6"));
+        }
+    }, cards.size());
+
+    Measure("CardSnapshot::Load from a mapped file", 20, [&snapshots, &snapshotRanges]() {
+        for (const auto& [offset, size] : snapshotRanges)
+        {
+            DoNotOptimize(CardSnapshot::Load(snapshots.GetContents().substr(offset, size)));
+        }
+    }, cards.size());
+
+    Measure("CardSnapshot::Save", 20, [&parseResults]() {
+        for (const auto& parseResult : parseResults)
+        {
+            DoNotOptimize(CardSnapshot::Save(*parseResult));
+        }
+    }, parseResults.size());
+
+    std::error_code error;
+    std::filesystem::remove(snapshotPath, error);
+}
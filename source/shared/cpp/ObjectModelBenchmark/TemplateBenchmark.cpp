@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+#include "AdaptiveCardTemplate.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace AdaptiveCards;
+using namespace AdaptiveCards::Benchmark;
+
+namespace
+{
+// The samples directory of the repo, unless ADAPTIVECARDS_SAMPLES_DIRECTORY points somewhere else at run time
+std::filesystem::path GetSamplesDirectory()
+{
+    if (const char* directory = std::getenv("ADAPTIVECARDS_SAMPLES_DIRECTORY"))
+    {
+        return directory;
+    }
+    return ADAPTIVECARDS_SAMPLES_DIRECTORY;
+}
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Data objects like the sample data, which differ from each other as the data a host binds a template to does
+std::vector<Json::Value> MakeDataObjects(const Json::Value& sampleData, size_t count)
+{
+    std::vector<Json::Value> dataObjects;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Json::Value data = sampleData;
+        data["employee"]["name"] = "Employee " + std::to_string(i);
+        for (auto& request : data["requests"])
+        {
+            request["price"] = request["price"].asInt() + static_cast<int>(i % 1000);
+        }
+        dataObjects.push_back(std::move(data));
+    }
+    return dataObjects;
+}
+} // namespace
+
+// Binds each template of samples/Templates/Elements to many data objects, the way a host sending the same card to
+// many users does
+ADAPTIVECARDS_BENCHMARK(Template)
+{
+    const std::filesystem::path elementsDirectory = GetSamplesDirectory() / "Templates" / "Elements";
+    if (!std::filesystem::is_directory(elementsDirectory))
+    {
+        std::printf("  templates not found at %s; set ADAPTIVECARDS_SAMPLES_DIRECTORY\n", elementsDirectory.string().c_str());
+        return;
+    }
+
+    std::vector<std::string> templateJsons;
+    for (const auto& entry : std::filesystem::directory_iterator(elementsDirectory))
+    {
+        if (entry.path().filename() != "Template.data.json" && entry.path().extension() == ".json")
+        {
+            templateJsons.push_back(ReadFile(entry.path()));
+        }
+    }
+
+    const auto dataObjects = MakeDataObjects(ParseUtil::GetJsonValueFromString(ReadFile(elementsDirectory / "Template.data.json")), 100);
+    const size_t expansions = templateJsons.size() * dataObjects.size();
+
+    std::vector<std::unique_ptr<AdaptiveCardTemplate>> templates;
+    for (const auto& templateJson : templateJsons)
+    {
+        templates.push_back(std::make_unique<AdaptiveCardTemplate>(templateJson));
+    }
+
+    Measure("compile (" + std::to_string(templates.size()) + " templates)", 200, [&templateJsons]() {
+        for (const auto& templateJson : templateJsons)
+        {
+            DoNotOptimize(AdaptiveCardTemplate(templateJson));
+        }
+    }, templateJsons.size());
+
+    Measure("compile per data object, then Expand", 5, [&templateJsons, &dataObjects]() {
+        for (const auto& templateJson : templateJsons)
+        {
+            for (const auto& data : dataObjects)
+            {
+                DoNotOptimize(AdaptiveCardTemplate(templateJson).Expand(data));
+            }
+        }
+    }, expansions);
+
+    Measure("compile once, Expand (" + std::to_string(dataObjects.size()) + " data objects each)", 5, [&templates, &dataObjects]() {
+        for (const auto& cardTemplate : templates)
+        {
+            for (const auto& data : dataObjects)
+            {
+                DoNotOptimize(cardTemplate->Expand(data));
+            }
+        }
+    }, expansions);
+
+    Measure("compile once, ExpandToCard", 5, [&templates, &dataObjects]() {
+        for (const auto& cardTemplate : templates)
+        {
+            for (const auto& data : dataObjects)
+            {
+                DoNotOptimize(cardTemplate->ExpandToCard(data, "1.6"));
+            }
+        }
+    }, expansions);
+
+    Measure("compile once, Expand to a string, DeserializeFromString", 5, [&templates, &dataObjects]() {
+        for (const auto& cardTemplate : templates)
+        {
+            for (const auto& data : dataObjects)
+            {
+                DoNotOptimize(AdaptiveCard::DeserializeFromString(ParseUtil::JsonToString(cardTemplate->Expand(data)), "1.6"));
+            }
+        }
+    }, expansions);
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+std::atomic<size_t> allocationCount{0};
+} // namespace
+
+// Every allocation of the benchmarks goes through here so that Measure can report allocations per item
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+namespace AdaptiveCards::Benchmark
+{
+size_t GetAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+size_t GetPeakResidentSetSize()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // kilobytes on Linux
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+void Measure(const std::string& name, size_t iterations, const std::function<void()>& operation, size_t itemsPerRun)
+{
+    operation();
+
+    const size_t allocationsBefore = GetAllocationCount();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        operation();
+    }
+    const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start);
+    const size_t allocations = GetAllocationCount() - allocationsBefore;
+
+    const double microsecondsPerRun = elapsed.count() / iterations;
+    const double itemsPerSecond = (itemsPerRun * 1e6) / microsecondsPerRun;
+    const double allocationsPerItem = static_cast<double>(allocations) / (static_cast<double>(iterations) * itemsPerRun);
+    std::printf("  %-48s %12.2f us/run %14.0f items/s %12.1f allocs/item\n", name.c_str(), microsecondsPerRun, itemsPerSecond, allocationsPerItem);
+}
+} // namespace AdaptiveCards::Benchmark
+
+int main(int argc, char** argv)
+{
+    const char* filter = (argc > 1) ? argv[1] : "";
+
+    for (const auto& benchmark : AdaptiveCards::Benchmark::BenchmarkRegistry::GetBenchmarks())
+    {
+        if (std::strstr(benchmark.name, filter) == nullptr)
+        {
+            continue;
+        }
+
+        std::printf("%s\n", benchmark.name);
+        benchmark.function();
+
+        if (const size_t peakResidentSetSize = AdaptiveCards::Benchmark::GetPeakResidentSetSize())
+        {
+            std::printf("  %-48s %12.1f MB\n", "peak RSS so far", peakResidentSetSize / (1024.0 * 1024.0));
+        }
+    }
+
+    return 0;
+}